@@ -87,8 +87,11 @@ double IpoptOptions::getNegInfty() const {
 
 void IpoptOptions::setOption (const char* label, const mxArray* ptr) {
 
-  // Check to make sure we have a valid option.
-  SmartPtr<const RegisteredOption> option = app.RegOptions()->GetOption(label);
+  // Check to make sure we have a valid option. No options are added
+  // here, so we look in the registered options that are shared by all
+  // applications; RegOptions() would copy them in every call of ipopt.
+  SmartPtr<const RegisteredOption> option =
+    IpoptApplication::SharedRegisteredOptions()->GetOption(label);
   if (!IsValid(option)) {
     char buf[256];
     Snprintf(buf, 255, "You have specified a nonexistent IPOPT option (\"%s\")", label);
@@ -532,6 +532,9 @@ void IpoptRNLP::finalize_solution(Ipopt::SolverReturn status,
         case Ipopt::INTERNAL_ERROR:  
             SET_STRING_ELT(R_status_message, 0, mkChar("INTERNAL_ERROR: An unknown internal error occurred. Please contact the IPOPT authors through the mailing list."));
                 break;
+        case Ipopt::WALLTIME_EXCEEDED:  
+            SET_STRING_ELT(R_status_message, 0, mkChar("WALLTIME_EXCEEDED: Maximum wallclock time exceeded (can be specified by an option)."));
+                break;
 		default:
 			SET_STRING_ELT(R_status_message, 0, mkChar("Return status not recognized."));
 	
@@ -9,6 +9,7 @@
 #include "IpSmartPtr.hpp"
 
 #include "IpVector.hpp"
+#include "IpBlas.hpp"
 
 namespace Ipopt
 {
@@ -24,6 +25,7 @@ namespace Ipopt
     driver_vec_(driver_vec),
     sens_step_calc_(sens_step_calc),
     measurement_(measurement),
+    backsolve_block_size_(64),
     n_sens_steps_(n_sens_steps), // why doesn't he get this from the options?
     DirectionalD_X_(NULL),
     DirectionalD_L_(NULL),
@@ -54,6 +56,8 @@ namespace Ipopt
   bool SensAlgorithm::InitializeImpl(const OptionsList& options,
 				     const std::string& prefix)
   {
+    options.GetIntegerValue("sens_backsolve_block_size", backsolve_block_size_, prefix);
+
     // initialize values for variable sizes, and allocate memory for sensitivity vectors
     nx_ = dynamic_cast<const DenseVector*>( GetRawPtr( IpData().curr()->x() ) )->Dim() ;
     nceq_ = dynamic_cast<const DenseVector*>( GetRawPtr( IpData().curr()->y_c() ) )->Dim() ;
@@ -209,6 +213,67 @@ namespace Ipopt
     return retval ;
   }
 
+  SensAlgorithmExitStatus SensAlgorithm::ComputeScenarios(Index n_scenarios,
+							  const Number* delta_p,
+							  Number* SX, Number* SL,
+							  Number* SZL, Number* SZU) {
+
+    DBG_START_METH("SensAlgorithm::ComputeScenarios", dbg_verbosity);
+
+    SensAlgorithmExitStatus retval = SOLVE_SUCCESS;
+
+    sens_step_calc_->SetSchurDriver(driver_vec_[0]);
+
+    SmartPtr<DenseVectorSpace> delta_u_space = new DenseVectorSpace(np_);
+
+    std::vector< SmartPtr<DenseVector> > delta_uV;
+    std::vector< SmartPtr<IteratesVector> > solV;
+
+    /* Loop through all blocks of perturbations */
+    for (Index first=0; first<n_scenarios; first+=backsolve_block_size_) {
+      Index n_block = Min(backsolve_block_size_, n_scenarios-first);
+
+      delta_uV.resize(n_block);
+      solV.resize(n_block);
+      for (Index i=0; i<n_block; ++i) {
+	delta_uV[i] = new DenseVector(GetRawPtr(ConstPtr(delta_u_space)));
+	delta_uV[i]->SetValues(delta_p + (first+i)*np_);
+	solV[i] = IpData().curr()->MakeNewIteratesVector();
+      }
+
+      if (!sens_step_calc_->MultiStep(delta_uV, solV)) {
+	retval = FATAL_ERROR;
+      }
+
+      for (Index i=0; i<n_block; ++i) {
+	// unscale solution...
+	UnScaleIteratesVector(&solV[i]) ;
+	StoreSolution(*solV[i], first+i, SX, SL, SZL, SZU) ;
+      }
+    }
+
+    return retval ;
+  }
+
+  void SensAlgorithm::StoreSolution(const IteratesVector& V, Index col,
+				    Number* SX, Number* SL, Number* SZL, Number* SZU) {
+
+    const Number* X_ = dynamic_cast<const DenseVector*>( GetRawPtr( V.x() ) )->ExpandedValues();
+    IpBlasDcopy(nx_, X_, 1, SX+col*nx_, 1);
+
+    const Number* Z_L_ = dynamic_cast<const DenseVector*>( GetRawPtr( V.z_L() ) )->ExpandedValues();
+    IpBlasDcopy(nzl_, Z_L_, 1, SZL+col*nzl_, 1);
+
+    const Number* Z_U_ = dynamic_cast<const DenseVector*>( GetRawPtr( V.z_U() ) )->ExpandedValues();
+    IpBlasDcopy(nzu_, Z_U_, 1, SZU+col*nzu_, 1);
+
+    const Number* LE_  = dynamic_cast<const DenseVector*>( GetRawPtr( V.y_c() ) )->ExpandedValues();
+    IpBlasDcopy(nceq_, LE_, 1, SL+col*nl_, 1);
+
+    const Number* LIE_ = dynamic_cast<const DenseVector*>( GetRawPtr( V.y_d() ) )->ExpandedValues();
+    IpBlasDcopy(ncineq_, LIE_, 1, SL+col*nl_+nceq_, 1);
+  }
+
   void SensAlgorithm::GetSensitivityMatrix(Index col) {
 
     /*
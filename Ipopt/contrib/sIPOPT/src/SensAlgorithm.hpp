@@ -39,6 +39,18 @@ namespace Ipopt
     SensAlgorithmExitStatus Run();
     SensAlgorithmExitStatus ComputeSensitivityMatrix(void);
 
+    /** Compute the perturbed solutions for n_scenarios perturbations
+     *  of the parameters with the factorization of the converged KKT
+     *  system.  delta_p holds the np() values of each perturbation
+     *  one after the other.  The unscaled perturbed solutions are
+     *  stored in SX, SL, SZL, and SZU, one column per perturbation,
+     *  like the sensitivity matrix.  The right hand sides are solved
+     *  in blocks of sens_backsolve_block_size. */
+    SensAlgorithmExitStatus ComputeScenarios(Index n_scenarios,
+					     const Number* delta_p,
+					     Number* SX, Number* SL,
+					     Number* SZL, Number* SZU);
+
 
     /** accessor methods to get access to variable sizes */
     Index nl(void) { return nl_ ; }
@@ -74,6 +86,7 @@ namespace Ipopt
     std::vector< SmartPtr<SchurDriver> > driver_vec_;
     SmartPtr<SensitivityStepCalculator> sens_step_calc_;
     SmartPtr<Measurement> measurement_;
+    Index backsolve_block_size_;
     Index n_sens_steps_; // I think it is useful to state this number explicitly in the constructor and here.
 
     /** method to extract sensitivity vectors */
@@ -82,6 +95,10 @@ namespace Ipopt
     /** method to extract sensitivity matrix */
     void GetSensitivityMatrix(Index col) ;
 
+    /** method to store column col of the perturbed solutions */
+    void StoreSolution(const IteratesVector& V, Index col,
+		       Number* SX, Number* SL, Number* SZL, Number* SZU) ;
+
     /** private method used to uncale perturbed solution and sensitivities */
     void UnScaleIteratesVector(SmartPtr<IteratesVector> *V) ;
   };
@@ -140,6 +140,15 @@ namespace Ipopt
 			       "yes", "Allow inexact computation of backsolve in sIPOPT.",
 			       "no", "Don't allow inexact computation of backsolve in sIPOPT.",
 			       "");
+    roptions->AddLowerBoundedIntegerOption(
+					   "sens_backsolve_block_size",
+					   "Number of columns of the sensitivity matrix that are computed with one backsolve",
+					   1, 64,
+					   "The columns that are required for the sensitivity step and the reduced hessian are "
+					   "computed by solving the KKT system for one unit right hand side each. This many right "
+					   "hand sides are given to the linear solver together, so that the factors are only "
+					   "traversed once for each block. Larger values need more memory. If inexact backsolves "
+					   "are not allowed, the right hand sides are solved one after the other.");
     roptions->AddStringOption2(
 			       "sens_kkt_residuals",
 			       "For sonsitivity solution, take KKT residuals into account",
@@ -263,6 +272,7 @@ namespace Ipopt
 	  yc = ip_data_->curr()->y_c();
 	  yd = ip_data_->curr()->y_d();*/
       case MAXITER_EXCEEDED:
+      case WALLTIME_EXCEEDED:
       case STOP_AT_TINY_STEP:
       case STOP_AT_ACCEPTABLE_POINT:
       case LOCAL_INFEASIBILITY:
@@ -315,6 +325,21 @@ namespace Ipopt
     return retval;
   }
 
+  SensAlgorithmExitStatus SensApplication::ComputeScenarios(Index n_scenarios,
+							    const Number* delta_p,
+							    Number *SX, Number *SL,
+							    Number *SZL, Number *SZU)
+  {
+    DBG_START_METH("SensApplication::ComputeScenarios", dbg_verbosity);
+
+    if (IsNull(controller)) {
+      jnlst_->Printf(J_ERROR, J_MAIN, "sIPOPT: Scenarios cannot be computed, because the sensitivity steps have not been computed.\n");
+      return FATAL_ERROR;
+    }
+
+    return controller->ComputeScenarios(n_scenarios, delta_p, SX, SL, SZL, SZU);
+  }
+
   void SensApplication::Initialize()
   {
     DBG_START_METH("SensApplication::Initialize", dbg_verbosity);
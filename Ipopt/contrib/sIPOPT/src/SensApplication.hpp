@@ -82,6 +82,17 @@ namespace Ipopt
       }
     }
 
+    /** Compute the perturbed solutions for a block of n_scenarios
+     *  perturbations of the parameters, reusing the factorization of
+     *  the KKT system at the solution.  delta_p holds the np()
+     *  parameter perturbations of each scenario one after the other.
+     *  The primal and dual solutions are stored in SX, SL, SZL, SZU
+     *  with one column per scenario, in the layout of
+     *  GetSensitivityMatrix.  Can only be called after Run has
+     *  computed the sensitivity steps. */
+    SensAlgorithmExitStatus ComputeScenarios(Index n_scenarios, const Number* delta_p,
+					     Number *SX, Number *SL, Number *SZL, Number *SZU);
+
     /** accessor methods to get sizing info */
     Index nx()  {return (GetRawPtr(controller)!=NULL) ? controller->nx() : -1 ;} 
     Index nl()  {return (GetRawPtr(controller)!=NULL) ? controller->nl() : -1 ;} 
@@ -11,6 +11,8 @@
 #include "IpAlgStrategy.hpp"
 #include "IpIteratesVector.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 
@@ -30,6 +32,18 @@ namespace Ipopt
 
     virtual bool Solve(SmartPtr<IteratesVector> delta_lhs, SmartPtr<const IteratesVector> delta_rhs)=0;
 
+    /** Solve the system for several right hand sides at once.  The
+     *  default implementation calls Solve for each of them. */
+    virtual bool MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhsV,
+			    std::vector<SmartPtr<const IteratesVector> >& delta_rhsV)
+    {
+      bool retval = true;
+      for (Index i=0; i<(Index)delta_rhsV.size() && retval; ++i) {
+	retval = Solve(delta_lhsV[i], delta_rhsV[i]);
+      }
+      return retval;
+    }
+
   };
 
 }
@@ -22,7 +22,8 @@ namespace Ipopt
     :
     PCalculator(backsolver, A_data),
     nrows_(0),
-    ncols_(A_data->GetNRowsAdded())
+    ncols_(A_data->GetNRowsAdded()),
+    backsolve_block_size_(1)
   {
     DBG_START_METH("IndexPCalculator::IndexPCalculator", dbg_verbosity);
   }
@@ -44,6 +45,8 @@ namespace Ipopt
     }
     data_A()->Print(Jnlst(),J_VECTOR,J_USER1,"PCalc SchurData");
 
+    options.GetIntegerValue("sens_backsolve_block_size", backsolve_block_size_, prefix);
+
     return true;
   }
 
@@ -54,26 +57,43 @@ namespace Ipopt
 
     // 1. check whether all columns needed by data_A() are in map cols_ - we suppose data_A is IndexSchurData
     const std::vector<Index>* p2col_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(data_A()))->GetColIndices();
-    Index col;
+    std::vector<Index> new_cols;
+    std::vector<Index> new_schur_rows;
+    Index curr_schur_row=0;
+    for (std::vector<Index>::const_iterator col_it=p2col_idx->begin(); col_it!=p2col_idx->end(); ++col_it){
+      if (cols_.find(*col_it)==cols_.end()) {
+	// column is in data_A but not in P-matrix ->create
+	new_cols.push_back(*col_it);
+	new_schur_rows.push_back(curr_schur_row);
+      }
+      curr_schur_row++;
+    }
+
+    // 2. compute the missing columns, with one backsolve for a block
+    // of columns
+    Index n_new = (Index)new_cols.size();
     Number* col_values = NULL;
-    Index curr_dim, curr_schur_row=0;
+    Index curr_dim;
     SmartPtr<const DenseVector> comp_vec;
     const Number* comp_values;
-    std::map< Index, SmartPtr<PColumn> >::iterator find_it;
-    SmartPtr<IteratesVector> col_vec = IpData().curr()->MakeNewIteratesVector();
-    SmartPtr<IteratesVector> sol_vec = col_vec->MakeNewIteratesVector();
-    for (std::vector<Index>::const_iterator col_it=p2col_idx->begin(); col_it!=p2col_idx->end(); ++col_it){
-      col = *col_it;
+    for (Index block_start=0; block_start<n_new; block_start+=backsolve_block_size_) {
+      Index n_block = Min(backsolve_block_size_, n_new-block_start);
+      std::vector<SmartPtr<const IteratesVector> > col_vecs(n_block);
+      std::vector<SmartPtr<IteratesVector> > sol_vecs(n_block);
+      for (Index k=0; k<n_block; ++k) {
+	SmartPtr<IteratesVector> col_vec = IpData().curr()->MakeNewIteratesVector();
+	data_A()->GetRow(new_schur_rows[block_start+k], *col_vec);
+	col_vecs[k] = ConstPtr(col_vec);
+	sol_vecs[k] = col_vec->MakeNewIteratesVector();
+      }
+      retval = Solver()->MultiSolve(sol_vecs, col_vecs);
+      DBG_ASSERT(retval);
 
-      find_it = cols_.find(col);
-      if (find_it==cols_.end()) {
-	// column is in data_A but not in P-matrix ->create
-	data_A()->GetRow(curr_schur_row, *col_vec);
-	retval = Solver()->Solve(sol_vec, ConstPtr(col_vec));
-	DBG_ASSERT(retval);
+      for (Index k=0; k<n_block; ++k) {
+	SmartPtr<IteratesVector> sol_vec = sol_vecs[k];
 
 	/* This part is for displaying norm2(I_z*K^(-1)*I_1) */
-	DBG_PRINT((dbg_verbosity,"\ncurr_schur_row=%d, ",curr_schur_row));
+	DBG_PRINT((dbg_verbosity,"\ncurr_schur_row=%d, ",new_schur_rows[block_start+k]));
 	DBG_PRINT((dbg_verbosity,"norm2(z)=%23.16e\n",sol_vec->x()->Nrm2()));
 	/* end displaying norm2 */
 
@@ -86,10 +106,9 @@ namespace Ipopt
 	  IpBlasDcopy(comp_vec->Dim(), comp_values, 1, col_values+curr_dim,1);
 	  curr_dim += comp_vec->Dim();
 	}
-	cols_[col] = new PColumn(nrows_, col_values);
+	cols_[new_cols[block_start+k]] = new PColumn(nrows_, col_values);
 	col_values = NULL;
       }
-      curr_schur_row++;
     }
 
     return retval;
@@ -49,6 +49,9 @@ namespace Ipopt
     /** Cols of P */
     Index ncols_;
 
+    /** Number of columns of P that are computed with one backsolve */
+    Index backsolve_block_size_;
+
     std::map< Index, SmartPtr<PColumn> > cols_;
 
   };
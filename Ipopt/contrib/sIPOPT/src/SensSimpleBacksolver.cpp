@@ -44,4 +44,11 @@ namespace Ipopt
 
     return retval;
   }
+
+  bool SimpleBacksolver::MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhsV,
+				    std::vector<SmartPtr<const IteratesVector> >& delta_rhsV)
+  {
+    DBG_START_METH("SimpleBacksolver::MultiSolve", dbg_verbosity);
+    return pd_solver_->MultiSolve(delta_rhsV, delta_lhsV, allow_inexact_);
+  }
 } // end namespace
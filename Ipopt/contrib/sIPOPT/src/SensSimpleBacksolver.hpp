@@ -29,6 +29,12 @@ namespace Ipopt {
 
     bool Solve(SmartPtr<IteratesVector> delta_lhs, SmartPtr<const IteratesVector> delta_rhs);
 
+    /** Passes all right hand sides to the MultiSolve method of the
+     *  PDSystemSolver, so that they can be solved with one call of
+     *  the linear solver. */
+    bool MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhsV,
+		    std::vector<SmartPtr<const IteratesVector> >& delta_rhsV);
+
 
   private:
 
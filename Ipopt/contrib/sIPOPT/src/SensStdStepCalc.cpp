@@ -77,7 +77,7 @@ namespace Ipopt
     }
 
     delta_u_long->Print(Jnlst(),J_VECTOR,J_USER1,"delta_u_long");
-    backsolver_->Solve(&sol, ConstPtr(delta_u_long));
+    retval = backsolver_->Solve(&sol, ConstPtr(delta_u_long));
 
     // make a copy of the sensitivites
     SensitivityVector = (&sol)->MakeNewIteratesVectorCopy();
@@ -152,6 +152,54 @@ namespace Ipopt
     return retval;
   }
 
+  bool StdStepCalculator::MultiStep(std::vector<SmartPtr<DenseVector> >& delta_uV,
+				    std::vector<SmartPtr<IteratesVector> >& solV)
+  {
+    DBG_START_METH("StdStepCalculator::MultiStep", dbg_verbosity);
+    DBG_ASSERT(delta_uV.size()==solV.size());
+
+    // the boundcheck changes the SchurData for each perturbation
+    if (Do_Boundcheck() || delta_uV.empty()) {
+      return SensitivityStepCalculator::MultiStep(delta_uV, solV);
+    }
+
+    // the KKT residuals are the same for all perturbations
+    SmartPtr<IteratesVector> r_s;
+    if (kkt_residuals_) {
+      r_s = IpData().trial()->MakeNewIteratesVector();
+      r_s->Set_x_NonConst(*IpCq().curr_grad_lag_x()->MakeNewCopy());
+      r_s->Set_s_NonConst(*IpCq().curr_grad_lag_s()->MakeNewCopy());
+      r_s->Set_y_c_NonConst(*IpCq().curr_c()->MakeNewCopy());
+      r_s->Set_y_d_NonConst(*IpCq().curr_d_minus_s()->MakeNewCopy());
+      r_s->Set_z_L_NonConst(*IpCq().curr_compl_x_L()->MakeNewCopy());
+      r_s->Set_z_U_NonConst(*IpCq().curr_compl_x_U()->MakeNewCopy());
+      r_s->Set_v_L_NonConst(*IpCq().curr_compl_s_L()->MakeNewCopy());
+      r_s->Set_v_U_NonConst(*IpCq().curr_compl_s_U()->MakeNewCopy());
+      r_s->Print(Jnlst(),J_VECTOR,J_USER1,"r_s init");
+    }
+
+    std::vector<SmartPtr<const IteratesVector> > delta_u_longV(delta_uV.size());
+    for (Index i=0; i<(Index)delta_uV.size(); ++i) {
+      SmartPtr<IteratesVector> delta_u_long = IpData().trial()->MakeNewIteratesVector();
+      ift_data_->TransMultiply(*delta_uV[i], *delta_u_long);
+      if (IsValid(r_s)) {
+	delta_u_long->Axpy(-1.0, *r_s);
+      }
+      delta_u_longV[i] = ConstPtr(delta_u_long);
+    }
+
+    bool retval = backsolver_->MultiSolve(solV, delta_u_longV);
+
+    // make a copy of the sensitivities of the last perturbation
+    SensitivityVector = solV.back()->MakeNewIteratesVectorCopy();
+
+    for (Index i=0; i<(Index)solV.size(); ++i) {
+      solV[i]->Axpy(1.0, *IpData().trial());
+    }
+
+    return retval;
+  }
+
   bool StdStepCalculator::BoundCheck(IteratesVector& sol,
 				     std::vector<Index>& x_bound_violations_idx,
 				     std::vector<Number>& x_bound_violations_du)
@@ -34,6 +34,12 @@ namespace Ipopt
      *  a step using its SchurDriver, checks bounds, and returns it */
     virtual bool Step(DenseVector& delta_u, IteratesVector& sol);
 
+    /** Calculates the steps for several perturbations with one
+     *  MultiSolve of the backsolver.  If boundcheck is active, the
+     *  steps are computed one after the other with Step. */
+    virtual bool MultiStep(std::vector<SmartPtr<DenseVector> >& delta_uV,
+			   std::vector<SmartPtr<IteratesVector> >& solV);
+
     bool BoundCheck(IteratesVector& sol,
 		    std::vector<Index>& x_bound_violations_idx,
 		    std::vector<Number>& x_bound_violations_du);
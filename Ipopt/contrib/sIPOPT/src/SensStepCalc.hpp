@@ -9,14 +9,13 @@
 
 #include "IpAlgStrategy.hpp"
 #include "SensSchurDriver.hpp"
+#include "IpDenseVector.hpp"
+#include "IpIteratesVector.hpp"
 
+#include <vector>
 
 namespace Ipopt
 {
-  /** Forward declarations */
-  class DenseVector;
-  class IteratesVector;
-
   class SensitivityStepCalculator : public AlgorithmStrategyObject
   {
     /* This is the interface for the classes that perform the actual step. */
@@ -65,6 +64,20 @@ namespace Ipopt
      *  a step using its SchurDriver, checks bounds, and returns it */
     virtual bool Step(DenseVector& delta_u, IteratesVector& sol) =0;
 
+    /** Calculates the steps for several perturbations delta_u at once,
+     *  with the same SchurDriver.  The default implementation calls
+     *  Step for each of them. */
+    virtual bool MultiStep(std::vector<SmartPtr<DenseVector> >& delta_uV,
+			   std::vector<SmartPtr<IteratesVector> >& solV)
+    {
+      DBG_ASSERT(delta_uV.size()==solV.size());
+      bool retval = true;
+      for (Index i=0; i<(Index)delta_uV.size() && retval; ++i) {
+	retval = Step(*delta_uV[i], *solV[i]);
+      }
+      return retval;
+    }
+
     /** return the sensitivity vector */
     virtual SmartPtr<IteratesVector> GetSensitivityVector() = 0;
 
@@ -12,6 +12,7 @@
 #include "IpInexactData.hpp"
 #include "IpInexactCq.hpp"
 #include "IpNLPBoundsRemover.hpp"
+#include "IpOrigIpoptNLP.hpp"
 
 #include "IpOptErrorConvCheck.hpp"
 #include "IpStdAugSystemSolver.hpp"
@@ -42,6 +43,8 @@
 #include "IpMc19TSymScalingMethod.hpp"
 #include "IpInexactTSymScalingMethod.hpp"
 #include "IpIterativePardisoSolverInterface.hpp"
+#include "IpIterativeMinresSolver.hpp"
+#include "IpIterativeSqmrSolverInterface.hpp"
 #include "IpInexactNormalTerminationTester.hpp"
 #include "IpInexactPDTerminationTester.hpp"
 
@@ -124,11 +127,26 @@ namespace Ipopt
     SmartPtr<ConvergenceCheck> convCheck =
       new OptimalityErrorConvergenceCheck();
 
+    Index enum_int;
+    options.GetEnumValue("hessian_approximation", enum_int, prefix);
+    HessianApproximationType hessian_approximation =
+      HessianApproximationType(enum_int);
+
     SmartPtr<InexactNormalTerminationTester> NormalTester;
     SmartPtr<SparseSymLinearSolverInterface> SolverInterface;
+    SmartPtr<SymLinearSolver> MinresSolver;
     std::string linear_solver;
     options.GetStringValue("linear_solver", linear_solver, prefix);
-    if (linear_solver=="ma27") {
+    if (hessian_approximation==EXACT_PRODUCT) {
+      // The elements of the Hessian are not available, so none of the
+      // sparse direct solvers can be used.  Instead, the steps are
+      // computed by the matrix-free MINRES solver.
+      NormalTester = new InexactNormalTerminationTester();
+      SmartPtr<IterativeSolverTerminationTester> pd_tester =
+        new InexactPDTerminationTester();
+      MinresSolver = new IterativeMinresSolver(*NormalTester, *pd_tester);
+    }
+    else if (linear_solver=="ma27") {
 #ifndef COINHSL_HAS_MA27
 # ifdef HAVE_LINEARSOLVERLOADER
       SolverInterface = new Ma27TSolverInterface();
@@ -189,14 +207,27 @@ namespace Ipopt
         errmsg += buf;
         THROW_EXCEPTION(OPTION_INVALID, errmsg.c_str());
       }
+      if (!LSL_hasPardisoIpoptCallback()) {
+        std::string errmsg;
+        errmsg = "The Pardiso library \"";
+        errmsg += LSL_PardisoLibraryName();
+        errmsg += "\" does not provide the callback for the termination tests of the inexact algorithm.";
+        THROW_EXCEPTION(OPTION_INVALID, errmsg.c_str());
+      }
 # else
-      THROW_EXCEPTION(OPTION_INVALID, "Support for Pardiso has not been compiled into Ipopt.");
+      THROW_EXCEPTION(OPTION_INVALID, "Support for Pardiso has not been compiled into Ipopt.  Without Pardiso, the inexact algorithm can only be used with hessian_approximation=exact-product.");
 # endif
 #else
       SolverInterface = new IterativePardisoSolverInterface(*NormalTester, *pd_tester);
 #endif
 
     }
+    else if (linear_solver=="sqmr") {
+      NormalTester = new InexactNormalTerminationTester();
+      SmartPtr<IterativeSolverTerminationTester> pd_tester =
+        new InexactPDTerminationTester();
+      SolverInterface = new IterativeSqmrSolverInterface(*NormalTester, *pd_tester);
+    }
     else if (linear_solver=="wsmp") {
 #ifdef HAVE_WSMP
       SolverInterface = new WsmpSolverInterface();
@@ -231,8 +262,14 @@ namespace Ipopt
       ScalingMethod = new InexactTSymScalingMethod();
     }
 
-    SmartPtr<SymLinearSolver> ScaledSolver =
-      new TSymLinearSolver(SolverInterface, ScalingMethod);
+    SmartPtr<SymLinearSolver> ScaledSolver;
+    if (IsValid(MinresSolver)) {
+      // MINRES does the slack scaling itself
+      ScaledSolver = MinresSolver;
+    }
+    else {
+      ScaledSolver = new TSymLinearSolver(SolverInterface, ScalingMethod);
+    }
 
     SmartPtr<AugSystemSolver> AugSolver =
       new StdAugSystemSolver(*ScaledSolver);
@@ -312,7 +349,11 @@ namespace Ipopt
     // TODO: Find out about the following:
     //options_list.SetNumericValueIfUnset("bound_relax_factor", 0.);
     options_list.SetNumericValueIfUnset("kappa_d", 0.);
+#ifdef HAVE_PARDISO
     options_list.SetStringValueIfUnset("linear_solver", "pardiso");
+#else
+    options_list.SetStringValueIfUnset("linear_solver", "sqmr");
+#endif
     options_list.SetStringValue("linear_scaling_on_demand", "no");
     options_list.SetStringValue("replace_bounds", "yes");
   }
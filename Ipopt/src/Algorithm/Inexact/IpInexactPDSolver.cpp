@@ -19,6 +19,7 @@
 #endif
 
 #include "IpIterativeSolverTerminationTester.hpp"
+#include "IpOrigIpoptNLP.hpp"
 
 extern Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
 
@@ -75,7 +76,13 @@ namespace Ipopt
 
     std::string linear_solver;
     options.GetStringValue("linear_solver", linear_solver, prefix);
-    is_pardiso_ = (linear_solver=="pardiso");
+    Index enum_int;
+    options.GetEnumValue("hessian_approximation", enum_int, prefix);
+    HessianApproximationType hessian_approximation =
+      HessianApproximationType(enum_int);
+    solver_runs_tests_ = (linear_solver=="pardiso" ||
+                          linear_solver=="sqmr" ||
+                          hessian_approximation==EXACT_PRODUCT);
 
     if (!augSysSolver_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
                                    options, prefix)) {
@@ -249,7 +256,7 @@ namespace Ipopt
         InexData().set_tangential_x(tangential_x);
         InexData().set_tangential_s(tangential_s);
 
-        if (!is_pardiso_) {
+        if (!solver_runs_tests_) {
           // check if we need to modify the system
           bool modify_hessian = HessianRequiresChange();
           if (modify_hessian) {
@@ -130,9 +130,10 @@ namespace Ipopt
     Index inexact_regularization_ls_count_trigger_;
     //@}
 
-    /** flag indicating if we are dealing with the Pardiso solver
-     *  (temporary) */
-    bool is_pardiso_;
+    /** flag indicating if the iterative linear solver (Pardiso,
+     *  SQMR, or MINRES) performs the termination tests itself and reports the
+     *  outcome in test_result_ */
+    bool solver_runs_tests_;
 
     Index last_info_ls_count_;
   };
@@ -17,6 +17,8 @@
 #include "IpInexactLSAcceptor.hpp"
 #include "IpInexactCq.hpp"
 #include "IpIterativePardisoSolverInterface.hpp"
+#include "IpIterativeMinresSolver.hpp"
+#include "IpIterativeSqmrSolverInterface.hpp"
 #include "IpInexactNormalTerminationTester.hpp"
 #include "IpInexactPDTerminationTester.hpp"
 
@@ -34,6 +36,8 @@ namespace Ipopt
     InexactLSAcceptor::RegisterOptions(roptions);
     InexactCq::RegisterOptions(roptions);
     IterativePardisoSolverInterface::RegisterOptions(roptions);
+    IterativeMinresSolver::RegisterOptions(roptions);
+    IterativeSqmrSolverInterface::RegisterOptions(roptions);
     InexactNormalTerminationTester::RegisterOptions(roptions);
     InexactPDTerminationTester::RegisterOptions(roptions);
   }
@@ -0,0 +1,307 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpIterativeMinresSolver.hpp"
+#include "IpCompoundVector.hpp"
+#include "IpTripletHelper.hpp"
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+extern Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  IterativeMinresSolver::
+  IterativeMinresSolver(IterativeSolverTerminationTester& normal_tester,
+                        IterativeSolverTerminationTester& pd_tester)
+      :
+      normal_tester_(&normal_tester),
+      pd_tester_(&pd_tester)
+  {
+    DBG_START_METH("IterativeMinresSolver::IterativeMinresSolver()",
+                   dbg_verbosity);
+  }
+
+  IterativeMinresSolver::~IterativeMinresSolver()
+  {
+    DBG_START_METH("IterativeMinresSolver::~IterativeMinresSolver()",
+                   dbg_verbosity);
+  }
+
+  void IterativeMinresSolver::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddLowerBoundedIntegerOption(
+      "inexact_minres_max_iter",
+      "Maximal number of MINRES iterations per linear system.",
+      1, 500,
+      "This is only used if the Hessian is only available through "
+      "products (hessian_approximation=exact-product), in which case "
+      "the steps of the inexact algorithm are computed by a matrix-free "
+      "MINRES solver.  The termination tests of the inexact algorithm "
+      "usually stop MINRES before this limit is reached.");
+  }
+
+  bool IterativeMinresSolver::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetIntegerValue("inexact_minres_max_iter", minres_max_iter_,
+                            prefix);
+    std::string inexact_linear_system_scaling;
+    options.GetStringValue("inexact_linear_system_scaling",
+                           inexact_linear_system_scaling, prefix);
+    slack_scaling_ = (inexact_linear_system_scaling=="slack-based");
+
+    bool retval = normal_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                  IpCq(), options, prefix);
+    if (retval) {
+      retval = pd_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                                      IpCq(), options, prefix);
+    }
+
+    return retval;
+  }
+
+  void IterativeMinresSolver::ScaledMultVector(const SymMatrix& A,
+      const Vector* D,
+      const Vector& x,
+      Vector& y) const
+  {
+    if (D) {
+      SmartPtr<Vector> Dx = x.MakeNewCopy();
+      Dx->ElementWiseMultiply(*D);
+      A.MultVector(1., *Dx, 0., y);
+      y.ElementWiseMultiply(*D);
+    }
+    else {
+      A.MultVector(1., x, 0., y);
+    }
+  }
+
+  ESymSolverStatus
+  IterativeMinresSolver::MultiSolve(const SymMatrix& A,
+                                    std::vector<SmartPtr<const Vector> >& rhsV,
+                                    std::vector<SmartPtr<Vector> >& solV,
+                                    bool check_NegEVals,
+                                    Index numberOfNegEVals)
+  {
+    DBG_START_METH("IterativeMinresSolver::MultiSolve", dbg_verbosity);
+
+    DBG_ASSERT(!check_NegEVals);
+    DBG_ASSERT(rhsV.size()==1);
+
+    IpData().TimingStats().LinearSystemBackSolve().Start();
+
+    const Vector& rhs = *rhsV[0];
+    Vector& sol = *solV[0];
+    const Index ndim = rhs.Dim();
+
+    // The linear system is solved in the space in which the slack
+    // rows and columns are scaled, as it is done by
+    // InexactTSymScalingMethod for the Pardiso solver
+    SmartPtr<Vector> D;
+    if (slack_scaling_) {
+      D = rhs.MakeNew();
+      CompoundVector* cD = static_cast<CompoundVector*>(GetRawPtr(D));
+      DBG_ASSERT(dynamic_cast<CompoundVector*>(GetRawPtr(D)));
+      cD->GetCompNonConst(0)->Set(1.);
+      cD->GetCompNonConst(1)->Copy(*InexCq().curr_scaling_slacks());
+      cD->GetCompNonConst(2)->Set(1.);
+      cD->GetCompNonConst(3)->Set(1.);
+    }
+
+    IterativeSolverTerminationTester* tester;
+    bool is_normal = false;
+    if (IsNull(InexData().normal_x()) && InexData().compute_normal()) {
+      tester = GetRawPtr(normal_tester_);
+      is_normal = true;
+    }
+    else {
+      tester = GetRawPtr(pd_tester_);
+    }
+
+    bool retval = tester->InitializeSolve();
+    ASSERT_EXCEPTION(retval, INTERNAL_ABORT, "tester->InitializeSolve(); returned false");
+
+    // Scaled right hand side, which is also the initial residual for
+    // the starting point zero
+    SmartPtr<Vector> r = rhs.MakeNewCopy();
+    if (IsValid(D)) {
+      r->ElementWiseMultiply(*D);
+    }
+    const Number norm2_rhs = r->Nrm2();
+
+    SmartPtr<Vector> y = rhs.MakeNew();
+    y->Set(0.);
+
+    ESymSolverStatus status = SYMSOLVER_SUCCESS;
+    test_result_ = IterativeSolverTerminationTester::CONTINUE;
+    Index iter = 0;
+
+    if (norm2_rhs == 0.) {
+      test_result_ = IterativeSolverTerminationTester::OTHER_SATISFIED;
+    }
+    else {
+      Number* sol_vals = new Number[ndim];
+      Number* resid_vals = new Number[ndim];
+
+      // Lanczos vectors
+      SmartPtr<Vector> v_old = rhs.MakeNew();
+      v_old->Set(0.);
+      SmartPtr<Vector> v = r->MakeNewCopy();
+      v->Scal(1./norm2_rhs);
+      SmartPtr<Vector> p = rhs.MakeNew();
+      SmartPtr<Vector> Av = rhs.MakeNew();
+      // Search directions and their products with the matrix, used to
+      // update the residual without additional products
+      SmartPtr<Vector> w_old = rhs.MakeNew();
+      w_old->Set(0.);
+      SmartPtr<Vector> w = rhs.MakeNew();
+      w->Set(0.);
+      SmartPtr<Vector> Aw_old = rhs.MakeNew();
+      Aw_old->Set(0.);
+      SmartPtr<Vector> Aw = rhs.MakeNew();
+      Aw->Set(0.);
+
+      Number beta = norm2_rhs;
+      Number eta = norm2_rhs;
+      Number gamma_old = 1.;
+      Number gamma = 1.;
+      Number sigma_old = 0.;
+      Number sigma = 0.;
+
+      while (test_result_ == IterativeSolverTerminationTester::CONTINUE &&
+             iter < minres_max_iter_) {
+        iter++;
+
+        // Lanczos step
+        ScaledMultVector(A, GetRawPtr(D), *v, *Av);
+        Number alpha = v->Dot(*Av);
+        p->AddTwoVectors(1., *Av, -alpha, *v, 0.);
+        p->AddOneVector(-beta, *v_old, 1.);
+        Number beta_new = p->Nrm2();
+
+        // Givens rotations for the QR factorization of the
+        // tridiagonal matrix
+        Number delta = gamma*alpha - gamma_old*sigma*beta;
+        Number rho1 = sqrt(delta*delta + beta_new*beta_new);
+        Number rho2 = sigma*alpha + gamma_old*gamma*beta;
+        Number rho3 = sigma_old*beta;
+        if (rho1 == 0.) {
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "MINRES breakdown in iteration %d, the matrix seems to be singular.\n", iter);
+          status = SYMSOLVER_SINGULAR;
+          break;
+        }
+        Number gamma_new = delta/rho1;
+        Number sigma_new = beta_new/rho1;
+
+        // Update search direction, solution, and residual
+        w_old->AddTwoVectors(1./rho1, *v, -rho2/rho1, *w, -rho3/rho1);
+        SmartPtr<Vector> tmp = w_old;
+        w_old = w;
+        w = tmp;
+        Aw_old->AddTwoVectors(1./rho1, *Av, -rho2/rho1, *Aw, -rho3/rho1);
+        tmp = Aw_old;
+        Aw_old = Aw;
+        Aw = tmp;
+        y->AddOneVector(gamma_new*eta, *w, 1.);
+        r->AddOneVector(-gamma_new*eta, *Aw, 1.);
+        eta = -sigma_new*eta;
+
+        gamma_old = gamma;
+        gamma = gamma_new;
+        sigma_old = sigma;
+        sigma = sigma_new;
+
+        // Ask the termination tester whether we are done
+        TripletHelper::FillValuesFromVector(ndim, *y, sol_vals);
+        TripletHelper::FillValuesFromVector(ndim, *r, resid_vals);
+        test_result_ = tester->TestTermination(ndim, sol_vals, resid_vals,
+                                               iter, norm2_rhs);
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Termination Tester Result = %d.\n", test_result_);
+
+        if (beta_new == 0.) {
+          // The Krylov space is invariant, no further progress possible
+          break;
+        }
+
+        // Next Lanczos vector
+        p->Scal(1./beta_new);
+        tmp = v_old;
+        v_old = v;
+        v = p;
+        p = tmp;
+        beta = beta_new;
+      }
+
+      delete [] sol_vals;
+      delete [] resid_vals;
+    }
+    tester->Clear();
+
+    if (is_normal) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Number of MINRES iterations for normal step = %d.\n", iter);
+    }
+    else {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Number of MINRES iterations for PD step = %d.\n", iter);
+    }
+
+    // Undo the scaling
+    sol.Copy(*y);
+    if (IsValid(D)) {
+      sol.ElementWiseMultiply(*D);
+    }
+
+    IpData().TimingStats().LinearSystemBackSolve().End();
+
+    if (status != SYMSOLVER_SUCCESS) {
+      return status;
+    }
+    if (test_result_ == IterativeSolverTerminationTester::MODIFY_HESSIAN) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Termination tester requests modification of Hessian\n");
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+    if (test_result_ == IterativeSolverTerminationTester::TEST_2_SATISFIED) {
+      // Termination Test 2 is satisfied, set the step for the primal
+      // iterates to zero
+      CompoundVector* csol = static_cast<CompoundVector*>(&sol);
+      DBG_ASSERT(dynamic_cast<CompoundVector*>(&sol));
+      csol->GetCompNonConst(0)->Set(0.);
+      csol->GetCompNonConst(1)->Set(0.);
+    }
+    return SYMSOLVER_SUCCESS;
+  }
+
+  Index IterativeMinresSolver::NumberOfNegEVals() const
+  {
+    DBG_START_METH("IterativeMinresSolver::NumberOfNegEVals",dbg_verbosity);
+    THROW_EXCEPTION(INTERNAL_ABORT,
+                    "IterativeMinresSolver::NumberOfNegEVals called, but the MINRES solver does not compute the inertia");
+    return -1;
+  }
+
+  bool IterativeMinresSolver::IncreaseQuality()
+  {
+    return false;
+  }
+
+} // namespace Ipopt
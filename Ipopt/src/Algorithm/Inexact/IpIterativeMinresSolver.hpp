@@ -0,0 +1,142 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPITERATIVEMINRESSOLVER_HPP__
+#define __IPITERATIVEMINRESSOLVER_HPP__
+
+#include "IpSymLinearSolver.hpp"
+#include "IpInexactCq.hpp"
+#include "IpIterativeSolverTerminationTester.hpp"
+
+namespace Ipopt
+{
+
+  /** Matrix-free MINRES solver for the augmented system of the
+   *  inexact algorithm.  In contrast to the solvers that are derived
+   *  from SparseSymLinearSolverInterface, this solver never accesses
+   *  the elements of the matrix; it only requires products of the
+   *  matrix with vectors.  This makes it possible to use the inexact
+   *  algorithm with a Hessian that is only available through
+   *  Hessian-vector products (HessianProductMatrix).
+   *
+   *  As with the iterative Pardiso solver, the termination of the
+   *  Krylov iteration is decided by the normal or primal-dual
+   *  IterativeSolverTerminationTester, which is called in every
+   *  iteration with the current solution and residual (in the
+   *  slack-scaled system, if slack-based scaling is chosen).
+   */
+  class IterativeMinresSolver: public SymLinearSolver
+  {
+  public:
+    /** @name Constructor/Destructor */
+    //@{
+    /** Constructor */
+    IterativeMinresSolver(IterativeSolverTerminationTester& normal_tester,
+                          IterativeSolverTerminationTester& pd_tester);
+
+    /** Destructor */
+    virtual ~IterativeMinresSolver();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** @name Methods for requesting solution of the linear system. */
+    //@{
+    /** Solve operation for multiple right hand sides.  Only one
+     *  right hand side is supported. */
+    virtual ESymSolverStatus MultiSolve(const SymMatrix &A,
+                                        std::vector<SmartPtr<const Vector> >& rhsV,
+                                        std::vector<SmartPtr<Vector> >& solV,
+                                        bool check_NegEVals,
+                                        Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last
+     *  factorization.  This solver does not compute the inertia, so
+     *  this must not be called. */
+    virtual Index NumberOfNegEVals() const;
+    //@}
+
+    //* @name Options of Linear solver */
+    //@{
+    /** Request to increase quality of solution for next solve.  The
+     *  quality is determined by the termination tests, so this
+     *  always returns false. */
+    virtual bool IncreaseQuality();
+
+    /** Query whether inertia is computed by linear solver.
+     *  Returns false. */
+    virtual bool ProvidesInertia() const
+    {
+      return false;
+    }
+    //@}
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    IterativeMinresSolver();
+
+    /** Copy Constructor */
+    IterativeMinresSolver(const IterativeMinresSolver&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const IterativeMinresSolver&);
+    //@}
+
+    /** Method for computing y = D*A*D*x, where D is the (optional)
+     *  slack scaling. */
+    void ScaledMultVector(const SymMatrix& A, const Vector* D,
+                          const Vector& x, Vector& y) const;
+
+    /** @name Solver specific options */
+    //@{
+    /** Maximal number of MINRES iterations per solve */
+    Index minres_max_iter_;
+    /** Flag indicating whether the slack rows and columns are
+     *  scaled by the slack scaling vector */
+    bool slack_scaling_;
+    //@}
+
+    /** Termination tester for the normal step computation */
+    SmartPtr<IterativeSolverTerminationTester> normal_tester_;
+    /** Termination tester for the primal-dual step computation */
+    SmartPtr<IterativeSolverTerminationTester> pd_tester_;
+
+    /** Method to easily access Inexact data */
+    InexactData& InexData()
+    {
+      InexactData& inexact_data =
+        static_cast<InexactData&>(IpData().AdditionalData());
+      DBG_ASSERT(dynamic_cast<InexactData*>(&IpData().AdditionalData()));
+      return inexact_data;
+    }
+
+    /** Method to easily access Inexact calculated quantities */
+    InexactCq& InexCq()
+    {
+      InexactCq& inexact_cq =
+        static_cast<InexactCq&>(IpCq().AdditionalCq());
+      DBG_ASSERT(dynamic_cast<InexactCq*>(&IpCq().AdditionalCq()));
+      return inexact_cq;
+    }
+  };
+
+} // namespace Ipopt
+#endif
@@ -45,7 +45,7 @@
 
 
 Ipopt::IterativeSolverTerminationTester* global_tester_ptr_;
-Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+extern Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
 extern "C"
 {
   int IpoptTerminationTest(int n, double* sol, double* resid, int iter, double norm2_rhs) {
@@ -66,8 +66,11 @@ extern "C"
     }
   }
 
-  // The following global function pointer is defined in the Pardiso library
+#if defined(HAVE_PARDISO) || defined(HAVE_LINEARSOLVERLOADER)
+  // The following global function pointer is defined in the Pardiso
+  // library (or forwarded to it by the Pardiso loader)
   void SetIpoptCallbackFunction(int (*IpoptFunction)(int n, double* x,  double* r, int k, double b));
+#endif
 }
 
 /** Prototypes for Pardiso's subroutines */
@@ -314,7 +317,9 @@ namespace Ipopt
     // Option for the out of core variant
     // IPARM_[49] = pardiso_out_of_core_power;
 
+#if defined(HAVE_PARDISO) || defined(HAVE_LINEARSOLVERLOADER)
     SetIpoptCallbackFunction(&IpoptTerminationTest);
+#endif
 
     bool retval = normal_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
                   IpCq(), options, prefix);
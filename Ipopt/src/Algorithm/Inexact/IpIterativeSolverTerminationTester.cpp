@@ -9,6 +9,10 @@
 #include "IpIterativeSolverTerminationTester.hpp"
 #include "IpTripletHelper.hpp"
 
+// Outcome of the most recent termination test, set by the iterative
+// linear solver that ran the test
+Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+
 namespace Ipopt
 {
 
@@ -0,0 +1,463 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpoptConfig.h"
+#include "IpIterativeSqmrSolverInterface.hpp"
+#include "IpBlas.hpp"
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+extern Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  IterativeSqmrSolverInterface::
+  IterativeSqmrSolverInterface(IterativeSolverTerminationTester& normal_tester,
+                               IterativeSolverTerminationTester& pd_tester)
+      :
+      dim_(0),
+      nonzeros_(0),
+      a_(NULL),
+      lia_(NULL),
+      lja_(NULL),
+      lpos_(NULL),
+      dpos_(NULL),
+      lval_(NULL),
+      dval_(NULL),
+      initialized_(false),
+      normal_tester_(&normal_tester),
+      pd_tester_(&pd_tester)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::IterativeSqmrSolverInterface()",
+                   dbg_verbosity);
+  }
+
+  IterativeSqmrSolverInterface::~IterativeSqmrSolverInterface()
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::~IterativeSqmrSolverInterface()",
+                   dbg_verbosity);
+    delete[] a_;
+    delete[] lia_;
+    delete[] lja_;
+    delete[] lpos_;
+    delete[] dpos_;
+    delete[] lval_;
+    delete[] dval_;
+  }
+
+  void IterativeSqmrSolverInterface::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddLowerBoundedIntegerOption(
+      "inexact_sqmr_max_iter",
+      "Maximal number of SQMR iterations per linear system.",
+      1, 500,
+      "This is used by the bundled iterative solver of the inexact "
+      "algorithm (linear_solver=sqmr).  The termination tests of the "
+      "inexact algorithm usually stop SQMR before this limit is reached.");
+    roptions->AddLowerBoundedNumberOption(
+      "inexact_ildl_pivot_tol",
+      "Minimal pivot size in the incomplete LDL^T preconditioner.",
+      0.0, true, 1e-8,
+      "Pivots of the incomplete factorization with an absolute value "
+      "smaller than this tolerance (times the largest absolute diagonal "
+      "element, if that is larger than one) are replaced by this "
+      "tolerance.  This is used by the bundled iterative solver of the "
+      "inexact algorithm (linear_solver=sqmr).");
+  }
+
+  bool IterativeSqmrSolverInterface::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetIntegerValue("inexact_sqmr_max_iter", sqmr_max_iter_, prefix);
+    options.GetNumericValue("inexact_ildl_pivot_tol", ildl_pivot_tol_, prefix);
+
+    // Reset all private data
+    initialized_ = false;
+
+    bool retval = normal_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                  IpCq(), options, prefix);
+    if (retval) {
+      retval = pd_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                                      IpCq(), options, prefix);
+    }
+
+    return retval;
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::MultiSolve(bool new_matrix,
+      const Index* ia,
+      const Index* ja,
+      Index nrhs,
+      double* rhs_vals,
+      bool check_NegEVals,
+      Index numberOfNegEVals)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(!check_NegEVals || ProvidesInertia());
+    DBG_ASSERT(initialized_);
+    DBG_ASSERT(nrhs==1);
+
+    // check if a factorization has to be done
+    if (new_matrix) {
+      ESymSolverStatus retval = Factorization(ia, ja);
+      if (retval!=SYMSOLVER_SUCCESS) {
+        return retval;
+      }
+    }
+
+    // do the solve
+    return Solve(ia, ja, rhs_vals);
+  }
+
+  double* IterativeSqmrSolverInterface::GetValuesArrayPtr()
+  {
+    DBG_ASSERT(initialized_);
+    DBG_ASSERT(a_);
+    return a_;
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::InitializeStructure
+  (Index dim, Index nonzeros,
+   const Index* ia,
+   const Index* ja)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::InitializeStructure",dbg_verbosity);
+    dim_ = dim;
+    nonzeros_ = nonzeros;
+
+    delete[] a_;
+    delete[] lia_;
+    delete[] lja_;
+    delete[] lpos_;
+    delete[] dpos_;
+    delete[] lval_;
+    delete[] dval_;
+
+    a_ = new double[nonzeros_];
+    dval_ = new double[dim_];
+    dpos_ = new Index[dim_];
+    lia_ = new Index[dim_+1];
+
+    // We are given the upper triangular part row by row, which is the
+    // lower triangular part column by column.  Count the number of
+    // off-diagonal elements in each row of the lower triangular part
+    for (Index i=0; i<=dim_; i++) {
+      lia_[i] = 0;
+    }
+    for (Index i=0; i<dim_; i++) {
+      dpos_[i] = -1;
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        if (ja[p]==i) {
+          dpos_[i] = p;
+        }
+        else {
+          DBG_ASSERT(ja[p]>i);
+          lia_[ja[p]+1]++;
+        }
+      }
+    }
+    for (Index i=0; i<dim_; i++) {
+      lia_[i+1] += lia_[i];
+    }
+    const Index nnz_l = lia_[dim_];
+    lja_ = new Index[nnz_l];
+    lpos_ = new Index[nnz_l];
+    lval_ = new double[nnz_l];
+
+    // Since we go through the rows of the upper triangular part in
+    // increasing order, the column indices of the lower triangular
+    // part are sorted in each row
+    Index* next = new Index[dim_];
+    for (Index i=0; i<dim_; i++) {
+      next[i] = lia_[i];
+    }
+    for (Index i=0; i<dim_; i++) {
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        const Index j = ja[p];
+        if (j!=i) {
+          lja_[next[j]] = i;
+          lpos_[next[j]] = p;
+          next[j]++;
+        }
+      }
+    }
+    delete[] next;
+
+    initialized_ = true;
+
+    return SYMSOLVER_SUCCESS;
+  }
+
+  ESymSolverStatus
+  IterativeSqmrSolverInterface::Factorization(const Index* ia,
+      const Index* ja)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::Factorization",dbg_verbosity);
+
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemFactorization().Start();
+    }
+
+    Number max_diag = 1.;
+    for (Index i=0; i<dim_; i++) {
+      if (dpos_[i]>=0) {
+        max_diag = Max(max_diag, fabs(a_[dpos_[i]]));
+      }
+    }
+    const Number pivtol = ildl_pivot_tol_*max_diag;
+
+    // Incomplete LDL^T factorization without fill-in.  For row i we
+    // compute w_k = L_ik*D_k for all k<i in the sparsity pattern of
+    // row i, using only those elements of previous rows of L that
+    // are in the pattern of row i.
+    Number* w = new Number[dim_];
+    Index* mark = new Index[dim_];
+    for (Index i=0; i<dim_; i++) {
+      mark[i] = -1;
+    }
+
+    Index nperturbed = 0;
+    for (Index i=0; i<dim_; i++) {
+      for (Index p=lia_[i]; p<lia_[i+1]; p++) {
+        w[lja_[p]] = a_[lpos_[p]];
+        mark[lja_[p]] = i;
+      }
+      Number diag = (dpos_[i]>=0) ? a_[dpos_[i]] : 0.;
+      for (Index p=lia_[i]; p<lia_[i+1]; p++) {
+        const Index k = lja_[p];
+        Number val = w[k];
+        for (Index q=lia_[k]; q<lia_[k+1]; q++) {
+          const Index j = lja_[q];
+          if (mark[j]==i) {
+            val -= w[j]*lval_[q];
+          }
+        }
+        w[k] = val;
+        lval_[p] = val/dval_[k];
+        diag -= val*lval_[p];
+      }
+      if (fabs(diag) < pivtol) {
+        diag = (diag < 0.) ? -pivtol : pivtol;
+        nperturbed++;
+      }
+      dval_[i] = diag;
+    }
+    delete[] w;
+    delete[] mark;
+
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Incomplete LDL^T factorization done, %d pivots perturbed.\n",
+                   nperturbed);
+
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemFactorization().End();
+    }
+
+    return SYMSOLVER_SUCCESS;
+  }
+
+  void IterativeSqmrSolverInterface::MultVector(const Index* ia,
+      const Index* ja,
+      const double* x,
+      double* y) const
+  {
+    for (Index i=0; i<dim_; i++) {
+      y[i] = 0.;
+    }
+    for (Index i=0; i<dim_; i++) {
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        const Index j = ja[p];
+        y[i] += a_[p]*x[j];
+        if (j!=i) {
+          y[j] += a_[p]*x[i];
+        }
+      }
+    }
+  }
+
+  void IterativeSqmrSolverInterface::ApplyPreconditioner(const double* r,
+      double* x) const
+  {
+    // Forward substitution with L
+    for (Index i=0; i<dim_; i++) {
+      Number val = r[i];
+      for (Index p=lia_[i]; p<lia_[i+1]; p++) {
+        val -= lval_[p]*x[lja_[p]];
+      }
+      x[i] = val;
+    }
+    // Diagonal
+    for (Index i=0; i<dim_; i++) {
+      x[i] /= dval_[i];
+    }
+    // Backward substitution with L^T
+    for (Index i=dim_-1; i>=0; i--) {
+      const Number xi = x[i];
+      for (Index p=lia_[i]; p<lia_[i+1]; p++) {
+        x[lja_[p]] -= lval_[p]*xi;
+      }
+    }
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::Solve(const Index* ia,
+      const Index* ja,
+      double* rhs_vals)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::Solve",dbg_verbosity);
+
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemBackSolve().Start();
+    }
+
+    const Index N = dim_;
+    IterativeSolverTerminationTester* tester;
+    bool is_normal = false;
+    if (IsNull(InexData().normal_x()) && InexData().compute_normal()) {
+      tester = GetRawPtr(normal_tester_);
+      is_normal = true;
+    }
+    else {
+      tester = GetRawPtr(pd_tester_);
+    }
+
+    bool retval = tester->InitializeSolve();
+    ASSERT_EXCEPTION(retval, INTERNAL_ABORT, "tester->InitializeSolve(); returned false");
+
+    double* X = new double[N];
+    double* R = new double[N];
+    double* T = new double[N];
+    double* Q = new double[N];
+    double* D = new double[N];
+    double* RESID = new double[N];
+
+    const Number zero = 0.;
+    IpBlasDcopy(N, &zero, 0, X, 1);
+    IpBlasDcopy(N, &zero, 0, D, 1);
+    IpBlasDcopy(N, rhs_vals, 1, R, 1);
+
+    const Number norm2_rhs = IpBlasDnrm2(N, rhs_vals, 1);
+    test_result_ = IterativeSolverTerminationTester::CONTINUE;
+    Index iter = 0;
+
+    if (norm2_rhs == 0.) {
+      test_result_ = IterativeSolverTerminationTester::OTHER_SATISFIED;
+    }
+    else {
+      // Symmetric QMR (Freund and Nachtigal), with the preconditioner
+      // applied from the right
+      ApplyPreconditioner(R, Q);
+      Number tau = norm2_rhs;
+      Number theta = 0.;
+      Number rho = IpBlasDdot(N, R, 1, Q, 1);
+
+      while (test_result_ == IterativeSolverTerminationTester::CONTINUE &&
+             iter < sqmr_max_iter_) {
+        if (rho == 0.) {
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "SQMR breakdown (rho = 0) in iteration %d.\n", iter);
+          break;
+        }
+        MultVector(ia, ja, Q, T);
+        Number sigma = IpBlasDdot(N, Q, 1, T, 1);
+        if (sigma == 0.) {
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "SQMR breakdown (sigma = 0) in iteration %d.\n", iter);
+          break;
+        }
+        iter++;
+
+        Number alpha = rho/sigma;
+        IpBlasDaxpy(N, -alpha, T, 1, R, 1);
+        Number theta_new = IpBlasDnrm2(N, R, 1)/tau;
+        Number c = 1./sqrt(1. + theta_new*theta_new);
+        tau = tau*theta_new*c;
+        IpBlasDscal(N, c*c*theta*theta, D, 1);
+        IpBlasDaxpy(N, c*c*alpha, Q, 1, D, 1);
+        IpBlasDaxpy(N, 1., D, 1, X, 1);
+        theta = theta_new;
+
+        // The termination tests need the true residual
+        MultVector(ia, ja, X, RESID);
+        IpBlasDscal(N, -1., RESID, 1);
+        IpBlasDaxpy(N, 1., rhs_vals, 1, RESID, 1);
+        test_result_ = tester->TestTermination(N, X, RESID, iter, norm2_rhs);
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Termination Tester Result = %d.\n", test_result_);
+
+        if (test_result_ == IterativeSolverTerminationTester::CONTINUE) {
+          ApplyPreconditioner(R, T);
+          Number rho_new = IpBlasDdot(N, R, 1, T, 1);
+          Number beta = rho_new/rho;
+          IpBlasDscal(N, beta, Q, 1);
+          IpBlasDaxpy(N, 1., T, 1, Q, 1);
+          rho = rho_new;
+        }
+      }
+    }
+    tester->Clear();
+
+    if (is_normal) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Number of SQMR iterations for normal step = %d.\n", iter);
+    }
+    else {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Number of SQMR iterations for PD step = %d.\n", iter);
+    }
+
+    IpBlasDcopy(N, X, 1, rhs_vals, 1);
+
+    delete [] X;
+    delete [] R;
+    delete [] T;
+    delete [] Q;
+    delete [] D;
+    delete [] RESID;
+
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemBackSolve().End();
+    }
+
+    if (test_result_ == IterativeSolverTerminationTester::MODIFY_HESSIAN) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Termination tester requests modification of Hessian\n");
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+    if (test_result_ == IterativeSolverTerminationTester::TEST_2_SATISFIED) {
+      // Termination Test 2 is satisfied, set the step for the primal
+      // iterates to zero
+      Index nvars = IpData().curr()->x()->Dim() + IpData().curr()->s()->Dim();
+      IpBlasDcopy(nvars, &zero, 0, rhs_vals, 1);
+    }
+    return SYMSOLVER_SUCCESS;
+  }
+
+  Index IterativeSqmrSolverInterface::NumberOfNegEVals() const
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::NumberOfNegEVals",dbg_verbosity);
+    THROW_EXCEPTION(INTERNAL_ABORT,
+                    "IterativeSqmrSolverInterface::NumberOfNegEVals called, but the incomplete factorization does not determine the inertia");
+    return -1;
+  }
+
+  bool IterativeSqmrSolverInterface::IncreaseQuality()
+  {
+    return false;
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,210 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPITERATIVESQMRSOLVERINTERFACE_HPP__
+#define __IPITERATIVESQMRSOLVERINTERFACE_HPP__
+
+#include "IpSparseSymLinearSolverInterface.hpp"
+#include "IpInexactCq.hpp"
+#include "IpIterativeSolverTerminationTester.hpp"
+
+namespace Ipopt
+{
+
+  /** Bundled iterative linear solver for the inexact algorithm,
+   *  derived from SparseSymLinearSolverInterface.  The system is
+   *  solved with the symmetric QMR method (SQMR) of Freund and
+   *  Nachtigal, preconditioned with an incomplete LDL^T
+   *  factorization without fill-in (ILDL(0)).  SQMR allows an
+   *  indefinite preconditioner, so no pivoting is done; pivots that
+   *  are too small are replaced by a tolerance.
+   *
+   *  As for IterativePardisoSolverInterface, the iteration is stopped
+   *  by the normal or primal-dual IterativeSolverTerminationTester.
+   *  No third-party library is required.
+   */
+  class IterativeSqmrSolverInterface: public SparseSymLinearSolverInterface
+  {
+  public:
+    /** @name Constructor/Destructor */
+    //@{
+    /** Constructor */
+    IterativeSqmrSolverInterface(IterativeSolverTerminationTester& normal_tester,
+                                 IterativeSolverTerminationTester& pd_tester);
+
+    /** Destructor */
+    virtual ~IterativeSqmrSolverInterface();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** @name Methods for requesting solution of the linear system. */
+    //@{
+    /** Method for initializing internal stuctures. */
+    virtual ESymSolverStatus InitializeStructure(Index dim, Index nonzeros,
+        const Index *ia,
+        const Index *ja);
+
+    /** Method returing an internal array into which the nonzero
+     *  elements are to be stored. */
+    virtual double* GetValuesArrayPtr();
+
+    /** Solve operation for multiple right hand sides. */
+    virtual ESymSolverStatus MultiSolve(bool new_matrix,
+                                        const Index* ia,
+                                        const Index* ja,
+                                        Index nrhs,
+                                        double* rhs_vals,
+                                        bool check_NegEVals,
+                                        Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last
+     *  factorization.  The incomplete factorization does not
+     *  determine the inertia, so this must not be called. */
+    virtual Index NumberOfNegEVals() const;
+    //@}
+
+    //* @name Options of Linear solver */
+    //@{
+    /** Request to increase quality of solution for next solve.
+     */
+    virtual bool IncreaseQuality();
+
+    /** Query whether inertia is computed by linear solver.
+     *  Returns false. */
+    virtual bool ProvidesInertia() const
+    {
+      return false;
+    }
+    /** Query of requested matrix type that the linear solver
+     *  understands.
+     */
+    EMatrixFormat MatrixFormat() const
+    {
+      return CSR_Format_0_Offset;
+    }
+    //@}
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    IterativeSqmrSolverInterface();
+
+    /** Copy Constructor */
+    IterativeSqmrSolverInterface(const IterativeSqmrSolverInterface&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const IterativeSqmrSolverInterface&);
+    //@}
+
+    /** @name Information about the matrix */
+    //@{
+    /** Number of rows and columns of the matrix */
+    Index dim_;
+
+    /** Number of nonzeros of the matrix in upper triangular CSR
+     *  format. */
+    Index nonzeros_;
+
+    /** Array for storing the values of the matrix. */
+    double* a_;
+    //@}
+
+    /** @name Structure of the incomplete factor.  The strictly lower
+     *  triangular part of the matrix is stored row-wise (i.e., the
+     *  transpose of the upper triangular CSR format that is given to
+     *  us), with the column indices in each row sorted. */
+    //@{
+    /** Row starts of the strictly lower triangular part */
+    Index* lia_;
+    /** Column indices of the strictly lower triangular part */
+    Index* lja_;
+    /** Position of each element of the lower triangular part in a_ */
+    Index* lpos_;
+    /** Position of each diagonal element in a_ (-1 if the diagonal
+     *  element is structurally zero) */
+    Index* dpos_;
+    //@}
+
+    /** @name Incomplete factorization L*D*L^T */
+    //@{
+    /** Values of the strictly lower triangular part of L (the unit
+     *  diagonal is not stored) */
+    double* lval_;
+    /** Values of D */
+    double* dval_;
+    //@}
+
+    /** @name Solver specific options */
+    //@{
+    /** Maximal number of SQMR iterations per solve */
+    Index sqmr_max_iter_;
+    /** Minimal absolute value of a pivot in the incomplete
+     *  factorization, relative to max(1, largest diagonal element) */
+    Number ildl_pivot_tol_;
+    //@}
+
+    /** @name Initialization flags */
+    //@{
+    /** Flag indicating if internal data is initialized.
+     *  For initialization, this object needs to have seen a matrix */
+    bool initialized_;
+    //@}
+
+    /** @name Internal functions */
+    //@{
+    /** Compute the incomplete LDL^T factorization of the current
+     *  matrix. */
+    ESymSolverStatus Factorization(const Index* ia,
+                                   const Index* ja);
+
+    /** Do the SQMR iterations for the right hand side in rhs_vals.
+     *  The solution is returned in rhs_vals. */
+    ESymSolverStatus Solve(const Index* ia,
+                           const Index* ja,
+                           double* rhs_vals);
+
+    /** Compute y = A*x for the symmetric matrix in upper triangular
+     *  CSR format. */
+    void MultVector(const Index* ia, const Index* ja,
+                    const double* x, double* y) const;
+
+    /** Apply the preconditioner, x = (L*D*L^T)^{-1} r. */
+    void ApplyPreconditioner(const double* r, double* x) const;
+    //@}
+
+    /** Method to easily access Inexact data */
+    InexactData& InexData()
+    {
+      InexactData& inexact_data =
+        static_cast<InexactData&>(IpData().AdditionalData());
+      DBG_ASSERT(dynamic_cast<InexactData*>(&IpData().AdditionalData()));
+      return inexact_data;
+    }
+
+    /** Termination tester for normal step computation */
+    SmartPtr<IterativeSolverTerminationTester> normal_tester_;
+
+    /** Termination tester for primal-dual step computation */
+    SmartPtr<IterativeSolverTerminationTester> pd_tester_;
+  };
+
+} // namespace Ipopt
+#endif
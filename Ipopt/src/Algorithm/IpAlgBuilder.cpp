@@ -140,7 +140,31 @@ namespace Ipopt
   void AlgorithmBuilder::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
   {
     roptions->SetRegisteringCategory("Linear Solver");
-    roptions->AddStringOption9(
+    std::vector<std::string> linear_solvers;
+    std::vector<std::string> linear_solver_descriptions;
+    linear_solvers.push_back("ma27");
+    linear_solver_descriptions.push_back("use the Harwell routine MA27");
+    linear_solvers.push_back("ma57");
+    linear_solver_descriptions.push_back("use the Harwell routine MA57");
+    linear_solvers.push_back("ma77");
+    linear_solver_descriptions.push_back("use the Harwell routine HSL_MA77");
+    linear_solvers.push_back("ma86");
+    linear_solver_descriptions.push_back("use the Harwell routine HSL_MA86");
+    linear_solvers.push_back("ma97");
+    linear_solver_descriptions.push_back("use the Harwell routine HSL_MA97");
+    linear_solvers.push_back("pardiso");
+    linear_solver_descriptions.push_back("use the Pardiso package");
+    linear_solvers.push_back("wsmp");
+    linear_solver_descriptions.push_back("use WSMP package");
+    linear_solvers.push_back("mumps");
+    linear_solver_descriptions.push_back("use MUMPS package");
+#ifdef BUILD_INEXACT
+    linear_solvers.push_back("sqmr");
+    linear_solver_descriptions.push_back("use the bundled SQMR iterative solver (inexact algorithm only)");
+#endif
+    linear_solvers.push_back("custom");
+    linear_solver_descriptions.push_back("use custom linear solver");
+    roptions->AddStringOption(
       "linear_solver",
       "Linear solver used for step computations.",
 #ifdef COINHSL_HAS_MA27
@@ -176,15 +200,7 @@ namespace Ipopt
 #  endif
 # endif
 #endif
-      "ma27", "use the Harwell routine MA27",
-      "ma57", "use the Harwell routine MA57",
-      "ma77", "use the Harwell routine HSL_MA77",
-      "ma86", "use the Harwell routine HSL_MA86",
-      "ma97", "use the Harwell routine HSL_MA97",
-      "pardiso", "use the Pardiso package",
-      "wsmp", "use WSMP package",
-      "mumps", "use MUMPS package",
-      "custom", "use custom linear solver",
+      linear_solvers, linear_solver_descriptions,
       "Determines which linear algebra package is to be used for the "
       "solution of the augmented linear system (for obtaining the search "
       "directions). "
@@ -210,6 +226,22 @@ namespace Ipopt
       "MA57 are selected as linear solvers. This value is only available if "
       "Ipopt has been compiled with MC19.");
 
+    roptions->AddStringOption2(
+      "separate_least_square_solver",
+      "Use a separate linear solver instance for least-square estimates.",
+      "no",
+      "no", "use the linear solver of the Newton system",
+      "yes", "use a second instance of the linear solver",
+      "The least-square estimates of the constraint multipliers (see "
+      "\"constr_mult_init_max\" and \"recalc_y\") and the least-square "
+      "initialization of the iterates require the factorization of a "
+      "different matrix than the Newton system.  If this option is chosen, "
+      "these systems are solved with a second instance of the linear solver. "
+      "Then the factorization of the Newton system is kept, and each solver "
+      "instance reuses its own symbolic factorization, at the cost of the "
+      "memory for a second factorization.  This option is ignored for "
+      "linear_solver=custom.");
+
     roptions->SetRegisteringCategory("NLP Scaling");
     roptions->AddStringOption4(
       "nlp_scaling_method",
@@ -284,27 +316,14 @@ namespace Ipopt
       "EXPERIMENTAL!");
   }
 
-  SmartPtr<IpoptAlgorithm>
-  AlgorithmBuilder::BuildBasicAlgorithm(const Journalist& jnlst,
-                                        const OptionsList& options,
-                                        const std::string& prefix)
+  SmartPtr<SymLinearSolver>
+  AlgorithmBuilder::SymLinearSolverFactory(const Journalist& jnlst,
+      const OptionsList& options,
+      const std::string& prefix)
   {
-    DBG_START_FUN("AlgorithmBuilder::BuildBasicAlgorithm",
-                  dbg_verbosity);
-
-    bool mehrotra_algorithm;
-    options.GetBoolValue("mehrotra_algorithm", mehrotra_algorithm, prefix);
-
-    // Create the convergence check
-    SmartPtr<ConvergenceCheck> convCheck =
-      new OptimalityErrorConvergenceCheck();
-
-    // Create the solvers that will be used by the main algorithm
-
     SmartPtr<SparseSymLinearSolverInterface> SolverInterface;
     std::string linear_solver;
     options.GetStringValue("linear_solver", linear_solver, prefix);
-    bool use_custom_solver = false;
     if (linear_solver=="ma27") {
 #ifndef COINHSL_HAS_MA27
 # ifdef HAVE_LINEARSOLVERLOADER
@@ -474,55 +493,68 @@ namespace Ipopt
 #endif
 
     }
-    else if (linear_solver=="custom") {
-      ASSERT_EXCEPTION(IsValid(custom_solver_), OPTION_INVALID,
-                       "Selected linear solver CUSTOM not available.");
-      use_custom_solver = true;
+#ifdef BUILD_INEXACT
+    else if (linear_solver=="sqmr") {
+      THROW_EXCEPTION(OPTION_INVALID,
+                      "The SQMR iterative solver can only be used with the inexact algorithm (inexact_algorithm=yes).");
     }
+#endif
 
-    SmartPtr<AugSystemSolver> AugSolver;
-    if (use_custom_solver) {
-      AugSolver = custom_solver_;
-    }
-    else {
-      SmartPtr<TSymScalingMethod> ScalingMethod;
-      std::string linear_system_scaling;
-      if (!options.GetStringValue("linear_system_scaling",
-                                  linear_system_scaling, prefix)) {
-        // By default, don't use mc19 for non-HSL solvers, or HSL_MA97
-        if (linear_solver!="ma27" && linear_solver!="ma57" && linear_solver!="ma77" && linear_solver!="ma86") {
-          linear_system_scaling="none";
-        }
+    SmartPtr<TSymScalingMethod> ScalingMethod;
+    std::string linear_system_scaling;
+    if (!options.GetStringValue("linear_system_scaling",
+                                linear_system_scaling, prefix)) {
+      // By default, don't use mc19 for non-HSL solvers, or HSL_MA97
+      if (linear_solver!="ma27" && linear_solver!="ma57" && linear_solver!="ma77" && linear_solver!="ma86") {
+        linear_system_scaling="none";
       }
-      if (linear_system_scaling=="mc19") {
+    }
+    if (linear_system_scaling=="mc19") {
 #ifndef COINHSL_HAS_MC19
 # ifdef HAVE_LINEARSOLVERLOADER
-        ScalingMethod = new Mc19TSymScalingMethod();
-        if (!LSL_isMC19available()) {
-          char buf[256];
-          int rc = LSL_loadHSL(NULL, buf, 255);
-          if (rc) {
-            std::string errmsg;
-            errmsg = "Selected linear system scaling method MC19 not available.\n";
-            errmsg += buf;
-            THROW_EXCEPTION(OPTION_INVALID, errmsg.c_str());
-          }
+      ScalingMethod = new Mc19TSymScalingMethod();
+      if (!LSL_isMC19available()) {
+        char buf[256];
+        int rc = LSL_loadHSL(NULL, buf, 255);
+        if (rc) {
+          std::string errmsg;
+          errmsg = "Selected linear system scaling method MC19 not available.\n";
+          errmsg += buf;
+          THROW_EXCEPTION(OPTION_INVALID, errmsg.c_str());
         }
+      }
 # else
-        THROW_EXCEPTION(OPTION_INVALID, "Support for MC19 has not been compiled into Ipopt.");
+      THROW_EXCEPTION(OPTION_INVALID, "Support for MC19 has not been compiled into Ipopt.");
 # endif
 #else
-        ScalingMethod = new Mc19TSymScalingMethod();
+      ScalingMethod = new Mc19TSymScalingMethod();
 #endif
 
-      }
-      else if (linear_system_scaling=="slack-based") {
-        ScalingMethod = new SlackBasedTSymScalingMethod();
-      }
+    }
+    else if (linear_system_scaling=="slack-based") {
+      ScalingMethod = new SlackBasedTSymScalingMethod();
+    }
 
-      SmartPtr<SymLinearSolver> ScaledSolver =
-        new TSymLinearSolver(SolverInterface, ScalingMethod);
+    return new TSymLinearSolver(SolverInterface, ScalingMethod);
+  }
+
+  SmartPtr<AugSystemSolver>
+  AlgorithmBuilder::AugSystemSolverFactory(const Journalist& jnlst,
+      const OptionsList& options,
+      const std::string& prefix)
+  {
+    std::string linear_solver;
+    options.GetStringValue("linear_solver", linear_solver, prefix);
 
+    SmartPtr<AugSystemSolver> AugSolver;
+    if (linear_solver=="custom") {
+      ASSERT_EXCEPTION(IsValid(custom_solver_), OPTION_INVALID,
+                       "Selected linear solver CUSTOM not available.");
+      AugSolver = custom_solver_;
+    }
+    else {
+      SmartPtr<SymLinearSolver> ScaledSolver =
+        SymLinearSolverFactory(jnlst, options, prefix);
       AugSolver = new StdAugSystemSolver(*ScaledSolver);
     }
 
@@ -560,6 +592,37 @@ namespace Ipopt
       }
     }
 
+    return AugSolver;
+  }
+
+  SmartPtr<IpoptAlgorithm>
+  AlgorithmBuilder::BuildBasicAlgorithm(const Journalist& jnlst,
+                                        const OptionsList& options,
+                                        const std::string& prefix)
+  {
+    DBG_START_FUN("AlgorithmBuilder::BuildBasicAlgorithm",
+                  dbg_verbosity);
+
+    bool mehrotra_algorithm;
+    options.GetBoolValue("mehrotra_algorithm", mehrotra_algorithm, prefix);
+
+    Index enum_int;
+    options.GetEnumValue("hessian_approximation", enum_int, prefix);
+    HessianApproximationType hessian_approximation =
+      HessianApproximationType(enum_int);
+    // Hessian-vector products can only be used by the iterative
+    // linear solvers of the inexact algorithm
+    ASSERT_EXCEPTION(hessian_approximation!=EXACT_PRODUCT, OPTION_INVALID,
+                     "hessian_approximation=exact-product can only be used with the inexact algorithm (inexact_algorithm=yes).");
+
+    // Create the convergence check
+    SmartPtr<ConvergenceCheck> convCheck =
+      new OptimalityErrorConvergenceCheck();
+
+    // Create the solvers that will be used by the main algorithm
+    SmartPtr<AugSystemSolver> AugSolver =
+      AugSystemSolverFactory(jnlst, options, prefix);
+
     SmartPtr<PDPerturbationHandler> pertHandler;
     std::string lsmethod;
     options.GetStringValue("line_search_method", lsmethod, prefix);
@@ -572,17 +635,32 @@ namespace Ipopt
     SmartPtr<PDSystemSolver> PDSolver =
       new PDFullSpaceSolver(*AugSolver, *pertHandler);
 
+    // Create the solver for the least-square systems of the
+    // multiplier estimates and the iterate initialization.  If
+    // requested, this is a second instance of the linear solver, so
+    // that its factorization does not replace the one of the Newton
+    // system.
+    SmartPtr<AugSystemSolver> LSqAugSolver = AugSolver;
+    bool separate_least_square_solver;
+    options.GetBoolValue("separate_least_square_solver",
+                         separate_least_square_solver, prefix);
+    std::string linear_solver;
+    options.GetStringValue("linear_solver", linear_solver, prefix);
+    if (separate_least_square_solver && linear_solver!="custom") {
+      LSqAugSolver = AugSystemSolverFactory(jnlst, options, prefix);
+    }
+
     // Create the object for initializing the iterates Initialization
     // object.  We include both the warm start and the defaut
     // initializer, so that the warm start options can be activated
     // without having to rebuild the algorithm
     SmartPtr<EqMultiplierCalculator> EqMultCalculator =
-      new LeastSquareMultipliers(*AugSolver);
+      new LeastSquareMultipliers(*LSqAugSolver);
     SmartPtr<IterateInitializer> WarmStartInitializer =
       new WarmStartIterateInitializer();
     SmartPtr<IterateInitializer> IterInitializer =
       new DefaultIterateInitializer(EqMultCalculator, WarmStartInitializer,
-                                    AugSolver);
+                                    LSqAugSolver);
 
     SmartPtr<RestorationPhase> resto_phase;
     SmartPtr<RestoConvergenceCheck> resto_convCheck;
@@ -683,8 +761,12 @@ namespace Ipopt
       }
 
       // Initialization of the iterates for the restoration phase
+      SmartPtr<AugSystemSolver> resto_LSqAugSolver = resto_AugSolver;
+      if (GetRawPtr(LSqAugSolver) != GetRawPtr(AugSolver)) {
+        resto_LSqAugSolver = new AugRestoSystemSolver(*LSqAugSolver);
+      }
       SmartPtr<EqMultiplierCalculator> resto_EqMultCalculator =
-        new LeastSquareMultipliers(*resto_AugSolver);
+        new LeastSquareMultipliers(*resto_LSqAugSolver);
       SmartPtr<IterateInitializer> resto_IterInitializer =
         new RestoIterateInitializer(resto_EqMultCalculator);
 
@@ -704,6 +786,10 @@ namespace Ipopt
         // ToDo This needs to be replaced!
         resto_HessUpdater  = new LimMemQuasiNewtonUpdater(true);
         break;
+      case EXACT_PRODUCT:
+        // excluded above
+        DBG_ASSERT(false && "exact-product Hessian in standard algorithm");
+        break;
       }
 
       // Put together the overall restoration phase IP algorithm
@@ -830,6 +916,10 @@ namespace Ipopt
       // ToDo This needs to be replaced!
       HessUpdater  = new LimMemQuasiNewtonUpdater(false);
       break;
+    case EXACT_PRODUCT:
+      // excluded above
+      DBG_ASSERT(false && "exact-product Hessian in standard algorithm");
+      break;
     }
 
     // Create the main algorithm
@@ -56,6 +56,21 @@ namespace Ipopt
     virtual SmartPtr<IpoptAlgorithm> BuildBasicAlgorithm(const Journalist& jnlst,
         const OptionsList& options,
         const std::string& prefix);
+
+    /** Create a solver for symmetric linear systems, as selected by
+     *  the linear_solver and linear_system_scaling options. */
+    virtual SmartPtr<SymLinearSolver> SymLinearSolverFactory(const Journalist& jnlst,
+        const OptionsList& options,
+        const std::string& prefix);
+
+    /** Create a solver for the augmented system.  This is the custom
+     *  solver given in the constructor if linear_solver=custom, and
+     *  otherwise a new instance of the selected linear solver.  For
+     *  a limited-memory Hessian approximation, the solver is wrapped
+     *  by the selected low-rank augmented system solver. */
+    virtual SmartPtr<AugSystemSolver> AugSystemSolverFactory(const Journalist& jnlst,
+        const OptionsList& options,
+        const std::string& prefix);
     //@}
 
     /** Methods for IpoptTypeInfo */
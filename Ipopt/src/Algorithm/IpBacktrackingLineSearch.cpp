@@ -12,6 +12,7 @@
 #include "IpJournalist.hpp"
 #include "IpRestoPhase.hpp"
 #include "IpAlgTypes.hpp"
+#include "IpTraceRecorder.hpp"
 
 #ifdef HAVE_CMATH
 # include <cmath>
@@ -59,6 +60,18 @@ namespace Ipopt
       0.0, true, 1.0, true, 0.5,
       "At every step of the backtracking line search, the trial step size is "
       "reduced by this factor.");
+    roptions->AddLowerBoundedIntegerOption(
+      "line_search_trial_batch_size",
+      "Number of trial step sizes that are evaluated together in the backtracking line search.",
+      1, 1,
+      "If this is larger than 1, the objective function and the constraints "
+      "are evaluated at the trial points of this number of successive step "
+      "sizes with one call of the NLP, before the first of them is checked. "
+      "This reduces the wall clock time if the function evaluations are "
+      "expensive and the TNLP evaluates several points in parallel (see the "
+      "eval_f_g_batch method of the TNLP and the option "
+      "\"evaluation_threads\").  The evaluations at the smaller step "
+      "sizes are wasted if a larger step size is accepted.");
 
     std::string prev_category = roptions->RegisteringCategory();
     roptions->SetRegisteringCategory("Undocumented");
@@ -204,6 +217,8 @@ namespace Ipopt
       const std::string& prefix)
   {
     options.GetNumericValue("alpha_red_factor", alpha_red_factor_, prefix);
+    options.GetIntegerValue("line_search_trial_batch_size", trial_batch_size_,
+                            prefix);
     options.GetBoolValue("magic_steps", magic_steps_, prefix);
     options.GetBoolValue("accept_every_trial_step", accept_every_trial_step_, prefix);
     options.GetIntegerValue("accept_after_max_steps", accept_after_max_steps_, prefix);
@@ -688,11 +703,19 @@ namespace Ipopt
     }
 
     if (!accept) {
+      // Trial values of x for the next step sizes, if several trial
+      // points are evaluated together
+      bool batch_trials = (trial_batch_size_ > 1 && !in_watchdog_ &&
+                           !magic_steps_ && !accept_every_trial_step_);
+      std::vector<SmartPtr<const Vector> > trial_x;
+      Index next_trial_x = 0;
+
       // Loop over decreaseing step sizes until acceptable point is
       // found or until step size becomes too small
 
       while (alpha_primal>alpha_min ||
              n_steps == 0 ) {
+        IP_TRACE_SCOPE("LineSearchTrial");
         // always allow the "full" step if it is
         // acceptable (even if alpha_primal<=alpha_min)
         Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
@@ -701,7 +724,21 @@ namespace Ipopt
 
         try {
           // Compute the primal trial point
-          IpData().SetTrialPrimalVariablesFromStep(alpha_primal, *actual_delta->x(), *actual_delta->s());
+          if (batch_trials) {
+            if (next_trial_x == (Index)trial_x.size()) {
+              PrefetchTrialPoints(alpha_primal, alpha_min,
+                                  *actual_delta->x(), trial_x);
+              next_trial_x = 0;
+            }
+            SmartPtr<Vector> trial_s = IpData().curr()->s()->MakeNew();
+            trial_s->AddTwoVectors(1., *IpData().curr()->s(),
+                                   alpha_primal, *actual_delta->s(), 0.);
+            IpData().SetTrialPrimalVariables(*trial_x[next_trial_x++],
+                                             *trial_s);
+          }
+          else {
+            IpData().SetTrialPrimalVariablesFromStep(alpha_primal, *actual_delta->x(), *actual_delta->s());
+          }
 
           if (magic_steps_) {
             PerformMagicStep();
@@ -770,6 +807,13 @@ namespace Ipopt
           }
         }
 
+        // Do not try shorter steps if the deadline for the wallclock
+        // time has passed
+        if (IpData().WallTimeDeadlineReached()) {
+          THROW_EXCEPTION(WALLTIME_DEADLINE_REACHED,
+                          "Wallclock time deadline reached during the line search.");
+        }
+
         // Point is not yet acceptable, try a shorter one
         alpha_primal *= alpha_red_factor_;
         n_steps++;
@@ -796,6 +840,32 @@ namespace Ipopt
     return accept;
   }
 
+  void BacktrackingLineSearch::PrefetchTrialPoints(Number alpha_primal,
+      Number alpha_min,
+      const Vector& delta_x,
+      std::vector<SmartPtr<const Vector> >& trial_x)
+  {
+    DBG_START_METH("BacktrackingLineSearch::PrefetchTrialPoints",
+                   dbg_verbosity);
+    trial_x.clear();
+    const Vector& curr_x = *IpData().curr()->x();
+    Number alpha = alpha_primal;
+    for (Index i=0; i<trial_batch_size_; i++) {
+      if (i > 0 && alpha <= alpha_min) {
+        break;
+      }
+      SmartPtr<Vector> x = curr_x.MakeNew();
+      x->AddTwoVectors(1., curr_x, alpha, delta_x, 0.);
+      trial_x.push_back(ConstPtr(x));
+      alpha *= alpha_red_factor_;
+    }
+
+    Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
+                   "Evaluating %d trial points together\n",
+                   (Index)trial_x.size());
+    IpNLP().Prefetch_f_c_d(trial_x);
+  }
+
   void BacktrackingLineSearch::StartWatchDog()
   {
     DBG_START_FUN("BacktrackingLineSearch::StartWatchDog", dbg_verbosity);
@@ -200,6 +200,15 @@ namespace Ipopt
      *  violation. */
     void PerformMagicStep();
 
+    /** Compute the trial values of x for the step size alpha_primal
+     *  and the next smaller step sizes (at most
+     *  line_search_trial_batch_size, and none below alpha_min except
+     *  for the first), and have the NLP evaluate the objective and
+     *  constraints at these points together. */
+    void PrefetchTrialPoints(Number alpha_primal, Number alpha_min,
+                             const Vector& delta_x,
+                             std::vector<SmartPtr<const Vector> >& trial_x);
+
     /** Detect if the search direction is too small.  This should be
      *  true if the search direction is so small that if makes
      *  numerically no difference. */
@@ -224,6 +233,9 @@ namespace Ipopt
      *  point is rejected. */
     Number alpha_red_factor_;
 
+    /** Number of trial step sizes evaluated together. */
+    Index trial_batch_size_;
+
     /** enumeration for the different alpha_for_y_ settings */
     enum AlphaForYEnum
     {
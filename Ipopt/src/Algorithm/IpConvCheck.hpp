@@ -38,6 +38,7 @@ namespace Ipopt
       CONVERGED_TO_ACCEPTABLE_POINT,
       MAXITER_EXCEEDED,
       CPUTIME_EXCEEDED,
+      WALLTIME_EXCEEDED,
       DIVERGING,
       USER_STOP,
       FAILED
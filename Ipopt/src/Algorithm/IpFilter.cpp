@@ -20,7 +20,7 @@ namespace Ipopt
   //                            Filter entries                             //
   ///////////////////////////////////////////////////////////////////////////
 
-  FilterEntry::FilterEntry(std::vector<Number> vals, Index iter)
+  FilterEntry::FilterEntry(const std::vector<Number>& vals, Index iter)
       :
       vals_(vals),
       iter_(iter)
@@ -38,10 +38,13 @@ namespace Ipopt
       dim_(dim)
   {}
 
-  bool Filter::Acceptable(std::vector<Number> vals) const
+  bool Filter::Acceptable(const std::vector<Number>& vals) const
   {
     DBG_START_METH("FilterLineSearch::Filter::Acceptable", dbg_verbosity);
     DBG_ASSERT((Index)vals.size()==dim_);
+    if (dim_ == 2) {
+      return Acceptable(vals[0], vals[1]);
+    }
     bool acceptable = true;
     std::list<FilterEntry*>::iterator iter;
     for (iter = filter_list_.begin(); iter != filter_list_.end();
@@ -54,10 +57,14 @@ namespace Ipopt
     return acceptable;
   }
 
-  void Filter::AddEntry(std::vector<Number> vals, Index iteration)
+  void Filter::AddEntry(const std::vector<Number>& vals, Index iteration)
   {
     DBG_START_METH("FilterLineSearch::Filter::AddEntry", dbg_verbosity);
     DBG_ASSERT((Index)vals.size()==dim_);
+    if (dim_ == 2) {
+      AddEntry(vals[0], vals[1], iteration);
+      return;
+    }
     std::list<FilterEntry*>::iterator iter;
     iter = filter_list_.begin();
     while (iter != filter_list_.end()) {
@@ -76,6 +83,83 @@ namespace Ipopt
     filter_list_.push_back(new_entry);
   }
 
+  std::vector<Filter::Entry2D>::size_type
+  Filter::LowerBound2D(Number val1) const
+  {
+    std::vector<Entry2D>::size_type first = 0;
+    std::vector<Entry2D>::size_type count = entries_2d_.size();
+    while (count > 0) {
+      std::vector<Entry2D>::size_type step = count/2;
+      if (entries_2d_[first+step].val1 < val1) {
+        first += step+1;
+        count -= step+1;
+      }
+      else {
+        count = step;
+      }
+    }
+    return first;
+  }
+
+  bool Filter::Acceptable(Number val1, Number val2) const
+  {
+    DBG_START_METH("FilterLineSearch::Filter::Acceptable", dbg_verbosity);
+    DBG_ASSERT(dim_==2);
+    if (entries_2d_.empty()) {
+      return true;
+    }
+    // A point with a NaN coordinate is not acceptable, as for the
+    // comparisons in FilterEntry::Acceptable
+    if (val1 != val1 || val2 != val2) {
+      return false;
+    }
+    // The point is not acceptable if it is larger in both coordinates
+    // than one entry.  Among the entries with a smaller first
+    // coordinate, the last one has the smallest second coordinate.
+    std::vector<Entry2D>::size_type pos = LowerBound2D(val1);
+    return pos == 0 || val2 <= entries_2d_[pos-1].val2;
+  }
+
+  void Filter::AddEntry(Number val1, Number val2, Index iteration)
+  {
+    DBG_START_METH("FilterLineSearch::Filter::AddEntry", dbg_verbosity);
+    DBG_ASSERT(dim_==2);
+    std::vector<Entry2D>::size_type first = LowerBound2D(val1);
+
+    // Check if the new entry is dominated by an existing entry; then
+    // it does not change the filter
+    std::vector<Entry2D>::size_type pos = first;
+    if (pos < entries_2d_.size() && entries_2d_[pos].val1 == val1) {
+      pos++;
+    }
+    if (pos > 0 && entries_2d_[pos-1].val2 <= val2) {
+      Entry2D& entry = entries_2d_[pos-1];
+      if (entry.val1 == val1 && entry.val2 == val2) {
+        entry.iter = iteration;
+      }
+      return;
+    }
+
+    // Entries dominated by the new entry follow it directly
+    std::vector<Entry2D>::size_type last = first;
+    while (last < entries_2d_.size() && entries_2d_[last].val2 >= val2) {
+      last++;
+    }
+
+    Entry2D new_entry;
+    new_entry.val1 = val1;
+    new_entry.val2 = val2;
+    new_entry.iter = iteration;
+    if (last > first) {
+      entries_2d_[first] = new_entry;
+      entries_2d_.erase(entries_2d_.begin()+first+1,
+                        entries_2d_.begin()+last);
+    }
+    else {
+      entries_2d_.insert(entries_2d_.begin()+first, new_entry);
+    }
+  }
+
   void Filter::Clear()
   {
     DBG_START_METH("FilterLineSearch::Filter::Clear", dbg_verbosity);
@@ -84,11 +168,29 @@ namespace Ipopt
       filter_list_.pop_back();
       delete entry;
     }
+    entries_2d_.clear();
   }
 
   void Filter::Print(const Journalist& jnlst)
   {
     DBG_START_METH("FilterLineSearch::Filter::Print", dbg_verbosity);
+    if (dim_ == 2) {
+      jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
+                   "The current filter has %d entries.\n", entries_2d_.size());
+      if (!jnlst.ProduceOutput(J_VECTOR, J_LINE_SEARCH)) {
+        return;
+      }
+      for (std::vector<Entry2D>::size_type i=0; i<entries_2d_.size(); i++) {
+        if (i % 10 == 0) {
+          jnlst.Printf(J_VECTOR, J_LINE_SEARCH,
+                       "                phi                    theta            iter\n");
+        }
+        jnlst.Printf(J_VECTOR, J_LINE_SEARCH, "%5d %23.16e %23.16e %5d\n",
+                     (Index)i+1, entries_2d_[i].val1, entries_2d_[i].val2,
+                     entries_2d_[i].iter);
+      }
+      return;
+    }
     jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
                  "The current filter has %d entries.\n", filter_list_.size());
     if (!jnlst.ProduceOutput(J_VECTOR, J_LINE_SEARCH)) {
@@ -24,7 +24,7 @@ namespace Ipopt
     /**@name Constructors/Destructors */
     //@{
     /** Constructor with the two components and the current iteration count */
-    FilterEntry(std::vector<Number> vals, Index iter);
+    FilterEntry(const std::vector<Number>& vals, Index iter);
 
     /** Default Destructor */
     ~FilterEntry();
@@ -33,7 +33,7 @@ namespace Ipopt
     /** Check acceptability of pair (phi,theta) with respect
      *  to this filter entry.  Returns true, if pair is acceptable.
      */
-    bool Acceptable(std::vector<Number> vals) const
+    bool Acceptable(const std::vector<Number>& vals) const
     {
       Index ncoor = (Index)vals_.size();
       DBG_ASSERT((Index)vals.size() == ncoor);
@@ -53,7 +53,7 @@ namespace Ipopt
     /** Check if this entry is dominated by given coordinates.
      *  Returns true, if this entry is dominated.
      */
-    bool Dominated(std::vector<Number> vals) const
+    bool Dominated(const std::vector<Number>& vals) const
     {
       Index ncoor = (Index)vals_.size();
       DBG_ASSERT((Index)vals.size() == ncoor);
@@ -107,7 +107,14 @@ namespace Ipopt
 
   /** Class for the filter.  This class contains all filter entries.
    *  The entries are stored as the corner point, including the
-   *  margin. */
+   *  margin.
+   *
+   *  For a 2-dimensional filter, only the entries that are not
+   *  dominated by another entry are kept (entries that are dominated
+   *  cannot make a point unacceptable).  They are stored in a vector
+   *  sorted by increasing first coordinate, so that the second
+   *  coordinate is decreasing, and acceptability is checked by a
+   *  binary search without creating temporary objects. */
   class Filter
   {
   public:
@@ -126,31 +133,17 @@ namespace Ipopt
     /** Check acceptability of given coordinates with respect
      *  to the filter.  Returns true, if pair is acceptable
      */
-    bool Acceptable(std::vector<Number> vals) const;
+    bool Acceptable(const std::vector<Number>& vals) const;
 
     /** Add filter entry for given coordinates.  This will also
      *  delete all dominated entries in the current filter. */
-    void AddEntry(std::vector<Number> vals, Index iteration);
+    void AddEntry(const std::vector<Number>& vals, Index iteration);
 
-    /** @name Wrappers for 2-dimensional filter. */
+    /** @name Methods for 2-dimensional filter. */
     //@{
-    bool Acceptable(Number val1, Number val2) const
-    {
-      std::vector<Number> vals(2);
-      vals[0] = val1;
-      vals[1] = val2;
-
-      return Acceptable(vals);
-    }
-
-    void AddEntry(Number val1, Number val2, Index iteration)
-    {
-      std::vector<Number> vals(2);
-      vals[0] = val1;
-      vals[1] = val2;
+    bool Acceptable(Number val1, Number val2) const;
 
-      AddEntry(vals, iteration);
-    }
+    void AddEntry(Number val1, Number val2, Index iteration);
     //@}
 
     /** Delete all filter entries */
@@ -180,8 +173,24 @@ namespace Ipopt
     /** Dimension of the filter (number of coordinates per entry) */
     Index dim_;
 
-    /** List storing the filter entries */
+    /** List storing the filter entries (if dim_ is not 2) */
     mutable std::list<FilterEntry*> filter_list_;
+
+    /** One entry of the 2-dimensional filter */
+    struct Entry2D
+    {
+      Number val1;
+      Number val2;
+      Index iter;
+    };
+
+    /** Entries of the 2-dimensional filter that are not dominated,
+     *  sorted by increasing val1 (and thus decreasing val2) */
+    std::vector<Entry2D> entries_2d_;
+
+    /** Position of the first entry in entries_2d_ with val1 not
+     *  smaller than the given value */
+    std::vector<Entry2D>::size_type LowerBound2D(Number val1) const;
   };
 
 } // namespace Ipopt
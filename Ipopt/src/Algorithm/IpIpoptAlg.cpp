@@ -172,6 +172,7 @@ namespace Ipopt
 
     // Store which linear solver is chosen for later output
     options.GetStringValue("linear_solver", linear_solver_, prefix);
+    options.GetNumericValue("constr_viol_tol", constr_viol_tol_, prefix);
 
     // Read the IpoptAlgorithm options
     // Initialize the Data object
@@ -275,6 +276,7 @@ namespace Ipopt
     }
 
     SolverReturn retval = UNASSIGNED;
+    best_feasible_iterate_ = NULL;
 
     try {
       IpData().TimingStats().InitializeIterates().Start();
@@ -288,11 +290,17 @@ namespace Ipopt
         IpData().TimingStats().PrintProblemStatistics().End();
       }
 
+      PrefetchDerivatives();
+
       IpData().TimingStats().CheckConvergence().Start();
       ConvergenceCheck::ConvergenceStatus conv_status =
         conv_check_->CheckConvergence();
       IpData().TimingStats().CheckConvergence().End();
 
+      if (!isResto) {
+        RememberBestFeasibleIterate();
+      }
+
       // main loop
       while (conv_status == ConvergenceCheck::CONTINUE) {
         // Set the Hessian Matrix
@@ -353,9 +361,15 @@ namespace Ipopt
 
         IpData().Set_iter_count(IpData().iter_count()+1);
 
+        PrefetchDerivatives();
+
         IpData().TimingStats().CheckConvergence().Start();
         conv_status  = conv_check_->CheckConvergence();
         IpData().TimingStats().CheckConvergence().End();
+
+        if (!isResto) {
+          RememberBestFeasibleIterate();
+        }
       }
 
       IpData().TimingStats().OutputIteration().Start();
@@ -383,6 +397,9 @@ namespace Ipopt
       case ConvergenceCheck::CPUTIME_EXCEEDED:
         retval = CPUTIME_EXCEEDED;
         break;
+      case ConvergenceCheck::WALLTIME_EXCEEDED:
+        retval = WALLTIME_EXCEEDED;
+        break;
       case ConvergenceCheck::DIVERGING:
         retval = DIVERGING_ITERATES;
         break;
@@ -434,6 +451,18 @@ namespace Ipopt
       IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
       retval = CPUTIME_EXCEEDED;
     }
+    catch (RESTORATION_WALLTIME_EXCEEDED& exc) {
+      exc.ReportException(Jnlst(), J_MOREDETAILED);
+      IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
+      retval = WALLTIME_EXCEEDED;
+    }
+    catch (WALLTIME_DEADLINE_REACHED& exc) {
+      exc.ReportException(Jnlst(), J_MOREDETAILED);
+      IpData().TimingStats().PDSystemSolverTotal().EndIfStarted();
+      IpData().TimingStats().ComputeSearchDirection().EndIfStarted();
+      IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
+      retval = WALLTIME_EXCEEDED;
+    }
     catch (RESTORATION_USER_STOP& exc) {
       exc.ReportException(Jnlst(), J_MOREDETAILED);
       IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
@@ -468,11 +497,62 @@ namespace Ipopt
       retval = INTERNAL_ERROR;
     }
 
+    if (retval == WALLTIME_EXCEEDED && !isResto) {
+      RestoreBestFeasibleIterate();
+    }
+
     DBG_ASSERT(retval != UNASSIGNED && "Unknown return code in the algorithm");
     IpData().TimingStats().OverallAlgorithm().End();
     return retval;
   }
 
+  void IpoptAlgorithm::PrefetchDerivatives()
+  {
+    DBG_START_METH("IpoptAlgorithm::PrefetchDerivatives", dbg_verbosity);
+    // The derivatives at the new iterate are needed in the
+    // convergence check and for the next search direction.  Give the
+    // NLP the chance to evaluate them concurrently.
+    SmartPtr<const IteratesVector> curr = IpData().curr();
+    IpNLP().Prefetch_derivatives(*curr->x(), *curr->y_c(), *curr->y_d());
+  }
+
+  void IpoptAlgorithm::RememberBestFeasibleIterate()
+  {
+    DBG_START_METH("IpoptAlgorithm::RememberBestFeasibleIterate",
+                   dbg_verbosity);
+    if (IpData().wall_time_deadline() < 0.) {
+      return;
+    }
+    if (IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX) > constr_viol_tol_) {
+      return;
+    }
+    Number curr_f = IpCq().curr_f();
+    if (IsNull(best_feasible_iterate_) || curr_f < best_feasible_f_) {
+      best_feasible_iterate_ = IpData().curr();
+      best_feasible_f_ = curr_f;
+    }
+  }
+
+  void IpoptAlgorithm::RestoreBestFeasibleIterate()
+  {
+    DBG_START_METH("IpoptAlgorithm::RestoreBestFeasibleIterate",
+                   dbg_verbosity);
+    if (IsNull(best_feasible_iterate_) ||
+        best_feasible_iterate_ == IpData().curr()) {
+      return;
+    }
+    if (IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX) <= constr_viol_tol_ &&
+        IpCq().curr_f() <= best_feasible_f_) {
+      return;
+    }
+    Jnlst().Printf(J_DETAILED, J_MAIN,
+                   "Returning the best feasible iterate with objective %e.\n",
+                   best_feasible_f_);
+    SmartPtr<IteratesVector> best = best_feasible_iterate_->MakeNewContainer();
+    IpData().set_trial(best);
+    IpData().AcceptTrialPoint();
+  }
+
   void IpoptAlgorithm::UpdateHessian()
   {
     Jnlst().Printf(J_DETAILED, J_MAIN, "\n**************************************************\n");
@@ -123,6 +123,11 @@ namespace Ipopt
 
     /** @name Main steps of the algorthim */
     //@{
+    /** Method for letting the NLP evaluate the derivatives at a new
+     *  iterate together, before they are needed one by one.
+     */
+    void PrefetchDerivatives();
+
     /** Method for updating the current Hessian.  This can either just
      *  evaluate the exact Hessian (based on the current iterate), or
      *  perform a quasi-Newton update.
@@ -163,6 +168,23 @@ namespace Ipopt
 
     /** Compute the Lagrangian multipliers for a feasibility problem*/
     void ComputeFeasibilityMultipliers();
+
+    /** Remember the current iterate if it is feasible and has a
+     *  smaller objective function value than the feasible iterates
+     *  seen before.  This is only done if there is a deadline for the
+     *  wallclock time. */
+    void RememberBestFeasibleIterate();
+
+    /** Make the remembered feasible iterate the current one, unless
+     *  the current iterate is feasible and not worse */
+    void RestoreBestFeasibleIterate();
+    //@}
+
+    /** @name Best feasible iterate, returned if the deadline for the
+     *  wallclock time is reached */
+    //@{
+    SmartPtr<const IteratesVector> best_feasible_iterate_;
+    Number best_feasible_f_;
     //@}
 
     /** @name internal flags */
@@ -190,6 +212,9 @@ namespace Ipopt
     bool mehrotra_algorithm_;
     /** String specifying linear solver */
     std::string linear_solver_;
+    /** Tolerance for the (unscaled) constraint violation of an
+     *  iterate that is considered feasible */
+    Number constr_viol_tol_;
     //@}
 
     /** @name auxiliary functions */
@@ -546,12 +546,12 @@ namespace Ipopt
     Number result;
     SmartPtr<const Vector> x = ip_data_->curr()->x();
     DBG_PRINT_VECTOR(2,"curr_x",*x);
-    DBG_PRINT((1, "curr_x tag = %u\n", x->GetTag()));
+    DBG_PRINT((1, "curr_x tag = %llu\n", x->GetTag()));
 
     bool objective_depends_on_mu = ip_nlp_->objective_depends_on_mu();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     if (objective_depends_on_mu) {
       sdeps[0] = ip_data_->curr_mu();
     }
@@ -559,8 +559,8 @@ namespace Ipopt
       sdeps[0] = -1.;
     }
 
-    if (!curr_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!trial_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
+      if (!trial_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
         DBG_PRINT((2,"evaluate curr f\n"));
         if (objective_depends_on_mu) {
           result = ip_nlp_->f(*x, ip_data_->curr_mu());
@@ -569,7 +569,7 @@ namespace Ipopt
           result = ip_nlp_->f(*x);
         }
       }
-      curr_f_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_f_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
     DBG_PRINT((1,"result (curr_f) = %e\n", result));
     return result;
@@ -589,12 +589,12 @@ namespace Ipopt
     Number result;
     SmartPtr<const Vector> x = ip_data_->trial()->x();
     DBG_PRINT_VECTOR(2,"trial_x",*x);
-    DBG_PRINT((1, "trial_x tag = %u\n", x->GetTag()));
+    DBG_PRINT((1, "trial_x tag = %llu\n", x->GetTag()));
 
     bool objective_depends_on_mu = ip_nlp_->objective_depends_on_mu();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     if (objective_depends_on_mu) {
       sdeps[0] = ip_data_->curr_mu();
     }
@@ -602,8 +602,8 @@ namespace Ipopt
       sdeps[0] = -1.;
     }
 
-    if (!trial_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!curr_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!trial_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
+      if (!curr_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
         DBG_PRINT((2,"evaluate trial f\n"));
         if (objective_depends_on_mu) {
           result = ip_nlp_->f(*x, ip_data_->curr_mu());
@@ -612,7 +612,7 @@ namespace Ipopt
           result = ip_nlp_->f(*x);
         }
       }
-      trial_f_cache_.AddCachedResult(result, tdeps, sdeps);
+      trial_f_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
     DBG_PRINT((1,"result (trial_f) = %e\n", result));
     return result;
@@ -633,9 +633,9 @@ namespace Ipopt
     SmartPtr<const Vector> x = ip_data_->curr()->x();
 
     bool objective_depends_on_mu = ip_nlp_->objective_depends_on_mu();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     if (objective_depends_on_mu) {
       sdeps[0] = ip_data_->curr_mu();
     }
@@ -643,8 +643,8 @@ namespace Ipopt
       sdeps[0] = -1.;
     }
 
-    if (!curr_grad_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!trial_grad_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_grad_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
+      if (!trial_grad_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
         if (objective_depends_on_mu) {
           result = ip_nlp_->grad_f(*x, ip_data_->curr_mu());
         }
@@ -652,7 +652,7 @@ namespace Ipopt
           result = ip_nlp_->grad_f(*x);
         }
       }
-      curr_grad_f_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_grad_f_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -666,9 +666,9 @@ namespace Ipopt
     SmartPtr<const Vector> x = ip_data_->trial()->x();
 
     bool objective_depends_on_mu = ip_nlp_->objective_depends_on_mu();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     if (objective_depends_on_mu) {
       sdeps[0] = ip_data_->curr_mu();
     }
@@ -676,8 +676,8 @@ namespace Ipopt
       sdeps[0] = -1.;
     }
 
-    if (!trial_grad_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!curr_grad_f_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!trial_grad_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
+      if (!curr_grad_f_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
         if (objective_depends_on_mu) {
           result = ip_nlp_->grad_f(*x, ip_data_->curr_mu());
         }
@@ -685,7 +685,7 @@ namespace Ipopt
           result = ip_nlp_->grad_f(*x);
         }
       }
-      trial_grad_f_cache_.AddCachedResult(result, tdeps, sdeps);
+      trial_grad_f_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -761,17 +761,17 @@ namespace Ipopt
     SmartPtr<const Vector> s = ip_data_->curr()->s();
     DBG_PRINT_VECTOR(2,"curr_x",*x);
     DBG_PRINT_VECTOR(2,"curr_s",*s);
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
 
     Number mu = ip_data_->curr_mu();
     DBG_PRINT((1,"curr_mu=%e\n",mu));
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_barrier_obj_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!trial_barrier_obj_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_barrier_obj_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
+      if (!trial_barrier_obj_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
         result = curr_f();
         DBG_PRINT((1,"curr_F=%e\n",result));
         result += CalcBarrierTerm(mu,
@@ -780,7 +780,7 @@ namespace Ipopt
                                   *curr_slack_s_L(),
                                   *curr_slack_s_U());
       }
-      curr_barrier_obj_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_barrier_obj_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     DBG_ASSERT(IsFiniteNumber(result));
     return result;
@@ -797,17 +797,17 @@ namespace Ipopt
     SmartPtr<const Vector> s = ip_data_->trial()->s();
     DBG_PRINT_VECTOR(2,"trial_x",*x);
     DBG_PRINT_VECTOR(2,"trial_s",*s);
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
 
     Number mu = ip_data_->curr_mu();
     DBG_PRINT((1,"trial_mu=%e\n",mu));
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!trial_barrier_obj_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!curr_barrier_obj_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!trial_barrier_obj_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
+      if (!curr_barrier_obj_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
         result = trial_f();
         DBG_PRINT((1,"trial_F=%e\n",result));
         DBG_PRINT_VECTOR(2, "trial_slack_s_U", *trial_slack_s_U());
@@ -817,7 +817,7 @@ namespace Ipopt
                                   *trial_slack_s_L(),
                                   *trial_slack_s_U());
       }
-      trial_barrier_obj_cache_.AddCachedResult(result, tdeps, sdeps);
+      trial_barrier_obj_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     DBG_ASSERT(IsFiniteNumber(result));
     return result;
@@ -832,14 +832,14 @@ namespace Ipopt
     SmartPtr<const Vector> result;
 
     SmartPtr<const Vector> x = ip_data_->curr()->x();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(x);
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
     DBG_PRINT((1,"curr_mu=%e\n",mu));
 
-    if (!curr_grad_barrier_obj_x_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_grad_barrier_obj_x_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp1 = x->MakeNew();
       tmp1->Copy(*curr_grad_f());
 
@@ -869,7 +869,7 @@ namespace Ipopt
 
       result = ConstPtr(tmp1);
 
-      curr_grad_barrier_obj_x_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_grad_barrier_obj_x_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
 
     return result;
@@ -884,12 +884,12 @@ namespace Ipopt
     SmartPtr<const Vector> result;
     SmartPtr<const Vector> x = ip_data_->curr()->x();
 
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(ip_nlp_->Px_L());
     tdeps[1] = GetRawPtr(ip_nlp_->Px_U());
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = kappa_d_;
-    if (!grad_kappa_times_damping_x_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!grad_kappa_times_damping_x_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp1 = x->MakeNew();
       if (kappa_d_>0.) {
         SmartPtr<const Vector> dampind_x_L;
@@ -906,7 +906,7 @@ namespace Ipopt
       }
       result = ConstPtr(tmp1);
 
-      grad_kappa_times_damping_x_cache_.AddCachedResult(result, tdeps, sdeps);
+      grad_kappa_times_damping_x_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
 
     return result;
@@ -921,14 +921,14 @@ namespace Ipopt
     SmartPtr<const Vector> result;
 
     SmartPtr<const Vector> s = ip_data_->curr()->s();
-    std::vector<const TaggedObject*> tdeps(1);
+    const TaggedObject* tdeps[1];
     tdeps[0] = GetRawPtr(s);
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
     DBG_PRINT((1,"curr_mu=%e\n",mu));
 
-    if (!curr_grad_barrier_obj_s_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_grad_barrier_obj_s_cache_.GetCachedResult(result, 1, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp1 = s->MakeNew();
 
       Tmp_s_L().Set(-mu);
@@ -959,7 +959,7 @@ namespace Ipopt
 
       result = ConstPtr(tmp1);
 
-      curr_grad_barrier_obj_s_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_grad_barrier_obj_s_cache_.AddCachedResult(result, 1, tdeps, 1, sdeps);
     }
 
     return result;
@@ -974,12 +974,12 @@ namespace Ipopt
     SmartPtr<const Vector> result;
     SmartPtr<const Vector> s = ip_data_->curr()->s();
 
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(ip_nlp_->Pd_L());
     tdeps[1] = GetRawPtr(ip_nlp_->Pd_U());
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = kappa_d_;
-    if (!grad_kappa_times_damping_s_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!grad_kappa_times_damping_s_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp1 = s->MakeNew();
       if (kappa_d_>0.) {
         SmartPtr<const Vector> dampind_x_L;
@@ -996,7 +996,7 @@ namespace Ipopt
       }
       result = ConstPtr(tmp1);
 
-      grad_kappa_times_damping_s_cache_.AddCachedResult(result, tdeps, sdeps);
+      grad_kappa_times_damping_s_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
 
     return result;
@@ -1432,12 +1432,12 @@ namespace Ipopt
 
     SmartPtr<const Vector> x = ip_data_->curr()->x();
 
-    std::vector<const TaggedObject*> deps(1);
+    const TaggedObject* deps[1];
     deps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!curr_nlp_constraint_violation_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_nlp_constraint_violation_cache_.GetCachedResult(result, 1, deps, 1, sdeps)) {
       SmartPtr<const Vector> c = curr_c();
       SmartPtr<const Vector> d = curr_d();
 
@@ -1460,7 +1460,7 @@ namespace Ipopt
       vecs[1] = GetRawPtr(d_viol_L);
       vecs[2] = GetRawPtr(d_viol_U);
       result = CalcNormOfType(NormType, vecs);
-      curr_nlp_constraint_violation_cache_.AddCachedResult(result, deps, sdeps);
+      curr_nlp_constraint_violation_cache_.AddCachedResult(result, 1, deps, 1, sdeps);
     }
 
     return result;
@@ -1476,13 +1476,13 @@ namespace Ipopt
 
     SmartPtr<const Vector> x = ip_data_->curr()->x();
 
-    std::vector<const TaggedObject*> deps(1);
+    const TaggedObject* deps[1];
     deps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!unscaled_curr_nlp_constraint_violation_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!unscaled_trial_nlp_constraint_violation_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!unscaled_curr_nlp_constraint_violation_cache_.GetCachedResult(result, 1, deps, 1, sdeps)) {
+      if (!unscaled_trial_nlp_constraint_violation_cache_.GetCachedResult(result, 1, deps, 1, sdeps)) {
         SmartPtr<const Vector> c = unscaled_curr_c();
 
         SmartPtr<const Vector> d = curr_d();
@@ -1519,7 +1519,7 @@ namespace Ipopt
         vecs[2] = GetRawPtr(d_viol_U);
         result = CalcNormOfType(NormType, vecs);
       }
-      unscaled_curr_nlp_constraint_violation_cache_.AddCachedResult(result, deps, sdeps);
+      unscaled_curr_nlp_constraint_violation_cache_.AddCachedResult(result, 1, deps, 1, sdeps);
     }
 
     return result;
@@ -1535,13 +1535,13 @@ namespace Ipopt
 
     SmartPtr<const Vector> x = ip_data_->trial()->x();
 
-    std::vector<const TaggedObject*> deps(1);
+    const TaggedObject* deps[1];
     deps[0] = GetRawPtr(x);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!unscaled_trial_nlp_constraint_violation_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!unscaled_curr_nlp_constraint_violation_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!unscaled_trial_nlp_constraint_violation_cache_.GetCachedResult(result, 1, deps, 1, sdeps)) {
+      if (!unscaled_curr_nlp_constraint_violation_cache_.GetCachedResult(result, 1, deps, 1, sdeps)) {
         SmartPtr<const Vector> c = unscaled_trial_c();
 
         SmartPtr<const Vector> d = trial_d();
@@ -1578,7 +1578,7 @@ namespace Ipopt
         vecs[2] = GetRawPtr(d_viol_U);
         result = CalcNormOfType(NormType, vecs);
       }
-      unscaled_trial_nlp_constraint_violation_cache_.AddCachedResult(result, deps, sdeps);
+      unscaled_trial_nlp_constraint_violation_cache_.AddCachedResult(result, 1, deps, 1, sdeps);
     }
 
     return result;
@@ -1600,11 +1600,11 @@ namespace Ipopt
     SmartPtr<const Vector> y_d = ip_data_->curr()->y_d();
 
     bool objective_depends_on_mu = ip_nlp_->objective_depends_on_mu();
-    std::vector<const TaggedObject*> tdeps(3);
+    const TaggedObject* tdeps[3];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(y_c);
     tdeps[2] = GetRawPtr(y_d);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     if (objective_depends_on_mu) {
       sdeps[0] = ip_data_->curr_mu();
     }
@@ -1612,14 +1612,14 @@ namespace Ipopt
       sdeps[0] = -1.;
     }
 
-    if (!curr_exact_hessian_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_exact_hessian_cache_.GetCachedResult(result, 3, tdeps, 1, sdeps)) {
       if (objective_depends_on_mu) {
         result = ip_nlp_->h(*x, 1.0, *y_c, *y_d, ip_data_->curr_mu());
       }
       else {
         result = ip_nlp_->h(*x, 1.0, *y_c, *y_d);
       }
-      curr_exact_hessian_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_exact_hessian_cache_.AddCachedResult(result, 3, tdeps, 1, sdeps);
     }
 
     return result;
@@ -1642,15 +1642,15 @@ namespace Ipopt
     SmartPtr<const Vector> z_L = ip_data_->curr()->z_L();
     SmartPtr<const Vector> z_U = ip_data_->curr()->z_U();
 
-    std::vector<const TaggedObject*> deps(5);
+    const TaggedObject* deps[5];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(y_c);
     deps[2] = GetRawPtr(y_d);
     deps[3] = GetRawPtr(z_L);
     deps[4] = GetRawPtr(z_U);
 
-    if (!curr_grad_lag_x_cache_.GetCachedResult(result, deps)) {
-      if (!trial_grad_lag_x_cache_.GetCachedResult(result, deps)) {
+    if (!curr_grad_lag_x_cache_.GetCachedResult(result, 5, deps, 0, NULL)) {
+      if (!trial_grad_lag_x_cache_.GetCachedResult(result, 5, deps, 0, NULL)) {
         SmartPtr<Vector> tmp = x->MakeNew();
         DBG_PRINT_VECTOR(2,"curr_grad_f",*curr_grad_f());
         tmp->Copy(*curr_grad_f());
@@ -1662,7 +1662,7 @@ namespace Ipopt
         ip_nlp_->Px_U()->MultVector(1., *z_U, 1., *tmp);
         result = ConstPtr(tmp);
       }
-      curr_grad_lag_x_cache_.AddCachedResult(result, deps);
+      curr_grad_lag_x_cache_.AddCachedResult(result, 5, deps, 0, NULL);
     }
 
     return result;
@@ -1681,15 +1681,15 @@ namespace Ipopt
     SmartPtr<const Vector> z_L = ip_data_->trial()->z_L();
     SmartPtr<const Vector> z_U = ip_data_->trial()->z_U();
 
-    std::vector<const TaggedObject*> deps(5);
+    const TaggedObject* deps[5];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(y_c);
     deps[2] = GetRawPtr(y_d);
     deps[3] = GetRawPtr(z_L);
     deps[4] = GetRawPtr(z_U);
 
-    if (!trial_grad_lag_x_cache_.GetCachedResult(result, deps)) {
-      if (!curr_grad_lag_x_cache_.GetCachedResult(result, deps)) {
+    if (!trial_grad_lag_x_cache_.GetCachedResult(result, 5, deps, 0, NULL)) {
+      if (!curr_grad_lag_x_cache_.GetCachedResult(result, 5, deps, 0, NULL)) {
         SmartPtr<Vector> tmp = x->MakeNew();
         DBG_PRINT_VECTOR(2,"trial_grad_f",*trial_grad_f());
         tmp->Copy(*trial_grad_f());
@@ -1699,7 +1699,7 @@ namespace Ipopt
         ip_nlp_->Px_U()->MultVector(1., *z_U, 1., *tmp);
         result = ConstPtr(tmp);
       }
-      trial_grad_lag_x_cache_.AddCachedResult(result, deps);
+      trial_grad_lag_x_cache_.AddCachedResult(result, 5, deps, 0, NULL);
     }
 
     return result;
@@ -1716,20 +1716,20 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> deps(3);
+    const TaggedObject* deps[3];
     deps[0] = GetRawPtr(y_d);
     deps[1] = GetRawPtr(v_L);
     deps[2] = GetRawPtr(v_U);
 
-    if (!curr_grad_lag_s_cache_.GetCachedResult(result, deps)) {
-      if (!trial_grad_lag_s_cache_.GetCachedResult(result, deps)) {
+    if (!curr_grad_lag_s_cache_.GetCachedResult(result, 3, deps, 0, NULL)) {
+      if (!trial_grad_lag_s_cache_.GetCachedResult(result, 3, deps, 0, NULL)) {
         SmartPtr<Vector> tmp = y_d->MakeNew();
         ip_nlp_->Pd_U()->MultVector(1., *v_U, 0., *tmp);
         ip_nlp_->Pd_L()->MultVector(-1., *v_L, 1., *tmp);
         tmp->Axpy(-1., *y_d);
         result = ConstPtr(tmp);
       }
-      curr_grad_lag_s_cache_.AddCachedResult(result, deps);
+      curr_grad_lag_s_cache_.AddCachedResult(result, 3, deps, 0, NULL);
     }
 
     return result;
@@ -1746,20 +1746,20 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->trial()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->trial()->v_U();
 
-    std::vector<const TaggedObject*> deps(3);
+    const TaggedObject* deps[3];
     deps[0] = GetRawPtr(y_d);
     deps[1] = GetRawPtr(v_L);
     deps[2] = GetRawPtr(v_U);
 
-    if (!trial_grad_lag_s_cache_.GetCachedResult(result, deps)) {
-      if (!curr_grad_lag_s_cache_.GetCachedResult(result, deps)) {
+    if (!trial_grad_lag_s_cache_.GetCachedResult(result, 3, deps, 0, NULL)) {
+      if (!curr_grad_lag_s_cache_.GetCachedResult(result, 3, deps, 0, NULL)) {
         SmartPtr<Vector> tmp = y_d->MakeNew();
         ip_nlp_->Pd_U()->MultVector(1., *v_U, 0., *tmp);
         ip_nlp_->Pd_L()->MultVector(-1., *v_L, 1., *tmp);
         tmp->Axpy(-1., *y_d);
         result = ConstPtr(tmp);
       }
-      trial_grad_lag_s_cache_.AddCachedResult(result, deps);
+      trial_grad_lag_s_cache_.AddCachedResult(result, 3, deps, 0, NULL);
     }
 
     return result;
@@ -1786,16 +1786,16 @@ namespace Ipopt
     SmartPtr<const Vector> z_U = ip_data_->curr()->z_U();
     Number mu = ip_data_->curr_mu();
 
-    std::vector<const TaggedObject*> deps(5);
+    const TaggedObject* deps[5];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(y_c);
     deps[2] = GetRawPtr(y_d);
     deps[3] = GetRawPtr(z_L);
     deps[4] = GetRawPtr(z_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_grad_lag_with_damping_x_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_grad_lag_with_damping_x_cache_.GetCachedResult(result, 5, deps, 1, sdeps)) {
       SmartPtr<Vector> tmp = x->MakeNew();
       tmp->Copy(*curr_grad_lag_x());
 
@@ -1809,7 +1809,7 @@ namespace Ipopt
       ip_nlp_->Px_U()->MultVector(-kappa_d_*mu, *dampind_x_U, 1., *tmp);
 
       result = ConstPtr(tmp);
-      curr_grad_lag_with_damping_x_cache_.AddCachedResult(result, deps, sdeps);
+      curr_grad_lag_with_damping_x_cache_.AddCachedResult(result, 5, deps, 1, sdeps);
     }
 
     return result;
@@ -1834,14 +1834,14 @@ namespace Ipopt
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
     Number mu = ip_data_->curr_mu();
 
-    std::vector<const TaggedObject*> deps(3);
+    const TaggedObject* deps[3];
     deps[0] = GetRawPtr(y_d);
     deps[1] = GetRawPtr(v_L);
     deps[2] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_grad_lag_with_damping_s_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_grad_lag_with_damping_s_cache_.GetCachedResult(result, 3, deps, 1, sdeps)) {
       SmartPtr<Vector> tmp = y_d->MakeNew();
       tmp->Copy(*curr_grad_lag_s());
 
@@ -1855,7 +1855,7 @@ namespace Ipopt
       ip_nlp_->Pd_U()->MultVector(-kappa_d_*mu, *dampind_s_U, 1., *tmp);
 
       result = ConstPtr(tmp);
-      curr_grad_lag_with_damping_s_cache_.AddCachedResult(result, deps, sdeps);
+      curr_grad_lag_with_damping_s_cache_.AddCachedResult(result, 3, deps, 1, sdeps);
     }
 
     return result;
@@ -2038,20 +2038,20 @@ namespace Ipopt
 
     SmartPtr<const Vector> slack = curr_slack_x_L();
     SmartPtr<const Vector> mult = ip_data_->curr()->z_L();
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(slack);
     tdeps[1] = GetRawPtr(mult);
 
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_relaxed_compl_x_L_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_relaxed_compl_x_L_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp = slack->MakeNew();
       tmp->Copy(*curr_compl_x_L());
       tmp->AddScalar(-mu);
       result = ConstPtr(tmp);
-      curr_relaxed_compl_x_L_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_relaxed_compl_x_L_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -2065,20 +2065,20 @@ namespace Ipopt
 
     SmartPtr<const Vector> slack = curr_slack_x_U();
     SmartPtr<const Vector> mult = ip_data_->curr()->z_U();
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(slack);
     tdeps[1] = GetRawPtr(mult);
 
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_relaxed_compl_x_U_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_relaxed_compl_x_U_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp = slack->MakeNew();
       tmp->Copy(*curr_compl_x_U());
       tmp->AddScalar(-mu);
       result = ConstPtr(tmp);
-      curr_relaxed_compl_x_U_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_relaxed_compl_x_U_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -2092,20 +2092,20 @@ namespace Ipopt
 
     SmartPtr<const Vector> slack = curr_slack_s_L();
     SmartPtr<const Vector> mult = ip_data_->curr()->v_L();
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(slack);
     tdeps[1] = GetRawPtr(mult);
 
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_relaxed_compl_s_L_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_relaxed_compl_s_L_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp = slack->MakeNew();
       tmp->Copy(*curr_compl_s_L());
       tmp->AddScalar(-mu);
       result = ConstPtr(tmp);
-      curr_relaxed_compl_s_L_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_relaxed_compl_s_L_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -2119,20 +2119,20 @@ namespace Ipopt
 
     SmartPtr<const Vector> slack = curr_slack_s_U();
     SmartPtr<const Vector> mult = ip_data_->curr()->v_U();
-    std::vector<const TaggedObject*> tdeps(2);
+    const TaggedObject* tdeps[2];
     tdeps[0] = GetRawPtr(slack);
     tdeps[1] = GetRawPtr(mult);
 
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_relaxed_compl_s_U_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_relaxed_compl_s_U_cache_.GetCachedResult(result, 2, tdeps, 1, sdeps)) {
       SmartPtr<Vector> tmp = slack->MakeNew();
       tmp->Copy(*curr_compl_s_U());
       tmp->AddScalar(-mu);
       result = ConstPtr(tmp);
-      curr_relaxed_compl_s_U_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_relaxed_compl_s_U_cache_.AddCachedResult(result, 2, tdeps, 1, sdeps);
     }
     return result;
   }
@@ -2202,14 +2202,14 @@ namespace Ipopt
     DBG_PRINT_VECTOR(2, "s to eval", *s);
     DBG_PRINT((1,"NormType = %d\n", NormType))
 
-    std::vector<const TaggedObject*> deps(2);
+    const TaggedObject* deps[2];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!curr_primal_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!trial_primal_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_primal_infeasibility_cache_.GetCachedResult(result, 2, deps, 1, sdeps)) {
+      if (!trial_primal_infeasibility_cache_.GetCachedResult(result, 2, deps, 1, sdeps)) {
         DBG_PRINT((1,"Recomputing recomputing infeasibility.\n"));
         SmartPtr<const Vector> c = curr_c();
         SmartPtr<const Vector> d_minus_s = curr_d_minus_s();
@@ -2220,7 +2220,7 @@ namespace Ipopt
         result = CalcNormOfType(NormType, *c, *d_minus_s);
 
       }
-      curr_primal_infeasibility_cache_.AddCachedResult(result, deps, sdeps);
+      curr_primal_infeasibility_cache_.AddCachedResult(result, 2, deps, 1, sdeps);
     }
 
     DBG_PRINT((1,"result = %e\n",result));
@@ -2242,14 +2242,14 @@ namespace Ipopt
     DBG_PRINT_VECTOR(2, "s to eval", *s);
     DBG_PRINT((1,"NormType = %d\n", NormType))
 
-    std::vector<const TaggedObject*> deps(2);
+    const TaggedObject* deps[2];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!trial_primal_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!curr_primal_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!trial_primal_infeasibility_cache_.GetCachedResult(result, 2, deps, 1, sdeps)) {
+      if (!curr_primal_infeasibility_cache_.GetCachedResult(result, 2, deps, 1, sdeps)) {
         DBG_PRINT((1,"Recomputing recomputing infeasibility.\n"));
         SmartPtr<const Vector> c = trial_c();
         SmartPtr<const Vector> d_minus_s = trial_d_minus_s();
@@ -2259,7 +2259,7 @@ namespace Ipopt
 
         result = CalcNormOfType(NormType, *c, *d_minus_s);
       }
-      trial_primal_infeasibility_cache_.AddCachedResult(result, deps, sdeps);
+      trial_primal_infeasibility_cache_.AddCachedResult(result, 2, deps, 1, sdeps);
     }
 
     DBG_PRINT((1,"result = %e\n",result));
@@ -2283,7 +2283,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> deps(8);
+    const TaggedObject* deps[8];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
     deps[2] = GetRawPtr(y_c);
@@ -2292,11 +2292,11 @@ namespace Ipopt
     deps[5] = GetRawPtr(z_U);
     deps[6] = GetRawPtr(v_L);
     deps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!curr_dual_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!trial_dual_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_dual_infeasibility_cache_.GetCachedResult(result, 8, deps, 1, sdeps)) {
+      if (!trial_dual_infeasibility_cache_.GetCachedResult(result, 8, deps, 1, sdeps)) {
         SmartPtr<const Vector> grad_lag_x = curr_grad_lag_x();
         SmartPtr<const Vector> grad_lag_s = curr_grad_lag_s();
         DBG_PRINT_VECTOR(2,"grad_lag_x", *grad_lag_x);
@@ -2304,7 +2304,7 @@ namespace Ipopt
 
         result = CalcNormOfType(NormType, *grad_lag_x, *grad_lag_s);
       }
-      curr_dual_infeasibility_cache_.AddCachedResult(result, deps, sdeps);
+      curr_dual_infeasibility_cache_.AddCachedResult(result, 8, deps, 1, sdeps);
     }
 
     return result;
@@ -2327,7 +2327,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->trial()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->trial()->v_U();
 
-    std::vector<const TaggedObject*> deps(8);
+    const TaggedObject* deps[8];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
     deps[2] = GetRawPtr(y_c);
@@ -2336,11 +2336,11 @@ namespace Ipopt
     deps[5] = GetRawPtr(z_U);
     deps[6] = GetRawPtr(v_L);
     deps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!trial_dual_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!curr_dual_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!trial_dual_infeasibility_cache_.GetCachedResult(result, 8, deps, 1, sdeps)) {
+      if (!curr_dual_infeasibility_cache_.GetCachedResult(result, 8, deps, 1, sdeps)) {
         SmartPtr<const Vector> grad_lag_x = trial_grad_lag_x();
         SmartPtr<const Vector> grad_lag_s = trial_grad_lag_s();
         DBG_PRINT_VECTOR(2,"grad_lag_x", *grad_lag_x);
@@ -2349,7 +2349,7 @@ namespace Ipopt
         result = CalcNormOfType(NormType, *grad_lag_x, *grad_lag_s);
 
       }
-      trial_dual_infeasibility_cache_.AddCachedResult(result, deps, sdeps);
+      trial_dual_infeasibility_cache_.AddCachedResult(result, 8, deps, 1, sdeps);
     }
 
     return result;
@@ -2372,7 +2372,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> deps(8);
+    const TaggedObject* deps[8];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
     deps[2] = GetRawPtr(y_c);
@@ -2381,10 +2381,10 @@ namespace Ipopt
     deps[5] = GetRawPtr(z_U);
     deps[6] = GetRawPtr(v_L);
     deps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = (Number)NormType;
 
-    if (!unscaled_curr_dual_infeasibility_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!unscaled_curr_dual_infeasibility_cache_.GetCachedResult(result, 8, deps, 1, sdeps)) {
       SmartPtr<const Vector> grad_lag_x =
         ip_nlp_->NLP_scaling()->unapply_grad_obj_scaling(curr_grad_lag_x());
 
@@ -2401,7 +2401,7 @@ namespace Ipopt
       }
 
       result = CalcNormOfType(NormType, *grad_lag_x, *grad_lag_s);
-      unscaled_curr_dual_infeasibility_cache_.AddCachedResult(result, deps, sdeps);
+      unscaled_curr_dual_infeasibility_cache_.AddCachedResult(result, 8, deps, 1, sdeps);
     }
 
     return result;
@@ -2422,19 +2422,19 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> deps(6);
+    const TaggedObject* deps[6];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
     deps[2] = GetRawPtr(z_L);
     deps[3] = GetRawPtr(z_U);
     deps[4] = GetRawPtr(v_L);
     deps[5] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(2);
+    Number sdeps[2];
     sdeps[0] = (Number)NormType;
     sdeps[1] = mu;
 
-    if (!curr_complementarity_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!trial_complementarity_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!curr_complementarity_cache_.GetCachedResult(result, 6, deps, 2, sdeps)) {
+      if (!trial_complementarity_cache_.GetCachedResult(result, 6, deps, 2, sdeps)) {
 
         std::vector<SmartPtr<const Vector> > vecs(4);
         SmartPtr<const Vector> compl_x_L = curr_compl_x_L();
@@ -2470,7 +2470,7 @@ namespace Ipopt
         result = CalcNormOfType(NormType, vecs);
       }
 
-      curr_complementarity_cache_.AddCachedResult(result, deps, sdeps);
+      curr_complementarity_cache_.AddCachedResult(result, 6, deps, 2, sdeps);
     }
 
     return result;
@@ -2491,19 +2491,19 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->trial()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->trial()->v_U();
 
-    std::vector<const TaggedObject*> deps(6);
+    const TaggedObject* deps[6];
     deps[0] = GetRawPtr(x);
     deps[1] = GetRawPtr(s);
     deps[2] = GetRawPtr(z_L);
     deps[3] = GetRawPtr(z_U);
     deps[4] = GetRawPtr(v_L);
     deps[5] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(2);
+    Number sdeps[2];
     sdeps[0] = (Number)NormType;
     sdeps[1] = mu;
 
-    if (!trial_complementarity_cache_.GetCachedResult(result, deps, sdeps)) {
-      if (!curr_complementarity_cache_.GetCachedResult(result, deps, sdeps)) {
+    if (!trial_complementarity_cache_.GetCachedResult(result, 6, deps, 2, sdeps)) {
+      if (!curr_complementarity_cache_.GetCachedResult(result, 6, deps, 2, sdeps)) {
 
         std::vector<SmartPtr<const Vector> > vecs(4);
         SmartPtr<const Vector> compl_x_L = trial_compl_x_L();
@@ -2539,7 +2539,7 @@ namespace Ipopt
         result = CalcNormOfType(NormType, vecs);
       }
 
-      trial_complementarity_cache_.AddCachedResult(result, deps, sdeps);
+      trial_complementarity_cache_.AddCachedResult(result, 6, deps, 2, sdeps);
     }
 
     return result;
@@ -2646,7 +2646,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(6);
+    const TaggedObject* tdeps[6];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(z_L);
@@ -2654,7 +2654,7 @@ namespace Ipopt
     tdeps[4] = GetRawPtr(v_L);
     tdeps[5] = GetRawPtr(v_U);
 
-    if (!curr_centrality_measure_cache_.GetCachedResult(result, tdeps)) {
+    if (!curr_centrality_measure_cache_.GetCachedResult(result, 6, tdeps, 0, NULL)) {
       SmartPtr<const Vector> compl_x_L = curr_compl_x_L();
       SmartPtr<const Vector> compl_x_U = curr_compl_x_U();
       SmartPtr<const Vector> compl_s_L = curr_compl_s_L();
@@ -2663,7 +2663,7 @@ namespace Ipopt
       result = CalcCentralityMeasure(*compl_x_L, *compl_x_U,
                                      *compl_s_L, *compl_s_U);
 
-      curr_centrality_measure_cache_.AddCachedResult(result, tdeps);
+      curr_centrality_measure_cache_.AddCachedResult(result, 6, tdeps, 0, NULL);
     }
     return result;
   }
@@ -2685,7 +2685,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(y_c);
@@ -2695,7 +2695,7 @@ namespace Ipopt
     tdeps[6] = GetRawPtr(v_L);
     tdeps[7] = GetRawPtr(v_U);
 
-    if (!curr_nlp_error_cache_.GetCachedResult(result, tdeps)) {
+    if (!curr_nlp_error_cache_.GetCachedResult(result, 8, tdeps, 0, NULL)) {
       if (ip_data_->curr()->x()->Dim()==ip_data_->curr()->y_c()->Dim()) {
         // This is a square problem, we only need to consider the
         // infeasibility
@@ -2728,7 +2728,7 @@ namespace Ipopt
         result = Max(result, curr_complementarity(mu_target_, NORM_MAX)/s_c);
       }
 
-      curr_nlp_error_cache_.AddCachedResult(result, tdeps);
+      curr_nlp_error_cache_.AddCachedResult(result, 8, tdeps, 0, NULL);
     }
 
     return result;
@@ -2751,7 +2751,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(y_c);
@@ -2761,7 +2761,7 @@ namespace Ipopt
     tdeps[6] = GetRawPtr(v_L);
     tdeps[7] = GetRawPtr(v_U);
 
-    if (!unscaled_curr_nlp_error_cache_.GetCachedResult(result, tdeps)) {
+    if (!unscaled_curr_nlp_error_cache_.GetCachedResult(result, 8, tdeps, 0, NULL)) {
 
       // Dual infeasibility
       result = unscaled_curr_dual_infeasibility(NORM_MAX);
@@ -2772,7 +2772,7 @@ namespace Ipopt
                  curr_complementarity(mu_target_, NORM_MAX)));
       result = Max(result, unscaled_curr_complementarity(mu_target_, NORM_MAX));
 
-      unscaled_curr_nlp_error_cache_.AddCachedResult(result, tdeps);
+      unscaled_curr_nlp_error_cache_.AddCachedResult(result, 8, tdeps, 0, NULL);
     }
 
     return result;
@@ -2796,7 +2796,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
     Number mu = ip_data_->curr_mu();
 
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(y_c);
@@ -2805,10 +2805,10 @@ namespace Ipopt
     tdeps[5] = GetRawPtr(z_U);
     tdeps[6] = GetRawPtr(v_L);
     tdeps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_barrier_error_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_barrier_error_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
       Number s_d = 0;
       Number s_c = 0;
       ComputeOptimalityErrorScaling(*ip_data_->curr()->y_c(), *ip_data_->curr()->y_d(),
@@ -2825,7 +2825,7 @@ namespace Ipopt
       // Complementarity
       result = Max(result, curr_complementarity(mu, NORM_MAX)/s_c);
 
-      curr_barrier_error_cache_.AddCachedResult(result, tdeps);
+      curr_barrier_error_cache_.AddCachedResult(result, 8, tdeps, 1, sdeps);
     }
 
     return result;
@@ -2848,7 +2848,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(y_c);
@@ -2857,11 +2857,11 @@ namespace Ipopt
     tdeps[5] = GetRawPtr(z_U);
     tdeps[6] = GetRawPtr(v_L);
     tdeps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!curr_primal_dual_system_error_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!trial_primal_dual_system_error_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_primal_dual_system_error_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
+      if (!trial_primal_dual_system_error_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
         // For now we use the 1 norm, and scale each component by the number of entries...
         Index n_dual = x->Dim() + s->Dim();
         Number dual_inf = curr_dual_infeasibility(NORM_1)/((Number)n_dual);
@@ -2880,7 +2880,7 @@ namespace Ipopt
 
         result = dual_inf + primal_inf + cmpl;
       }
-      curr_primal_dual_system_error_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_primal_dual_system_error_cache_.AddCachedResult(result, 8, tdeps, 1, sdeps);
     }
 
     return result;
@@ -2903,7 +2903,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->trial()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->trial()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(y_c);
@@ -2912,11 +2912,11 @@ namespace Ipopt
     tdeps[5] = GetRawPtr(z_U);
     tdeps[6] = GetRawPtr(v_L);
     tdeps[7] = GetRawPtr(v_U);
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
 
-    if (!trial_primal_dual_system_error_cache_.GetCachedResult(result, tdeps, sdeps)) {
-      if (!curr_primal_dual_system_error_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!trial_primal_dual_system_error_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
+      if (!curr_primal_dual_system_error_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
         // For now we use the 1 norm, and scale each component by the number of entries...
         Index n_dual = x->Dim() + s->Dim();
         Number dual_inf = trial_dual_infeasibility(NORM_1)/((Number)n_dual);
@@ -2935,7 +2935,7 @@ namespace Ipopt
 
         result = dual_inf + primal_inf + cmpl;
       }
-      trial_primal_dual_system_error_cache_.AddCachedResult(result, tdeps, sdeps);
+      trial_primal_dual_system_error_cache_.AddCachedResult(result, 8, tdeps, 1, sdeps);
     }
 
     return result;
@@ -2987,16 +2987,16 @@ namespace Ipopt
     Number result;
     SmartPtr<const Vector> x = ip_data_->curr()->x();
     SmartPtr<const Vector> s = ip_data_->curr()->s();
-    std::vector<const TaggedObject*> tdeps(4);
+    const TaggedObject* tdeps[4];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = &delta_x;
     tdeps[3] = &delta_s;
 
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = tau;
 
-    if (!primal_frac_to_the_bound_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!primal_frac_to_the_bound_cache_.GetCachedResult(result, 4, tdeps, 1, sdeps)) {
       result = Min(CalcFracToBound(*curr_slack_x_L(), Tmp_x_L(), *ip_nlp_->Px_L(),
                                    *curr_slack_x_U(), Tmp_x_U(), *ip_nlp_->Px_U(),
                                    delta_x, tau),
@@ -3004,7 +3004,7 @@ namespace Ipopt
                                    *curr_slack_s_U(), Tmp_s_U(), *ip_nlp_->Pd_U(),
                                    delta_s, tau));
 
-      primal_frac_to_the_bound_cache_.AddCachedResult(result, tdeps, sdeps);
+      primal_frac_to_the_bound_cache_.AddCachedResult(result, 4, tdeps, 1, sdeps);
     }
 
     return result;
@@ -3055,7 +3055,7 @@ namespace Ipopt
     SmartPtr<const Vector> z_U = ip_data_->curr()->z_U();
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
-    std::vector<const TaggedObject*> tdeps(8);
+    const TaggedObject* tdeps[8];
     tdeps[0] = GetRawPtr(z_L);
     tdeps[1] = GetRawPtr(z_U);
     tdeps[2] = GetRawPtr(v_L);
@@ -3065,16 +3065,16 @@ namespace Ipopt
     tdeps[6] = &delta_v_L;
     tdeps[7] = &delta_v_U;
 
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = tau;
 
-    if (!dual_frac_to_the_bound_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!dual_frac_to_the_bound_cache_.GetCachedResult(result, 8, tdeps, 1, sdeps)) {
       result = z_L->FracToBound(delta_z_L, tau);
       result = Min(result, z_U->FracToBound(delta_z_U, tau));
       result = Min(result, v_L->FracToBound(delta_v_L, tau));
       result = Min(result, v_U->FracToBound(delta_v_U, tau));
 
-      dual_frac_to_the_bound_cache_.AddCachedResult(result, tdeps, sdeps);
+      dual_frac_to_the_bound_cache_.AddCachedResult(result, 8, tdeps, 1, sdeps);
     }
 
     return result;
@@ -3187,7 +3187,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->curr()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->curr()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(6);
+    const TaggedObject* tdeps[6];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(z_L);
@@ -3195,8 +3195,8 @@ namespace Ipopt
     tdeps[4] = GetRawPtr(v_L);
     tdeps[5] = GetRawPtr(v_U);
 
-    if (!curr_avrg_compl_cache_.GetCachedResult(result, tdeps)) {
-      if (!trial_avrg_compl_cache_.GetCachedResult(result, tdeps)) {
+    if (!curr_avrg_compl_cache_.GetCachedResult(result, 6, tdeps, 0, NULL)) {
+      if (!trial_avrg_compl_cache_.GetCachedResult(result, 6, tdeps, 0, NULL)) {
 
         SmartPtr<const Vector> slack_x_L = curr_slack_x_L();
         SmartPtr<const Vector> slack_x_U = curr_slack_x_U();
@@ -3218,7 +3218,7 @@ namespace Ipopt
         }
       }
 
-      curr_avrg_compl_cache_.AddCachedResult(result, tdeps);
+      curr_avrg_compl_cache_.AddCachedResult(result, 6, tdeps, 0, NULL);
     }
 
     return result;
@@ -3239,7 +3239,7 @@ namespace Ipopt
     SmartPtr<const Vector> v_L = ip_data_->trial()->v_L();
     SmartPtr<const Vector> v_U = ip_data_->trial()->v_U();
 
-    std::vector<const TaggedObject*> tdeps(6);
+    const TaggedObject* tdeps[6];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(z_L);
@@ -3247,8 +3247,8 @@ namespace Ipopt
     tdeps[4] = GetRawPtr(v_L);
     tdeps[5] = GetRawPtr(v_U);
 
-    if (!trial_avrg_compl_cache_.GetCachedResult(result, tdeps)) {
-      if (!curr_avrg_compl_cache_.GetCachedResult(result, tdeps)) {
+    if (!trial_avrg_compl_cache_.GetCachedResult(result, 6, tdeps, 0, NULL)) {
+      if (!curr_avrg_compl_cache_.GetCachedResult(result, 6, tdeps, 0, NULL)) {
 
         SmartPtr<const Vector> slack_x_L = trial_slack_x_L();
         SmartPtr<const Vector> slack_x_U = trial_slack_x_U();
@@ -3270,7 +3270,7 @@ namespace Ipopt
         }
       }
 
-      trial_avrg_compl_cache_.AddCachedResult(result, tdeps);
+      trial_avrg_compl_cache_.AddCachedResult(result, 6, tdeps, 0, NULL);
     }
 
     return result;
@@ -3316,21 +3316,21 @@ namespace Ipopt
     SmartPtr<const Vector> s = ip_data_->curr()->s();
     SmartPtr<const Vector> delta_x = ip_data_->delta()->x();
     SmartPtr<const Vector> delta_s = ip_data_->delta()->s();
-    std::vector<const TaggedObject*> tdeps(4);
+    const TaggedObject* tdeps[4];
     tdeps[0] = GetRawPtr(x);
     tdeps[1] = GetRawPtr(s);
     tdeps[2] = GetRawPtr(delta_x);
     tdeps[3] = GetRawPtr(delta_s);
     Number mu = ip_data_->curr_mu();
-    std::vector<Number> sdeps(1);
+    Number sdeps[1];
     sdeps[0] = mu;
     DBG_PRINT((1,"curr_mu=%e\n",mu));
 
-    if (!curr_gradBarrTDelta_cache_.GetCachedResult(result, tdeps, sdeps)) {
+    if (!curr_gradBarrTDelta_cache_.GetCachedResult(result, 4, tdeps, 1, sdeps)) {
       result = curr_grad_barrier_obj_x()->Dot(*delta_x) +
                curr_grad_barrier_obj_s()->Dot(*delta_s);
 
-      curr_gradBarrTDelta_cache_.AddCachedResult(result, tdeps, sdeps);
+      curr_gradBarrTDelta_cache_.AddCachedResult(result, 4, tdeps, 1, sdeps);
     }
     return result;
   }
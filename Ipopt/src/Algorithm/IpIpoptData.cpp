@@ -16,8 +16,12 @@ namespace Ipopt
                        Number cpu_time_start /*= -1.*/)
       :
       cpu_time_start_(cpu_time_start),
-      add_data_(add_data)
-  {}
+      wall_time_deadline_(-1.),
+      add_data_(add_data),
+      lm_sigma_(-1.)
+  {
+    pd_pert_state_.valid = false;
+  }
 
   IpoptData::~IpoptData()
   {}
@@ -76,6 +80,11 @@ namespace Ipopt
     free_mu_mode_ = false;
     tiny_step_flag_ = false;
 
+    pd_pert_state_.valid = false;
+    lm_S_ = NULL;
+    lm_Y_ = NULL;
+    lm_sigma_ = -1.;
+
     info_ls_count_ = 0;
     ResetInfo();
     info_last_output_ = -1.;
@@ -87,6 +96,15 @@ namespace Ipopt
       cpu_time_start_ = CpuTime();
     }
 
+    Number max_wall_time;
+    options.GetNumericValue("max_wall_time", max_wall_time, prefix);
+    if (max_wall_time < 999999.) {
+      wall_time_deadline_ = WallclockTime() + max_wall_time;
+    }
+    else {
+      wall_time_deadline_ = -1.;
+    }
+
     bool retval = true;
 
     if (IsValid(add_data_)) {
@@ -96,6 +114,11 @@ namespace Ipopt
     return retval;
   }
 
+  bool IpoptData::WallTimeDeadlineReached() const
+  {
+    return wall_time_deadline_ >= 0. && WallclockTime() > wall_time_deadline_;
+  }
+
   bool IpoptData::InitializeDataStructures(IpoptNLP& ip_nlp,
       bool want_x,
       bool want_y_c,
@@ -196,6 +219,21 @@ namespace Ipopt
     set_trial(newvec);
   }
 
+  void IpoptData::SetTrialPrimalVariables(const Vector& x, const Vector& s)
+  {
+    DBG_ASSERT(have_prototypes_);
+
+    if (IsNull(trial_)) {
+      trial_ = iterates_space_->MakeNewIteratesVector(false);
+    }
+
+    SmartPtr<IteratesVector> newvec = trial_->MakeNewContainer();
+    newvec->Set_x(x);
+    newvec->Set_s(s);
+
+    set_trial(newvec);
+  }
+
   void IpoptData::SetTrialEqMultipliersFromStep(Number alpha,
       const Vector& delta_y_c,
       const Vector& delta_y_d)
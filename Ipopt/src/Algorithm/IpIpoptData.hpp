@@ -14,6 +14,7 @@
 #include "IpIteratesVector.hpp"
 #include "IpRegOptions.hpp"
 #include "IpTimingStatistics.hpp"
+#include "IpWarmStartSnapshot.hpp"
 
 namespace Ipopt
 {
@@ -143,6 +144,9 @@ namespace Ipopt
     void SetTrialPrimalVariablesFromStep(Number alpha,
                                          const Vector& delta_x,
                                          const Vector& delta_s);
+    /** Set the primal trial variables (x and s) to the given
+     *  vectors. */
+    void SetTrialPrimalVariables(const Vector& x, const Vector& s);
     /** Set the values of the trial values for the equality constraint
      *  multipliers (y_c and y_d) from provided step with step length
      *  alpha.
@@ -375,6 +379,22 @@ namespace Ipopt
       return cpu_time_start_;
     }
 
+    /** @name Deadline for the wallclock time of the optimization run.
+     *  It is set from the option max_wall_time in Initialize.  A
+     *  negative value means that there is no deadline. */
+    //@{
+    Number wall_time_deadline() const
+    {
+      return wall_time_deadline_;
+    }
+    void Set_wall_time_deadline(Number wall_time_deadline)
+    {
+      wall_time_deadline_ = wall_time_deadline;
+    }
+    /** Returns true if there is a deadline and it has passed */
+    bool WallTimeDeadlineReached() const;
+    //@}
+
     /** @name Information gathered for iteration output */
     //@{
     Number info_regu_x() const
@@ -385,6 +405,22 @@ namespace Ipopt
     {
       info_regu_x_ = regu_x;
     }
+    Number info_regu_c() const
+    {
+      return info_regu_c_;
+    }
+    void Set_info_regu_c(Number regu_c)
+    {
+      info_regu_c_ = regu_c;
+    }
+    Index info_refinement_steps() const
+    {
+      return info_refinement_steps_;
+    }
+    void Add_info_refinement_steps(Index refinement_steps)
+    {
+      info_refinement_steps_ += refinement_steps;
+    }
     Number info_alpha_primal() const
     {
       return info_alpha_primal_;
@@ -470,6 +506,8 @@ namespace Ipopt
     void ResetInfo()
     {
       info_regu_x_ = 0;
+      info_regu_c_ = 0;
+      info_refinement_steps_ = 0;
       info_alpha_primal_ = 0;
       info_alpha_dual_ = 0.;
       info_alpha_primal_char_ = ' ';
@@ -484,6 +522,12 @@ namespace Ipopt
       return timing_statistics_;
     }
 
+    /** Return Timing Statistics Object (const version) */
+    const TimingStatistics& TimingStats() const
+    {
+      return timing_statistics_;
+    }
+
     /** Check if additional data has been set */
     bool HaveAddData()
     {
@@ -523,6 +567,67 @@ namespace Ipopt
       pd_pert_d = pd_pert_d_;
     }
 
+    /** Set the history of the perturbation of the primal-dual
+     *  system, as kept by the PDPerturbationHandler.  This is stored
+     *  in warm start snapshots. */
+    void SetPDPertState(const PDPertHistory& pd_pert_state)
+    {
+      pd_pert_state_ = pd_pert_state;
+    }
+
+    /** Get the history of the perturbation of the primal-dual
+     *  system */
+    const PDPertHistory& PDPertState() const
+    {
+      return pd_pert_state_;
+    }
+
+    /** Set the history of the limited-memory BFGS approximation of
+     *  the Hessian, as kept by the LimMemQuasiNewtonUpdater.  S and
+     *  Y are MultiVectorMatrix objects with the pairs of steps and
+     *  gradient differences, and sigma is the factor of the initial
+     *  matrix.  This is stored in warm start snapshots. */
+    void SetLimMemHistory(const SmartPtr<const Matrix>& S,
+                          const SmartPtr<const Matrix>& Y,
+                          Number sigma)
+    {
+      lm_S_ = S;
+      lm_Y_ = Y;
+      lm_sigma_ = sigma;
+    }
+
+    /** @name Get the history of the limited-memory BFGS
+     *  approximation.  S and Y are NULL if it is not known. */
+    //@{
+    SmartPtr<const Matrix> LimMemS() const
+    {
+      return lm_S_;
+    }
+    SmartPtr<const Matrix> LimMemY() const
+    {
+      return lm_Y_;
+    }
+    Number LimMemSigma() const
+    {
+      return lm_sigma_;
+    }
+    //@}
+
+    /** @name Warm start snapshot.  If a snapshot is set, the warm
+     *  start initialization takes the iterate from it instead of
+     *  from the NLP.  The snapshot is kept for all following
+     *  optimizations until it is set to NULL. */
+    //@{
+    void SetWarmStartSnapshot(const SmartPtr<const WarmStartSnapshot>& snapshot)
+    {
+      warm_start_snapshot_ = snapshot;
+    }
+    SmartPtr<const WarmStartSnapshot> GetWarmStartSnapshot() const
+    {
+      return warm_start_snapshot_;
+    }
+    //@}
+
     /** Methods for IpoptType */
     //@{
     static void RegisterOptions(const SmartPtr<RegisteredOptions>& roptions);
@@ -610,6 +715,11 @@ namespace Ipopt
     //@{
     /** Size of regularization for the Hessian */
     Number info_regu_x_;
+    /** Size of regularization for the constraint Jacobians */
+    Number info_regu_c_;
+    /** Number of iterative refinement steps in the linear system
+     *  solves of this iteration */
+    Index info_refinement_steps_;
     /** Primal step size */
     Number info_alpha_primal_;
     /** Info character for primal step size */
@@ -640,6 +750,9 @@ namespace Ipopt
     /** CPU time counter at initialization. */
     Number cpu_time_start_;
 
+    /** Wallclock time at which the optimization has to stop */
+    Number wall_time_deadline_;
+
     /** Object for the data specific for the Chen-Goldfarb penalty
      *  method algorithm */
     SmartPtr<IpoptAdditionalData> add_data_;
@@ -651,8 +764,20 @@ namespace Ipopt
     Number pd_pert_s_;
     Number pd_pert_c_;
     Number pd_pert_d_;
+    /** History kept by the PDPerturbationHandler */
+    PDPertHistory pd_pert_state_;
+    //@}
+
+    /** @name History of the limited-memory BFGS approximation */
+    //@{
+    SmartPtr<const Matrix> lm_S_;
+    SmartPtr<const Matrix> lm_Y_;
+    Number lm_sigma_;
     //@}
 
+    /** Snapshot used for the warm start initialization */
+    SmartPtr<const WarmStartSnapshot> warm_start_snapshot_;
+
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
      * These methods are not implemented and 
@@ -13,6 +13,8 @@
 #include "IpJournalist.hpp"
 #include "IpNLPScaling.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
   // forward declarations
@@ -105,6 +107,30 @@ namespace Ipopt
                                         const Vector& yd
                                        ) = 0;
 
+    /** Evaluate the objective function and the constraints at
+     *  several points together, so that the values are available
+     *  when f, c, and d are called for these points afterwards.
+     *  Returns false if the values have not been computed; then they
+     *  are computed one by one when they are needed.  The default
+     *  implementation returns false. */
+    virtual bool Prefetch_f_c_d(const std::vector<SmartPtr<const Vector> >& x)
+    {
+      return false;
+    }
+
+    /** Evaluate the gradient of the objective function, the
+     *  constraint Jacobians, and the Hessian of the Lagrangian (with
+     *  obj_factor 1) at a new iterate together, so that they are
+     *  available when grad_f, jac_c, jac_d, and h are called
+     *  afterwards.  Returns false if nothing has been computed.  The
+     *  default implementation returns false. */
+    virtual bool Prefetch_derivatives(const Vector& x,
+                                      const Vector& yc,
+                                      const Vector& yd)
+    {
+      return false;
+    }
+
     /** Lower bounds on x */
     virtual SmartPtr<const Vector> x_L() const = 0;
 
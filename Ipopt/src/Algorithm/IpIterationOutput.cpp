@@ -0,0 +1,136 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpIterationOutput.hpp"
+#include "IpOrigIpoptNLP.hpp"
+
+namespace Ipopt
+{
+
+  /** Columns of the iteration trace */
+  enum TraceColumn
+  {
+    TR_ITER=0,
+    TR_RESTORATION,
+    TR_OBJECTIVE,
+    TR_INF_PR,
+    TR_INF_DU,
+    TR_MU,
+    TR_ALPHA_PR,
+    TR_ALPHA_DU,
+    TR_LS_TRIALS,
+    TR_DELTA_X,
+    TR_DELTA_C,
+    TR_REFINEMENT_STEPS,
+    TR_FACTORIZATIONS,
+    TR_FACTORIZATION_TIME,
+    TR_BACKSOLVES,
+    TR_BACKSOLVE_TIME,
+    TR_F_EVALS,
+    TR_GRAD_F_EVALS,
+    TR_C_EVALS,
+    TR_JAC_C_EVALS,
+    TR_D_EVALS,
+    TR_JAC_D_EVALS,
+    TR_H_EVALS,
+    TR_EVAL_TIME,
+    TR_CPU_TIME,
+    TR_LAST_COLUMN
+  };
+
+  static const char* trace_column_names[TR_LAST_COLUMN] = {
+    "iter",
+    "restoration",
+    "objective",
+    "inf_pr",
+    "inf_du",
+    "mu",
+    "alpha_pr",
+    "alpha_du",
+    "ls_trials",
+    "delta_x",
+    "delta_c",
+    "refinement_steps",
+    "factorizations",
+    "factorization_time",
+    "backsolves",
+    "backsolve_time",
+    "f_evals",
+    "grad_f_evals",
+    "c_evals",
+    "jac_c_evals",
+    "d_evals",
+    "jac_d_evals",
+    "h_evals",
+    "eval_time",
+    "cpu_time"
+  };
+
+  void IterationOutput::InitializeTrace()
+  {
+    trace_jrnl_ = dynamic_cast<TraceJournal*>
+                  (GetRawPtr(Jnlst().FindJournal(TraceJournalName())));
+    if (IsValid(trace_jrnl_)) {
+      trace_jrnl_->SetColumns(TR_LAST_COLUMN, trace_column_names);
+    }
+  }
+
+  void IterationOutput::WriteTraceRecord(bool restoration, Number unscaled_f,
+                                         Number inf_pr, Number inf_du,
+                                         const IpoptNLP& orig_nlp)
+  {
+    if (IsNull(trace_jrnl_)) {
+      return;
+    }
+
+    Number values[TR_LAST_COLUMN];
+    values[TR_ITER] = IpData().iter_count();
+    values[TR_RESTORATION] = restoration ? 1. : 0.;
+    values[TR_OBJECTIVE] = unscaled_f;
+    values[TR_INF_PR] = inf_pr;
+    values[TR_INF_DU] = inf_du;
+    values[TR_MU] = IpData().curr_mu();
+    values[TR_ALPHA_PR] = IpData().info_alpha_primal();
+    values[TR_ALPHA_DU] = IpData().info_alpha_dual();
+    values[TR_LS_TRIALS] = IpData().info_ls_count();
+    values[TR_DELTA_X] = IpData().info_regu_x();
+    values[TR_DELTA_C] = IpData().info_regu_c();
+    values[TR_REFINEMENT_STEPS] = IpData().info_refinement_steps();
+
+    TimingStatistics& timing = IpData().TimingStats();
+    values[TR_FACTORIZATIONS] =
+      timing.LinearSystemFactorization().NumberOfCalls();
+    values[TR_FACTORIZATION_TIME] =
+      timing.LinearSystemFactorization().TotalCpuTime();
+    values[TR_BACKSOLVES] = timing.LinearSystemBackSolve().NumberOfCalls();
+    values[TR_BACKSOLVE_TIME] = timing.LinearSystemBackSolve().TotalCpuTime();
+
+    values[TR_F_EVALS] = orig_nlp.f_evals();
+    values[TR_GRAD_F_EVALS] = orig_nlp.grad_f_evals();
+    values[TR_C_EVALS] = orig_nlp.c_evals();
+    values[TR_JAC_C_EVALS] = orig_nlp.jac_c_evals();
+    values[TR_D_EVALS] = orig_nlp.d_evals();
+    values[TR_JAC_D_EVALS] = orig_nlp.jac_d_evals();
+    values[TR_H_EVALS] = orig_nlp.h_evals();
+
+    Number eval_time = 0.;
+    const OrigIpoptNLP* orignlp = dynamic_cast<const OrigIpoptNLP*>(&orig_nlp);
+    if (orignlp) {
+      eval_time = orignlp->f_eval_time().TotalCpuTime() +
+                  orignlp->grad_f_eval_time().TotalCpuTime() +
+                  orignlp->c_eval_time().TotalCpuTime() +
+                  orignlp->jac_c_eval_time().TotalCpuTime() +
+                  orignlp->d_eval_time().TotalCpuTime() +
+                  orignlp->jac_d_eval_time().TotalCpuTime() +
+                  orignlp->h_eval_time().TotalCpuTime();
+    }
+    values[TR_EVAL_TIME] = eval_time;
+    values[TR_CPU_TIME] = CpuTime() - IpData().cpu_time_start();
+
+    trace_jrnl_->WriteRow(values);
+  }
+
+} // namespace Ipopt
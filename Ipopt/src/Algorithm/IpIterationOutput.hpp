@@ -42,6 +42,21 @@ namespace Ipopt
      *  details about the iterates if desired */
     virtual void WriteOutput() = 0;
 
+    /** Do not write records into the iteration trace.  This is used
+     *  for an output object that is called by another one which
+     *  writes the record itself. */
+    void DisableTrace()
+    {
+      trace_jrnl_ = NULL;
+    }
+
+    /** Name of the TraceJournal in the Journalist into which the
+     *  iteration trace is written. */
+    static const char* TraceJournalName()
+    {
+      return "IterationTrace";
+    }
+
   protected:
     /** enumeration for different inf_pr output options */
     enum InfPrOutput
@@ -50,6 +65,28 @@ namespace Ipopt
       ORIGINAL
     };
 
+    /** Look up the TraceJournal for the iteration trace in the
+     *  Journalist.  This is to be called in InitializeImpl. */
+    void InitializeTrace();
+
+    /** Query whether records are written into an iteration trace */
+    bool TraceEnabled() const
+    {
+      return IsValid(trace_jrnl_);
+    }
+
+    /** Write the record for the current iteration into the
+     *  iteration trace, if there is a trace journal.  The values that
+     *  are also printed in the summary line are given as arguments,
+     *  since they are computed differently in the restoration phase.
+     *  The evaluation counts are taken from orig_nlp.  The counts and
+     *  times for the linear solver are the ones for the current
+     *  phase of the algorithm, i.e., they are counted separately in
+     *  the restoration phase. */
+    void WriteTraceRecord(bool restoration, Number unscaled_f,
+                          Number inf_pr, Number inf_du,
+                          const IpoptNLP& orig_nlp);
+
   private:
     /**@name Default Compiler Generated Methods (Hidden to avoid
      * implicit creation/calling).  These methods are not implemented
@@ -64,6 +101,8 @@ namespace Ipopt
     void operator=(const IterationOutput&);
     //@}
 
+    /** Journal for the iteration trace, NULL if no trace is written */
+    SmartPtr<TraceJournal> trace_jrnl_;
   };
 
 } // namespace Ipopt
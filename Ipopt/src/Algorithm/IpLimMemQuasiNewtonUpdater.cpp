@@ -156,6 +156,13 @@ namespace Ipopt
 
     last_eta_ = -1.;
 
+    if (update_for_resto_) {
+      restore_history_ = false;
+    }
+    else {
+      options.GetBoolValue("warm_start_init_point", restore_history_, prefix);
+    }
+
     return true;
   }
 
@@ -261,19 +268,7 @@ namespace Ipopt
       last_jac_c_ = curr_jac_c;
       last_jac_d_ = curr_jac_d;
 
-      curr_lm_memory_ = 0;
-      lm_skipped_iter_ = 0;
-      S_ = NULL;
-      Y_ = NULL;
-      Ypart_ = NULL;
-      D_ = NULL;
-      L_ = NULL;
-      V_ = NULL;
-      U_ = NULL;
-      SdotS_ = NULL;
-      SdotS_uptodate_ = false;
-      STDRS_ = NULL;
-      DRS_ = NULL;
+      ResetHistory();
 
       last_eta_ = -1.;
       if (update_for_resto_ && limited_memory_special_for_resto_) {
@@ -283,7 +278,15 @@ namespace Ipopt
         // Set up W to be multiple of I
         sigma_ = limited_memory_init_val_;
       }
+      // Continue with the history of a warm start snapshot, if one is
+      // given.  This is only done for the first matrix, since the
+      // warm start initialization might still reject the snapshot.
+      if (restore_history_) {
+        RestoreHistory();
+        restore_history_ = false;
+      }
       SetW();
+      StoreHistory();
       return;
     }
 
@@ -459,72 +462,12 @@ namespace Ipopt
             ShiftMultiVector(V_, *v_new);
           }
 
-          // Compute Ltilde = L * diag(D^{-1/2});
-          SmartPtr<DenseVector> Dtilde = D_->MakeNewDenseVector();
-          Dtilde->Copy(*D_);
-          Dtilde->ElementWiseSqrt();
-          Dtilde->ElementWiseReciprocal();
-          SmartPtr<DenseGenMatrix> Ltilde = L_->MakeNewDenseGenMatrix();
-          DBG_PRINT_MATRIX(3, "D", *D_);
-          DBG_PRINT_MATRIX(3, "L", *L_);
-          Ltilde->Copy(*L_);
-          Ltilde->ScaleColumns(*Dtilde);
-          DBG_PRINT_MATRIX(3, "Ltilde", *Ltilde);
-
-          // M = Ltilde * Ltilde^T
-          SmartPtr<DenseSymMatrixSpace> Mspace =
-            new DenseSymMatrixSpace(curr_lm_memory_);
-          SmartPtr<DenseSymMatrix> M = Mspace->MakeNewDenseSymMatrix();
-          M->HighRankUpdate(false, 1., *Ltilde, 0.);
-
-          // M += S^T B_0 S
-          if (!update_for_resto_ ||
-              !limited_memory_special_for_resto_) {
-            // For now, we assume that B_0 is sigma*I
-            DBG_ASSERT(SdotS_uptodate_);
-            DBG_PRINT_MATRIX(3, "SdotS", *SdotS_);
-            M->AddMatrix(sigma_, *SdotS_, 1.);
-          }
-          else {
-            DBG_PRINT_MATRIX(3, "STDRS", *STDRS_);
-            M->AddMatrix(curr_eta_, *STDRS_, 1.);
-          }
-
-          // Compute Cholesky factor J with M = J J^T
-          DBG_PRINT_MATRIX(3, "M", *M);
-          SmartPtr<DenseGenMatrix> J = L_->MakeNewDenseGenMatrix();
-          bool cholesky_retval = J->ComputeCholeskyFactor(*M);
-          DBG_PRINT_MATRIX(3, "J", *J);
-          if (!cholesky_retval) {
+          if (!ComputeBFGSU()) {
             Jnlst().Printf(J_WARNING, J_HESSIAN_APPROXIMATION,
                            "Cholesky factorization failed for LBFGS update! Skipping update.\n");
             skipping = true;
             break;
           }
-
-          // Compute C = J^{-T}
-          SmartPtr<DenseGenMatrix> C = J->MakeNewDenseGenMatrix();
-          C->FillIdentity();
-          J->CholeskyBackSolveMatrix(true, 1., *C);
-
-          // Compute U = B_0 * S * C
-          U_ = S_->MakeNewMultiVectorMatrix();
-          if (!update_for_resto_ ||
-              !limited_memory_special_for_resto_) {
-            DBG_ASSERT(sigma_>0.);
-            U_->AddRightMultMatrix(sigma_, *S_, *C, 0.);
-          }
-          else {
-            DBG_ASSERT(sigma_<0.);
-            U_->AddRightMultMatrix(curr_eta_, *DRS_, *C, 0.);
-          }
-
-          // Compute Lbar = Ltilde^T * C
-          SmartPtr<DenseGenMatrix> Lbar = Ltilde->MakeNewDenseGenMatrix();
-          Lbar->AddMatrixProduct(1., *Ltilde, true, *C, false, 0.);
-
-          // Compute U += V * Lbar;
-          U_->AddRightMultMatrix(1., *V_, *Lbar, 1.);
           break;
         }
       case SR1:
@@ -700,6 +643,8 @@ namespace Ipopt
       last_eta_ = curr_eta_;
       curr_DR_x_ = NULL;
     }
+
+    StoreHistory();
   }
 
   void LimMemQuasiNewtonUpdater::
@@ -1328,6 +1273,167 @@ namespace Ipopt
 
   }
 
+  bool LimMemQuasiNewtonUpdater::ComputeBFGSU()
+  {
+    DBG_START_METH("LimMemQuasiNewtonUpdater::ComputeBFGSU",
+                   dbg_verbosity);
+
+    // Compute Ltilde = L * diag(D^{-1/2});
+    SmartPtr<DenseVector> Dtilde = D_->MakeNewDenseVector();
+    Dtilde->Copy(*D_);
+    Dtilde->ElementWiseSqrt();
+    Dtilde->ElementWiseReciprocal();
+    SmartPtr<DenseGenMatrix> Ltilde = L_->MakeNewDenseGenMatrix();
+    DBG_PRINT_MATRIX(3, "D", *D_);
+    DBG_PRINT_MATRIX(3, "L", *L_);
+    Ltilde->Copy(*L_);
+    Ltilde->ScaleColumns(*Dtilde);
+    DBG_PRINT_MATRIX(3, "Ltilde", *Ltilde);
+
+    // M = Ltilde * Ltilde^T
+    SmartPtr<DenseSymMatrixSpace> Mspace =
+      new DenseSymMatrixSpace(curr_lm_memory_);
+    SmartPtr<DenseSymMatrix> M = Mspace->MakeNewDenseSymMatrix();
+    M->HighRankUpdate(false, 1., *Ltilde, 0.);
+
+    // M += S^T B_0 S
+    if (!update_for_resto_ ||
+        !limited_memory_special_for_resto_) {
+      // For now, we assume that B_0 is sigma*I
+      DBG_ASSERT(SdotS_uptodate_);
+      DBG_PRINT_MATRIX(3, "SdotS", *SdotS_);
+      M->AddMatrix(sigma_, *SdotS_, 1.);
+    }
+    else {
+      DBG_PRINT_MATRIX(3, "STDRS", *STDRS_);
+      M->AddMatrix(curr_eta_, *STDRS_, 1.);
+    }
+
+    // Compute Cholesky factor J with M = J J^T
+    DBG_PRINT_MATRIX(3, "M", *M);
+    SmartPtr<DenseGenMatrix> J = L_->MakeNewDenseGenMatrix();
+    bool cholesky_retval = J->ComputeCholeskyFactor(*M);
+    DBG_PRINT_MATRIX(3, "J", *J);
+    if (!cholesky_retval) {
+      return false;
+    }
+
+    // Compute C = J^{-T}
+    SmartPtr<DenseGenMatrix> C = J->MakeNewDenseGenMatrix();
+    C->FillIdentity();
+    J->CholeskyBackSolveMatrix(true, 1., *C);
+
+    // Compute U = B_0 * S * C
+    U_ = S_->MakeNewMultiVectorMatrix();
+    if (!update_for_resto_ ||
+        !limited_memory_special_for_resto_) {
+      DBG_ASSERT(sigma_>0.);
+      U_->AddRightMultMatrix(sigma_, *S_, *C, 0.);
+    }
+    else {
+      DBG_ASSERT(sigma_<0.);
+      U_->AddRightMultMatrix(curr_eta_, *DRS_, *C, 0.);
+    }
+
+    // Compute Lbar = Ltilde^T * C
+    SmartPtr<DenseGenMatrix> Lbar = Ltilde->MakeNewDenseGenMatrix();
+    Lbar->AddMatrixProduct(1., *Ltilde, true, *C, false, 0.);
+
+    // Compute U += V * Lbar;
+    U_->AddRightMultMatrix(1., *V_, *Lbar, 1.);
+
+    return true;
+  }
+
+  void LimMemQuasiNewtonUpdater::StoreHistory()
+  {
+    if (update_for_resto_ || limited_memory_update_type_ != BFGS) {
+      return;
+    }
+    if (IsValid(S_)) {
+      IpData().SetLimMemHistory(GetRawPtr(S_), GetRawPtr(Y_), sigma_);
+    }
+    else {
+      IpData().SetLimMemHistory(NULL, NULL, sigma_);
+    }
+  }
+
+  void LimMemQuasiNewtonUpdater::RestoreHistory()
+  {
+    DBG_START_METH("LimMemQuasiNewtonUpdater::RestoreHistory",
+                   dbg_verbosity);
+
+    SmartPtr<const WarmStartSnapshot> snapshot =
+      IpData().GetWarmStartSnapshot();
+    if (IsNull(snapshot) || snapshot->LimMemHistoryLength() == 0 ||
+        limited_memory_update_type_ != BFGS ||
+        limited_memory_max_history_ == 0) {
+      return;
+    }
+
+    // Add the pairs one after another, as in UpdateHessian.  If there
+    // are more pairs than limited_memory_max_history, the first ones
+    // are shifted out.
+    SmartPtr<const VectorSpace> LM_vecspace =
+      h_space_->LowRankVectorSpace();
+    bool restored = true;
+    for (Index i=0; i<snapshot->LimMemHistoryLength(); i++) {
+      SmartPtr<Vector> s_new = LM_vecspace->MakeNew();
+      SmartPtr<Vector> y_new = LM_vecspace->MakeNew();
+      if (!snapshot->GetLimMemPair(i, *s_new, *y_new)) {
+        restored = false;
+        break;
+      }
+      Number sTy_new = s_new->Dot(*y_new);
+      if (sTy_new <= 0.) {
+        restored = false;
+        break;
+      }
+      bool augment_memory = UpdateInternalData(*s_new, *y_new, NULL);
+      SmartPtr<Vector> v_new = y_new->MakeNewCopy();
+      v_new->Scal(1./sqrt(sTy_new));
+      if (augment_memory) {
+        AugmentMultiVector(V_, *v_new);
+      }
+      else {
+        ShiftMultiVector(V_, *v_new);
+      }
+    }
+    if (restored) {
+      sigma_ = Max(Min(sigma_safe_max_, snapshot->LimMemSigma()),
+                   sigma_safe_min_);
+      restored = ComputeBFGSU();
+    }
+
+    if (!restored) {
+      Jnlst().Printf(J_DETAILED, J_HESSIAN_APPROXIMATION,
+                     "Limited-memory history of warm start snapshot does not fit; starting with an empty history.\n");
+      ResetHistory();
+      sigma_ = limited_memory_init_val_;
+      return;
+    }
+    Jnlst().Printf(J_DETAILED, J_HESSIAN_APPROXIMATION,
+                   "Continuing with %d pairs of the limited-memory history from warm start snapshot, sigma = %e.\n",
+                   curr_lm_memory_, sigma_);
+  }
+
+  void LimMemQuasiNewtonUpdater::ResetHistory()
+  {
+    curr_lm_memory_ = 0;
+    lm_skipped_iter_ = 0;
+    S_ = NULL;
+    Y_ = NULL;
+    Ypart_ = NULL;
+    D_ = NULL;
+    L_ = NULL;
+    V_ = NULL;
+    U_ = NULL;
+    SdotS_ = NULL;
+    SdotS_uptodate_ = false;
+    STDRS_ = NULL;
+    DRS_ = NULL;
+  }
+
   void LimMemQuasiNewtonUpdater::RecalcY(Number eta, const Vector& DR_x,
                                          MultiVectorMatrix& DRS,
                                          MultiVectorMatrix& Ypart,
@@ -349,8 +349,24 @@ namespace Ipopt
     /** Set the W field in IpData based on the current values of
      *  B0_, V_, and U_ */
     void SetW();
+    /** Compute U_ for the BFGS update from the current values of
+     *  S_, V_, D_, L_, SdotS_, and sigma_.  Returns false if the
+     *  Cholesky factorization of the middle matrix fails. */
+    bool ComputeBFGSU();
+    /** Discard all pairs of the history */
+    void ResetHistory();
+    /** Publish the pairs of the BFGS history in IpoptData, so that
+     *  they can be stored in a warm start snapshot. */
+    void StoreHistory();
+    /** Continue with the pairs of the history of the warm start
+     *  snapshot in IpoptData, if there is one */
+    void RestoreHistory();
     //@}
 
+    /** Flag indicating whether the history of a warm start snapshot
+     *  is to be restored for the first matrix */
+    bool restore_history_;
+
   };
 
 } // namespace Ipopt
@@ -15,6 +15,8 @@
 #include "IpDenseVector.hpp"
 #include "IpZeroMatrix.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 #if COIN_IPOPT_VERBOSITY > 0
@@ -255,6 +257,70 @@ namespace Ipopt
     return retval;
   }
 
+  bool
+  NLPBoundsRemover::Eval_f_c_d_batch(Index n_points,
+                                     const Vector* const* x,
+                                     Number* f,
+                                     Vector* const* c,
+                                     Vector* const* d,
+                                     bool* success)
+  {
+    std::vector<Vector*> d_orig(n_points);
+    for (Index i=0; i<n_points; i++) {
+      CompoundVector* comp_d = static_cast<CompoundVector*>(d[i]);
+      DBG_ASSERT(dynamic_cast<CompoundVector*>(d[i]));
+      d_orig[i] = GetRawPtr(comp_d->GetCompNonConst(0));
+    }
+
+    bool retval = nlp_->Eval_f_c_d_batch(n_points, x, f, c, &d_orig[0],
+                                         success);
+    if (retval) {
+      for (Index i=0; i<n_points; i++) {
+        if (success[i]) {
+          CompoundVector* comp_d = static_cast<CompoundVector*>(d[i]);
+          SmartPtr<Vector> x_L = comp_d->GetCompNonConst(1);
+          SmartPtr<Vector> x_U = comp_d->GetCompNonConst(2);
+          Px_l_orig_->TransMultVector(1., *x[i], 0., *x_L);
+          Px_u_orig_->TransMultVector(1., *x[i], 0., *x_U);
+        }
+      }
+    }
+    return retval;
+  }
+
+  bool
+  NLPBoundsRemover::Eval_derivatives(const Vector& x,
+                                     Vector* g_f,
+                                     Matrix* jac_c,
+                                     Matrix* jac_d,
+                                     Number obj_factor,
+                                     const Vector& yc,
+                                     const Vector& yd,
+                                     SymMatrix* h)
+  {
+    CompoundMatrix* comp_jac_d = NULL;
+    SmartPtr<Matrix> jac_d_orig;
+    if (jac_d) {
+      comp_jac_d = static_cast<CompoundMatrix*>(jac_d);
+      DBG_ASSERT(dynamic_cast<CompoundMatrix*>(jac_d));
+      SmartPtr<const MatrixSpace> jac_d_space = comp_jac_d->OwnerSpace();
+      const CompoundMatrixSpace* comp_jac_d_space =
+        static_cast<const CompoundMatrixSpace*>(GetRawPtr(jac_d_space));
+      DBG_ASSERT(dynamic_cast<const CompoundMatrixSpace*>(GetRawPtr(jac_d_space)));
+      jac_d_orig = comp_jac_d_space->GetCompSpace(0,0)->MakeNew();
+    }
+    const CompoundVector* comp_yd = static_cast<const CompoundVector*>(&yd);
+    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&yd));
+    SmartPtr<const Vector> yd_orig = comp_yd->GetComp(0);
+
+    bool retval = nlp_->Eval_derivatives(x, g_f, jac_c, GetRawPtr(jac_d_orig),
+                                         obj_factor, yc, *yd_orig, h);
+    if (retval && jac_d) {
+      comp_jac_d->SetComp(0, 0, *jac_d_orig);
+    }
+    return retval;
+  }
+
   bool
   NLPBoundsRemover::Eval_jac_d(const Vector& x, Matrix& jac_d)
   {
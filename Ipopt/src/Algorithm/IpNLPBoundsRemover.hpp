@@ -122,6 +122,27 @@ namespace Ipopt
 
     virtual bool Eval_d(const Vector& x, Vector& d);
 
+    virtual bool Eval_f_c_d_batch(Index n_points,
+                                  const Vector* const* x,
+                                  Number* f,
+                                  Vector* const* c,
+                                  Vector* const* d,
+                                  bool* success);
+
+    virtual bool Eval_derivatives(const Vector& x,
+                                  Vector* g_f,
+                                  Matrix* jac_c,
+                                  Matrix* jac_d,
+                                  Number obj_factor,
+                                  const Vector& yc,
+                                  const Vector& yd,
+                                  SymMatrix* h);
+
+    virtual bool CanEvalDerivatives() const
+    {
+      return nlp_->CanEvalDerivatives();
+    }
+
     virtual bool Eval_jac_d(const Vector& x, Matrix& jac_d);
 
     virtual bool Eval_h(const Vector& x,
@@ -45,6 +45,18 @@ namespace Ipopt
       "A limit on CPU seconds that Ipopt can use to solve one problem.  If "
       "during the convergence check this limit is exceeded, Ipopt will "
       "terminate with a corresponding error message.");
+    roptions->AddLowerBoundedNumberOption(
+      "max_wall_time",
+      "Maximum number of wallclock seconds.",
+      0.0, true, 1e6,
+      "A limit on the wallclock seconds that Ipopt can use to solve one "
+      "problem.  In contrast to max_cpu_time, this limit is not only checked "
+      "once per iteration, but also during the backtracking line search, the "
+      "correction of the inertia of the primal-dual system and the "
+      "restoration phase.  If it is exceeded, Ipopt terminates with the "
+      "status Maximum_WallTime_Exceeded and returns the feasible iterate "
+      "with the smallest objective function value that it has found, or the "
+      "current iterate if no feasible iterate has been found.");
     roptions->AddLowerBoundedNumberOption(
       "dual_inf_tol",
       "Desired threshold for the dual infeasibility.",
@@ -259,6 +271,10 @@ namespace Ipopt
       return ConvergenceCheck::CPUTIME_EXCEEDED;
     }
 
+    if (IpData().WallTimeDeadlineReached()) {
+      return ConvergenceCheck::WALLTIME_EXCEEDED;
+    }
+
     return ConvergenceCheck::CONTINUE;
   }
 
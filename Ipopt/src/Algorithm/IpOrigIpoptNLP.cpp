@@ -43,8 +43,17 @@ namespace Ipopt
       jac_d_cache_(1),
       h_cache_(1),
       unscaled_x_cache_(1),
+      f_c_d_cache_size_(1),
       initialized_(false)
-  {}
+  {
+    f_eval_time_.SetTraceName("f_eval");
+    grad_f_eval_time_.SetTraceName("grad_f_eval");
+    c_eval_time_.SetTraceName("c_eval");
+    jac_c_eval_time_.SetTraceName("jac_c_eval");
+    d_eval_time_.SetTraceName("d_eval");
+    jac_d_eval_time_.SetTraceName("jac_d_eval");
+    h_eval_time_.SetTraceName("h_eval");
+  }
 
   OrigIpoptNLP::~OrigIpoptNLP()
   {}
@@ -122,14 +131,17 @@ namespace Ipopt
       "Lagrangian function only once from the NLP and reuse this information "
       "later.");
     roptions->SetRegisteringCategory("Hessian Approximation");
-    roptions->AddStringOption2(
+    roptions->AddStringOption3(
       "hessian_approximation",
       "Indicates what Hessian information is to be used.",
       "exact",
       "exact", "Use second derivatives provided by the NLP.",
       "limited-memory", "Perform a limited-memory quasi-Newton approximation",
+      "exact-product", "Use Hessian-vector products provided by the NLP.",
       "This determines which kind of information for the Hessian of the "
-      "Lagrangian function is used by the algorithm.");
+      "Lagrangian function is used by the algorithm.  The choice "
+      "\"exact-product\" never forms the Hessian matrix and is only "
+      "available with the inexact algorithm.");
     roptions->AddStringOption2(
       "hessian_approximation_space",
       "Indicates in which subspace the Hessian information is to be approximated.",
@@ -485,7 +497,7 @@ namespace Ipopt
   {
     DBG_START_METH("OrigIpoptNLP::f", dbg_verbosity);
     Number ret = 0.0;
-    DBG_PRINT((2, "x.Tag = %u\n", x.GetTag()));
+    DBG_PRINT((2, "x.Tag = %llu\n", x.GetTag()));
     if (!f_cache_.GetCachedResult1Dep(ret, &x)) {
       f_evals_++;
       SmartPtr<const Vector> unscaled_x = get_unscaled_x(x);
@@ -617,6 +629,85 @@ namespace Ipopt
     return retValue;
   }
 
+  bool OrigIpoptNLP::Prefetch_f_c_d(const std::vector<SmartPtr<const Vector> >& x)
+  {
+    DBG_START_METH("OrigIpoptNLP::Prefetch_f_c_d", dbg_verbosity);
+    // Make room in the caches for the values at all points, in
+    // addition to the values at the current point
+    Index cache_size = (Index)x.size() + 1;
+    if (cache_size > f_c_d_cache_size_) {
+      f_cache_.Clear(cache_size);
+      c_cache_.Clear(cache_size);
+      d_cache_.Clear(cache_size);
+      f_c_d_cache_size_ = cache_size;
+    }
+
+    // Only evaluate the points for which the values are not yet known
+    std::vector<SmartPtr<const Vector> > batch_x;
+    std::vector<SmartPtr<const Vector> > unscaled_x;
+    for (Index i=0; i<(Index)x.size(); i++) {
+      Number f;
+      if (!f_cache_.GetCachedResult1Dep(f, GetRawPtr(x[i]))) {
+        batch_x.push_back(x[i]);
+        unscaled_x.push_back(NLP_scaling()->unapply_vector_scaling_x(x[i]));
+      }
+    }
+    Index n_points = (Index)batch_x.size();
+    if (n_points == 0) {
+      return true;
+    }
+
+    std::vector<const Vector*> x_ptrs(n_points);
+    std::vector<SmartPtr<Vector> > unscaled_c(n_points);
+    std::vector<SmartPtr<Vector> > unscaled_d(n_points);
+    std::vector<Vector*> c_ptrs(n_points);
+    std::vector<Vector*> d_ptrs(n_points);
+    for (Index i=0; i<n_points; i++) {
+      x_ptrs[i] = GetRawPtr(unscaled_x[i]);
+      unscaled_c[i] = c_space_->MakeNew();
+      c_ptrs[i] = GetRawPtr(unscaled_c[i]);
+      unscaled_d[i] = d_space_->MakeNew();
+      d_ptrs[i] = GetRawPtr(unscaled_d[i]);
+    }
+    std::vector<Number> f(n_points);
+    bool* success = new bool[n_points];
+
+    // The time for the evaluations is counted as time for the
+    // constraints, which usually dominates
+    c_eval_time_.Start();
+    bool retval = nlp_->Eval_f_c_d_batch(n_points, &x_ptrs[0], &f[0],
+                                         &c_ptrs[0], &d_ptrs[0], success);
+    c_eval_time_.End();
+
+    if (retval) {
+      for (Index i=0; i<n_points; i++) {
+        // Points at which the evaluation failed are evaluated again
+        // when their values are needed, so that an evaluation error
+        // is reported in the usual way
+        if (!success[i] || !IsFiniteNumber(f[i]) ||
+            !IsFiniteNumber(unscaled_c[i]->Nrm2()) ||
+            !IsFiniteNumber(unscaled_d[i]->Nrm2())) {
+          continue;
+        }
+        const Vector* dep = GetRawPtr(batch_x[i]);
+        f_evals_++;
+        f_cache_.AddCachedResult1Dep(NLP_scaling()->apply_obj_scaling(f[i]),
+                                     dep);
+        if (c_space_->Dim() > 0) {
+          c_evals_++;
+          c_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_c(ConstPtr(unscaled_c[i])), dep);
+        }
+        if (d_space_->Dim() > 0) {
+          d_evals_++;
+          d_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_d(ConstPtr(unscaled_d[i])), dep);
+        }
+      }
+    }
+    delete [] success;
+
+    return retval;
+  }
+
   SmartPtr<const Matrix> OrigIpoptNLP::jac_c(const Vector& x)
   {
     SmartPtr<const Matrix> retValue;
@@ -774,6 +865,111 @@ namespace Ipopt
     return NULL;
   }
 
+  bool OrigIpoptNLP::Prefetch_derivatives(const Vector& x,
+                                          const Vector& yc,
+                                          const Vector& yd)
+  {
+    DBG_START_METH("OrigIpoptNLP::Prefetch_derivatives", dbg_verbosity);
+    if (!nlp_->CanEvalDerivatives()) {
+      return false;
+    }
+
+    // Find out which quantities are not yet known
+    SmartPtr<const Vector> cached_vector;
+    SmartPtr<const Matrix> cached_matrix;
+    SmartPtr<const SymMatrix> cached_sym_matrix;
+    bool need_grad_f = !grad_f_cache_.GetCachedResult1Dep(cached_vector, &x);
+
+    const Vector* jac_c_dep = jac_c_constant_ ? NULL : &x;
+    bool need_jac_c = c_space_->Dim() > 0 &&
+                      !jac_c_cache_.GetCachedResult1Dep(cached_matrix, jac_c_dep);
+    const Vector* jac_d_dep = jac_d_constant_ ? NULL : &x;
+    bool need_jac_d = d_space_->Dim() > 0 &&
+                      !jac_d_cache_.GetCachedResult1Dep(cached_matrix, jac_d_dep);
+
+    const TaggedObject* h_deps[3];
+    if (!hessian_constant_) {
+      h_deps[0] = &x;
+      h_deps[1] = &yc;
+      h_deps[2] = &yd;
+    }
+    else {
+      h_deps[0] = NULL;
+      h_deps[1] = NULL;
+      h_deps[2] = NULL;
+    }
+    Number h_scalar_dep = 1.;
+    bool need_h = hessian_approximation_ == EXACT &&
+                  !h_cache_.GetCachedResult(cached_sym_matrix, 3, h_deps,
+                                            1, &h_scalar_dep);
+
+    if (!need_grad_f && !need_jac_c && !need_jac_d && !need_h) {
+      return false;
+    }
+
+    SmartPtr<const Vector> unscaled_x = get_unscaled_x(x);
+    SmartPtr<Vector> unscaled_grad_f;
+    if (need_grad_f) {
+      unscaled_grad_f = x_space_->MakeNew();
+    }
+    SmartPtr<Matrix> unscaled_jac_c;
+    if (need_jac_c) {
+      unscaled_jac_c = jac_c_space_->MakeNew();
+    }
+    SmartPtr<Matrix> unscaled_jac_d;
+    if (need_jac_d) {
+      unscaled_jac_d = jac_d_space_->MakeNew();
+    }
+    SmartPtr<SymMatrix> unscaled_h;
+    SmartPtr<const Vector> unscaled_yc = &yc;
+    SmartPtr<const Vector> unscaled_yd = &yd;
+    Number scaled_obj_factor = 1.;
+    if (need_h) {
+      unscaled_h = h_space_->MakeNewSymMatrix();
+      unscaled_yc = NLP_scaling()->apply_vector_scaling_c(&yc);
+      unscaled_yd = NLP_scaling()->apply_vector_scaling_d(&yd);
+      scaled_obj_factor = NLP_scaling()->apply_obj_scaling(1.);
+    }
+
+    // The time for the evaluations is counted as time for the
+    // constraint Jacobian, which usually dominates
+    jac_c_eval_time_.Start();
+    bool retval =
+      nlp_->Eval_derivatives(*unscaled_x, GetRawPtr(unscaled_grad_f),
+                             GetRawPtr(unscaled_jac_c),
+                             GetRawPtr(unscaled_jac_d), scaled_obj_factor,
+                             *unscaled_yc, *unscaled_yd,
+                             GetRawPtr(unscaled_h));
+    jac_c_eval_time_.End();
+    if (!retval) {
+      return false;
+    }
+
+    // Quantities with invalid numbers are evaluated again when they
+    // are needed, so that the error is reported in the usual way
+    if (need_grad_f && IsFiniteNumber(unscaled_grad_f->Nrm2())) {
+      grad_f_evals_++;
+      grad_f_cache_.AddCachedResult1Dep(NLP_scaling()->apply_grad_obj_scaling(ConstPtr(unscaled_grad_f)), &x);
+    }
+    if (need_jac_c &&
+        (!check_derivatives_for_naninf_ || unscaled_jac_c->HasValidNumbers())) {
+      jac_c_evals_++;
+      jac_c_cache_.AddCachedResult1Dep(NLP_scaling()->apply_jac_c_scaling(ConstPtr(unscaled_jac_c)), jac_c_dep);
+    }
+    if (need_jac_d &&
+        (!check_derivatives_for_naninf_ || unscaled_jac_d->HasValidNumbers())) {
+      jac_d_evals_++;
+      jac_d_cache_.AddCachedResult1Dep(NLP_scaling()->apply_jac_d_scaling(ConstPtr(unscaled_jac_d)), jac_d_dep);
+    }
+    if (need_h &&
+        (!check_derivatives_for_naninf_ || unscaled_h->HasValidNumbers())) {
+      h_evals_++;
+      h_cache_.AddCachedResult(NLP_scaling()->apply_hessian_scaling(ConstPtr(unscaled_h)), 3, h_deps, 1, &h_scalar_dep);
+    }
+
+    return true;
+  }
+
 
   void OrigIpoptNLP::GetSpaces(SmartPtr<const VectorSpace>& x_space,
                                SmartPtr<const VectorSpace>& c_space,
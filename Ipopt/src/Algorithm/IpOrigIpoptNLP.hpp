@@ -19,7 +19,8 @@ namespace Ipopt
   /** enumeration for the Hessian information type. */
   enum HessianApproximationType {
     EXACT=0,
-    LIMITED_MEMORY
+    LIMITED_MEMORY,
+    EXACT_PRODUCT
   };
 
   /** enumeration for the Hessian approximation space. */
@@ -99,6 +100,10 @@ namespace Ipopt
      *  as equalities with slacks */
     virtual SmartPtr<const Vector> d(const Vector& x);
 
+    /** Evaluate f, c, and d at several points with one call of the
+     *  NLP (see IpoptNLP::Prefetch_f_c_d) */
+    virtual bool Prefetch_f_c_d(const std::vector<SmartPtr<const Vector> >& x);
+
     /** Jacobian Matrix for inequality constraints*/
     virtual SmartPtr<const Matrix> jac_d(const Vector& x);
 
@@ -117,6 +122,12 @@ namespace Ipopt
                                         const Vector& yd,
                                         Number mu);
 
+    /** Evaluate the derivatives at a new iterate with one call of the
+     *  NLP (see IpoptNLP::Prefetch_derivatives) */
+    virtual bool Prefetch_derivatives(const Vector& x,
+                                      const Vector& yc,
+                                      const Vector& yd);
+
     /** Provides a Hessian matrix from the correct matrix space with
      *  uninitialized values.  This can be used in LeastSquareMults to
      *  obtain a "zero Hessian". */
@@ -370,6 +381,10 @@ namespace Ipopt
     /** Unscaled version of x vector */
     CachedResults<SmartPtr<const Vector> > unscaled_x_cache_;
 
+    /** Size of f_cache_, c_cache_ and d_cache_, which is increased
+     *  to hold the values of the points given to Prefetch_f_c_d */
+    Index f_c_d_cache_size_;
+
     /** Lower bounds on x */
     SmartPtr<const Vector> x_L_;
 
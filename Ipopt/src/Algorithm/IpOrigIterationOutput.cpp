@@ -88,6 +88,8 @@ namespace Ipopt
     options.GetIntegerValue("print_frequency_iter", print_frequency_iter_, prefix);
     options.GetNumericValue("print_frequency_time", print_frequency_time_, prefix);
 
+    InitializeTrace();
+
     return true;
   }
 
@@ -114,69 +116,88 @@ namespace Ipopt
     else {
       Jnlst().Printf(J_DETAILED, J_MAIN, header.c_str());
     }
-    Number inf_pr = 0.0;
-    switch (inf_pr_output_) {
-    case INTERNAL:
-      inf_pr = IpCq().curr_primal_infeasibility(NORM_MAX);
-      break;
-    case ORIGINAL:
-      inf_pr = IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX);
-      break;
-    }
-    Number inf_du = IpCq().curr_dual_infeasibility(NORM_MAX);
-    Number mu = IpData().curr_mu();
-    Number dnrm;
-    if (IsValid(IpData().delta()) && IsValid(IpData().delta()->x()) && IsValid(IpData().delta()->s())) {
-      dnrm = Max(IpData().delta()->x()->Amax(), IpData().delta()->s()->Amax());
-    }
-    else {
-      // This is the first iteration - no search direction has been
-      // computed yet.
-      dnrm = 0.;
-    }
-    Number unscaled_f = IpCq().unscaled_curr_f();
-
-    // Retrieve some information set in the different parts of the algorithm
-    char info_iter=' ';
-    Number alpha_primal = IpData().info_alpha_primal();
-    char alpha_primal_char = IpData().info_alpha_primal_char();
-    Number alpha_dual = IpData().info_alpha_dual();
-    Number regu_x = IpData().info_regu_x();
-    char regu_x_buf[8];
-    char dashes[]="   - ";
-    char *regu_x_ptr;
-    if (regu_x==.0) {
-      regu_x_ptr = dashes;
-    }
-    else {
-      Snprintf(regu_x_buf, 7, "%5.1f", log10(regu_x));
-      regu_x_ptr = regu_x_buf;
-    }
-    Index ls_count = IpData().info_ls_count();
-    const std::string info_string = IpData().info_string();
-
     Number current_time = 0.0;
     Number last_output = IpData().info_last_output();
     if (!IpData().info_skip_output() &&
        (iter % print_frequency_iter_) == 0 &&
        (print_frequency_time_ == 0.0 || last_output < (current_time = WallclockTime()) - print_frequency_time_ || last_output < 0.0) ) {
-      Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
-                     "%4d%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3d",
-                     iter, info_iter, unscaled_f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr,
-                     alpha_dual, alpha_primal, alpha_primal_char,
-                     ls_count);
-      if (print_info_string_) {
-        Jnlst().Printf(J_ITERSUMMARY, J_MAIN, " %s", info_string.c_str());
-      }
-      else {
-        Jnlst().Printf(J_DETAILED, J_MAIN, " %s", info_string.c_str());
+      // The values are only computed if the line is indeed printed
+      if (Jnlst().ProduceOutput(J_ITERSUMMARY, J_MAIN)) {
+        Number inf_pr = 0.0;
+        switch (inf_pr_output_) {
+        case INTERNAL:
+          inf_pr = IpCq().curr_primal_infeasibility(NORM_MAX);
+          break;
+        case ORIGINAL:
+          inf_pr = IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX);
+          break;
+        }
+        Number inf_du = IpCq().curr_dual_infeasibility(NORM_MAX);
+        Number mu = IpData().curr_mu();
+        Number dnrm;
+        if (IsValid(IpData().delta()) && IsValid(IpData().delta()->x()) && IsValid(IpData().delta()->s())) {
+          dnrm = Max(IpData().delta()->x()->Amax(), IpData().delta()->s()->Amax());
+        }
+        else {
+          // This is the first iteration - no search direction has been
+          // computed yet.
+          dnrm = 0.;
+        }
+        Number unscaled_f = IpCq().unscaled_curr_f();
+
+        // Retrieve some information set in the different parts of the algorithm
+        char info_iter=' ';
+        Number alpha_primal = IpData().info_alpha_primal();
+        char alpha_primal_char = IpData().info_alpha_primal_char();
+        Number alpha_dual = IpData().info_alpha_dual();
+        Number regu_x = IpData().info_regu_x();
+        char regu_x_buf[8];
+        char dashes[]="   - ";
+        char *regu_x_ptr;
+        if (regu_x==.0) {
+          regu_x_ptr = dashes;
+        }
+        else {
+          Snprintf(regu_x_buf, 7, "%5.1f", log10(regu_x));
+          regu_x_ptr = regu_x_buf;
+        }
+        Index ls_count = IpData().info_ls_count();
+        const std::string info_string = IpData().info_string();
+
+        Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
+                       "%4d%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3d",
+                       iter, info_iter, unscaled_f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr,
+                       alpha_dual, alpha_primal, alpha_primal_char,
+                       ls_count);
+        if (print_info_string_) {
+          Jnlst().Printf(J_ITERSUMMARY, J_MAIN, " %s", info_string.c_str());
+        }
+        else {
+          Jnlst().Printf(J_DETAILED, J_MAIN, " %s", info_string.c_str());
+        }
+        Jnlst().Printf(J_ITERSUMMARY, J_MAIN, "\n");
       }
-      Jnlst().Printf(J_ITERSUMMARY, J_MAIN, "\n");
 
       IpData().Set_info_last_output(current_time);
       IpData().Inc_info_iters_since_header();
     }
 
+    // The iteration trace gets a record for every iteration,
+    // independent of the print frequency
+    if (TraceEnabled() && !IpData().info_skip_output()) {
+      Number inf_pr = 0.0;
+      switch (inf_pr_output_) {
+      case INTERNAL:
+        inf_pr = IpCq().curr_primal_infeasibility(NORM_MAX);
+        break;
+      case ORIGINAL:
+        inf_pr = IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX);
+        break;
+      }
+      WriteTraceRecord(false, IpCq().unscaled_curr_f(), inf_pr,
+                       IpCq().curr_dual_infeasibility(NORM_MAX), IpNLP());
+    }
+
 
     //////////////////////////////////////////////////////////////////////
     //           Now if desired more detail on the iterates             //
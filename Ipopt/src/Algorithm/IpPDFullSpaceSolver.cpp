@@ -345,6 +345,7 @@ namespace Ipopt
 
         residual_ratio_old = residual_ratio;
       } // End of loop for iterative refinement
+      IpData().Add_info_refinement_steps(num_iter_ref);
 
       done = !(resolve_with_better_quality) && !(pretend_singular);
 
@@ -373,6 +374,114 @@ namespace Ipopt
     return true;
   }
 
+  bool PDFullSpaceSolver::MultiSolve(
+    std::vector<SmartPtr<const IteratesVector> >& rhsV,
+    std::vector<SmartPtr<IteratesVector> >& resV,
+    bool allow_inexact)
+  {
+    DBG_START_METH("PDFullSpaceSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(rhsV.size() == resV.size());
+
+    Index nrhs = (Index)rhsV.size();
+    if (!allow_inexact || nrhs <= 1) {
+      return PDSystemSolver::MultiSolve(rhsV, resV, allow_inexact);
+    }
+
+    // The first system is solved with Solve, so that the
+    // factorization and the perturbations are determined as usual.
+    // Afterwards, the cache tells SolveOnce that the matrix is up to
+    // date, and the remaining systems only need backsolves with the
+    // same perturbations.
+    if (!Solve(1., 0., *rhsV[0], *resV[0], allow_inexact)) {
+      return false;
+    }
+
+    IpData().TimingStats().PDSystemSolverTotal().Start();
+    IpData().TimingStats().PDSystemSolverSolveOnce().Start();
+
+    SmartPtr<const Matrix> Px_L = IpNLP().Px_L();
+    SmartPtr<const Matrix> Px_U = IpNLP().Px_U();
+    SmartPtr<const Matrix> Pd_L = IpNLP().Pd_L();
+    SmartPtr<const Matrix> Pd_U = IpNLP().Pd_U();
+    SmartPtr<const Vector> z_L = IpData().curr()->z_L();
+    SmartPtr<const Vector> z_U = IpData().curr()->z_U();
+    SmartPtr<const Vector> v_L = IpData().curr()->v_L();
+    SmartPtr<const Vector> v_U = IpData().curr()->v_U();
+    SmartPtr<const Vector> slack_x_L = IpCq().curr_slack_x_L();
+    SmartPtr<const Vector> slack_x_U = IpCq().curr_slack_x_U();
+    SmartPtr<const Vector> slack_s_L = IpCq().curr_slack_s_L();
+    SmartPtr<const Vector> slack_s_U = IpCq().curr_slack_s_U();
+
+    // Compute the right hand sides for the augmented system formulation
+    std::vector<SmartPtr<const Vector> > augRhs_xV(nrhs-1);
+    std::vector<SmartPtr<const Vector> > augRhs_sV(nrhs-1);
+    std::vector<SmartPtr<const Vector> > rhs_cV(nrhs-1);
+    std::vector<SmartPtr<const Vector> > rhs_dV(nrhs-1);
+    std::vector<SmartPtr<IteratesVector> > solV(nrhs-1);
+    std::vector<SmartPtr<Vector> > sol_xV(nrhs-1);
+    std::vector<SmartPtr<Vector> > sol_sV(nrhs-1);
+    std::vector<SmartPtr<Vector> > sol_cV(nrhs-1);
+    std::vector<SmartPtr<Vector> > sol_dV(nrhs-1);
+    for (Index i=1; i<nrhs; i++) {
+      const IteratesVector& rhs = *rhsV[i];
+      SmartPtr<Vector> augRhs_x = rhs.x()->MakeNewCopy();
+      Px_L->AddMSinvZ(1.0, *slack_x_L, *rhs.z_L(), *augRhs_x);
+      Px_U->AddMSinvZ(-1.0, *slack_x_U, *rhs.z_U(), *augRhs_x);
+      augRhs_xV[i-1] = ConstPtr(augRhs_x);
+
+      SmartPtr<Vector> augRhs_s = rhs.s()->MakeNewCopy();
+      Pd_L->AddMSinvZ(1.0, *slack_s_L, *rhs.v_L(), *augRhs_s);
+      Pd_U->AddMSinvZ(-1.0, *slack_s_U, *rhs.v_U(), *augRhs_s);
+      augRhs_sV[i-1] = ConstPtr(augRhs_s);
+
+      rhs_cV[i-1] = rhs.y_c();
+      rhs_dV[i-1] = rhs.y_d();
+
+      solV[i-1] = resV[i]->MakeNewIteratesVector(true);
+      sol_xV[i-1] = solV[i-1]->x_NonConst();
+      sol_sV[i-1] = solV[i-1]->s_NonConst();
+      sol_cV[i-1] = solV[i-1]->y_c_NonConst();
+      sol_dV[i-1] = solV[i-1]->y_d_NonConst();
+    }
+
+    Number delta_x;
+    Number delta_s;
+    Number delta_c;
+    Number delta_d;
+    perturbHandler_->CurrentPerturbation(delta_x, delta_s, delta_c, delta_d);
+
+    ESymSolverStatus retval =
+      augSysSolver_->MultiSolve(GetRawPtr(IpData().W()), 1.0,
+                                GetRawPtr(IpCq().curr_sigma_x()), delta_x,
+                                GetRawPtr(IpCq().curr_sigma_s()), delta_s,
+                                GetRawPtr(IpCq().curr_jac_c()), NULL, delta_c,
+                                GetRawPtr(IpCq().curr_jac_d()), NULL, delta_d,
+                                augRhs_xV, augRhs_sV, rhs_cV, rhs_dV,
+                                sol_xV, sol_sV, sol_cV, sol_dV,
+                                false, 0);
+    if (retval!=SYMSOLVER_SUCCESS) {
+      IpData().TimingStats().PDSystemSolverSolveOnce().End();
+      IpData().TimingStats().PDSystemSolverTotal().End();
+      return false;
+    }
+
+    // Compute the remaining sol Vectors
+    for (Index i=1; i<nrhs; i++) {
+      const IteratesVector& rhs = *rhsV[i];
+      IteratesVector& sol = *solV[i-1];
+      Px_L->SinvBlrmZMTdBr(-1., *slack_x_L, *rhs.z_L(), *z_L, *sol.x(), *sol.z_L_NonConst());
+      Px_U->SinvBlrmZMTdBr(1., *slack_x_U, *rhs.z_U(), *z_U, *sol.x(), *sol.z_U_NonConst());
+      Pd_L->SinvBlrmZMTdBr(-1., *slack_s_L, *rhs.v_L(), *v_L, *sol.s(), *sol.v_L_NonConst());
+      Pd_U->SinvBlrmZMTdBr(1., *slack_s_U, *rhs.v_U(), *v_U, *sol.s(), *sol.v_U_NonConst());
+      resV[i]->Copy(sol);
+    }
+
+    IpData().TimingStats().PDSystemSolverSolveOnce().End();
+    IpData().TimingStats().PDSystemSolverTotal().End();
+
+    return true;
+  }
+
   bool PDFullSpaceSolver::SolveOnce(bool resolve_with_better_quality,
                                     bool pretend_singular,
                                     const SymMatrix& W,
@@ -623,6 +732,14 @@ namespace Ipopt
             }
           }
         }
+
+        // Do not try more perturbations if the deadline for the
+        // wallclock time has passed
+        if (retval!=SYMSOLVER_SUCCESS && IpData().WallTimeDeadlineReached()) {
+          IpData().TimingStats().PDSystemSolverSolveOnce().End();
+          THROW_EXCEPTION(WALLTIME_DEADLINE_REACHED,
+                          "Wallclock time deadline reached during the correction of the inertia.");
+        }
       } // while (retval!=SYMSOLVER_SUCCESS && !fail) {
 
       // Some output
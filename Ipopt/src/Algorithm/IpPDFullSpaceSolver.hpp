@@ -57,6 +57,17 @@ namespace Ipopt
                        bool allow_inexact=false,
                        bool improve_solution=false);
 
+    /** Solve the primal dual system for several right hand sides.
+     *  If allow_inexact is true, the system is solved (and factorized,
+     *  if necessary) for the first right hand side with Solve, and
+     *  the remaining right hand sides are passed together to the
+     *  MultiSolve method of the augmented system solver.  Otherwise,
+     *  Solve is called for each right hand side, since the iterative
+     *  refinement is done for each solution separately. */
+    virtual bool MultiSolve(std::vector<SmartPtr<const IteratesVector> >& rhsV,
+                            std::vector<SmartPtr<IteratesVector> >& resV,
+                            bool allow_inexact=false);
+
     /** Methods for IpoptType */
     //@{
     static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
@@ -26,6 +26,7 @@ namespace Ipopt
 
   PDPerturbationHandler::PDPerturbationHandler()
       :
+      restore_state_(false),
       reset_last_(false),
       degen_iters_max_(3)
   {}
@@ -142,15 +143,63 @@ namespace Ipopt
 
     test_status_ = NO_TEST;
 
+    // Continue with the perturbation history of a warm start
+    // snapshot, if one is given.  The history is only restored for
+    // the first system, since the warm start initialization might
+    // still reject the snapshot.
+    options.GetBoolValue("warm_start_init_point", restore_state_, prefix);
+
     return true;
   }
 
+  void PDPerturbationHandler::StoreState()
+  {
+    PDPertHistory state;
+    state.valid = true;
+    state.delta_x_last = delta_x_last_;
+    state.delta_s_last = delta_s_last_;
+    state.delta_c_last = delta_c_last_;
+    state.delta_d_last = delta_d_last_;
+    state.hess_degenerate = hess_degenerate_;
+    state.jac_degenerate = jac_degenerate_;
+    state.degen_iters = degen_iters_;
+    IpData().SetPDPertState(state);
+  }
+
+  void PDPerturbationHandler::RestoreState(const PDPertHistory& state)
+  {
+    if (!state.valid) {
+      return;
+    }
+    delta_x_last_ = state.delta_x_last;
+    delta_s_last_ = state.delta_s_last;
+    delta_c_last_ = state.delta_c_last;
+    delta_d_last_ = state.delta_d_last;
+    hess_degenerate_ = (DegenType)state.hess_degenerate;
+    if (!perturb_always_cd_) {
+      jac_degenerate_ = (DegenType)state.jac_degenerate;
+    }
+    degen_iters_ = state.degen_iters;
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Continuing with perturbation history from warm start snapshot: delta_x_last_ = %e hess_degenerate_ = %d jac_degenerate_ = %d\n",
+                   delta_x_last_, hess_degenerate_, jac_degenerate_);
+  }
+
   bool
   PDPerturbationHandler::ConsiderNewSystem(Number& delta_x, Number& delta_s,
       Number& delta_c, Number& delta_d)
   {
     DBG_START_METH("PDPerturbationHandler::ConsiderNewSystem",dbg_verbosity);
 
+    if (restore_state_) {
+      SmartPtr<const WarmStartSnapshot> snapshot =
+        IpData().GetWarmStartSnapshot();
+      if (IsValid(snapshot)) {
+        RestoreState(snapshot->PDPertState());
+      }
+      restore_state_ = false;
+    }
+
     // Check if we can conclude that some components of the system are
     // structurally degenerate
     finalize_test();
@@ -182,6 +231,8 @@ namespace Ipopt
                (jac_degenerate_ != NOT_YET_DETERMINED ||
                 hess_degenerate_ != DEGENERATE));
 
+    StoreState();
+
     if (hess_degenerate_ == NOT_YET_DETERMINED ||
         jac_degenerate_ == NOT_YET_DETERMINED) {
       if (!perturb_always_cd_) {
@@ -227,6 +278,7 @@ namespace Ipopt
     delta_d_curr_ = delta_d;
 
     IpData().Set_info_regu_x(delta_x);
+    IpData().Set_info_regu_c(delta_c);
 
     get_deltas_for_wrong_inertia_called_ = false;
 
@@ -340,6 +392,7 @@ namespace Ipopt
     delta_d = delta_d_curr_;
 
     IpData().Set_info_regu_x(delta_x);
+    IpData().Set_info_regu_c(delta_c);
 
     return true;
   }
@@ -384,6 +437,7 @@ namespace Ipopt
     delta_d = delta_d_curr_;
 
     IpData().Set_info_regu_x(delta_x);
+    IpData().Set_info_regu_c(delta_c);
 
     get_deltas_for_wrong_inertia_called_ = true;
 
@@ -138,6 +138,19 @@ namespace Ipopt
      *  non-degenerate (unperturbed) matrix at some point. */
     Index degen_iters_;
 
+    /** Publish the perturbation history (last perturbations and
+     *  degeneracy flags) in IpoptData, so that it can be stored in a
+     *  warm start snapshot. */
+    void StoreState();
+
+    /** Continue with a perturbation history published by
+     *  StoreState */
+    void RestoreState(const PDPertHistory& state);
+
+    /** Flag indicating whether the perturbation history of a warm
+     *  start snapshot is to be restored for the next system */
+    bool restore_state_;
+
     /** Status of current trial configuration */
     enum TrialStatus
     {
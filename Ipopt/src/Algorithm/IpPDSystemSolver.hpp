@@ -14,6 +14,8 @@
 #include "IpAlgStrategy.hpp"
 #include "IpIteratesVector.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 
@@ -110,6 +112,27 @@ namespace Ipopt
                        bool allow_inexact=false,
                        bool improve_solution=false) =0;
 
+    /** Solve the primal dual system for several right hand sides
+     *  (with alpha=1 and beta=0).  This is meant for computing many
+     *  solutions with the same matrix, as it is done for example in
+     *  sIPOPT.  The default implementation calls Solve for each
+     *  right hand side; a derived class can overload it to pass the
+     *  right hand sides together to the linear solver.  The return
+     *  value is false, if one of the solutions could not be
+     *  computed. */
+    virtual bool MultiSolve(std::vector<SmartPtr<const IteratesVector> >& rhsV,
+                            std::vector<SmartPtr<IteratesVector> >& resV,
+                            bool allow_inexact=false)
+    {
+      DBG_ASSERT(rhsV.size() == resV.size());
+      for (Index i=0; i<(Index)rhsV.size(); i++) {
+        if (!Solve(1., 0., *rhsV[i], *resV[i], allow_inexact)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
   private:
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
@@ -7,6 +7,7 @@
 // Authors:  Carl Laird, Andreas Waechter            IBM    2004-11-12
 
 #include "IpQualityFunctionMuOracle.hpp"
+#include "IpDenseVector.hpp"
 
 #ifdef HAVE_CMATH
 # include <cmath>
@@ -28,16 +29,24 @@
 # endif
 #endif
 
+#include <limits>
+
 namespace Ipopt
 {
 #if COIN_IPOPT_VERBOSITY > 0
   static const Index dbg_verbosity = 0;
 #endif
 
+  /** Number of entries of a block that are handled by one task in the
+   *  dense evaluation of the quality function.  This does not depend
+   *  on the number of threads, so that the result does not either. */
+  static const Index dense_task_size = 16384;
+
   QualityFunctionMuOracle::QualityFunctionMuOracle(const SmartPtr<PDSystemSolver>& pd_solver)
       :
       MuOracle(),
       pd_solver_(pd_solver),
+      use_dense_eval_(false),
 
       tmp_step_x_L_(NULL),
       tmp_step_x_U_(NULL),
@@ -138,6 +147,29 @@ namespace Ipopt
       "The golden section search is performed for the quality function based mu "
       "oracle. (Only used if option "
       "\"mu_oracle\" is set to \"quality-function\".)");
+    roptions->AddLowerBoundedIntegerOption(
+      "quality_function_section_points",
+      "Number of values of the centering parameter that are evaluated "
+      "together in one step of the search procedure.",
+      1, 1,
+      "If this is 1, a golden section search is performed, which evaluates "
+      "the quality function for one new value of sigma in each step.  For a "
+      "larger number, each step evaluates this many equally spaced values of "
+      "sigma inside the current interval, which is then reduced to the "
+      "neighbors of the best value.  Values that are evaluated together "
+      "require only two passes over the search directions.  The option "
+      "\"quality_function_max_section_steps\" limits the number of these "
+      "steps. (Only used if option "
+      "\"mu_oracle\" is set to \"quality-function\".)");
+    roptions->AddLowerBoundedIntegerOption(
+      "quality_function_threads",
+      "Number of threads that evaluate the quality function.",
+      1, 1,
+      "If this is larger than 1, the vectors are split into parts that are "
+      "processed by different threads when the quality function is "
+      "evaluated.  This is only done if the vectors of the problem are dense "
+      "(which is not the case in the restoration phase). (Only used if "
+      "option \"mu_oracle\" is set to \"quality-function\".)");
   }
 
 
@@ -161,6 +193,17 @@ namespace Ipopt
                             quality_function_section_sigma_tol_, prefix);
     options.GetNumericValue("quality_function_section_qf_tol",
                             quality_function_section_qf_tol_, prefix);
+    options.GetIntegerValue("quality_function_section_points",
+                            quality_function_section_points_, prefix);
+    options.GetIntegerValue("quality_function_threads",
+                            quality_function_threads_, prefix);
+    if (quality_function_threads_ <= 1) {
+      thread_pool_ = NULL;
+    }
+    else if (IsNull(thread_pool_) ||
+             thread_pool_->NumThreads() != quality_function_threads_) {
+      thread_pool_ = new ThreadPool(quality_function_threads_);
+    }
 
     initialized_ = false;
 
@@ -347,18 +390,10 @@ namespace Ipopt
     IpNLP().Pd_L()->TransMultVector(1., *step_cen->s(), 0., *step_cen_s_L);
     IpNLP().Pd_U()->TransMultVector(-1., *step_cen->s(), 0., *step_cen_s_U);
 
-    Number sigma;
-
-    // First we determine whether we want to search for a value of
-    // sigma larger or smaller than 1.  For this, we estimate the
-    // slope of the quality function at sigma=1.
-    Number qf_1 = CalculateQualityFunction(1.,
-                                           *step_aff_x_L,
+    use_dense_eval_ = SetupDenseEvaluation(*step_aff_x_L,
                                            *step_aff_x_U,
                                            *step_aff_s_L,
                                            *step_aff_s_U,
-                                           *step_aff->y_c(),
-                                           *step_aff->y_d(),
                                            *step_aff->z_L(),
                                            *step_aff->z_U(),
                                            *step_aff->v_L(),
@@ -367,35 +402,45 @@ namespace Ipopt
                                            *step_cen_x_U,
                                            *step_cen_s_L,
                                            *step_cen_s_U,
-                                           *step_cen->y_c(),
-                                           *step_cen->y_d(),
                                            *step_cen->z_L(),
                                            *step_cen->z_U(),
                                            *step_cen->v_L(),
                                            *step_cen->v_U());
 
+    Number sigma;
+
+    // First we determine whether we want to search for a value of
+    // sigma larger or smaller than 1.  For this, we estimate the
+    // slope of the quality function at sigma=1.
+    // sigma=1 and a value slightly smaller are evaluated together
     Number sigma_1minus = 1.-Max(1e-4, quality_function_section_sigma_tol_);
-    Number qf_1minus = CalculateQualityFunction(sigma_1minus,
-                       *step_aff_x_L,
-                       *step_aff_x_U,
-                       *step_aff_s_L,
-                       *step_aff_s_U,
-                       *step_aff->y_c(),
-                       *step_aff->y_d(),
-                       *step_aff->z_L(),
-                       *step_aff->z_U(),
-                       *step_aff->v_L(),
-                       *step_aff->v_U(),
-                       *step_cen_x_L,
-                       *step_cen_x_U,
-                       *step_cen_s_L,
-                       *step_cen_s_U,
-                       *step_cen->y_c(),
-                       *step_cen->y_d(),
-                       *step_cen->z_L(),
-                       *step_cen->z_U(),
-                       *step_cen->v_L(),
-                       *step_cen->v_U());
+    Number sigma_1[2];
+    Number qf_1s[2];
+    sigma_1[0] = 1.;
+    sigma_1[1] = sigma_1minus;
+    CalculateQualityFunctions(2, sigma_1, qf_1s,
+                              *step_aff_x_L,
+                              *step_aff_x_U,
+                              *step_aff_s_L,
+                              *step_aff_s_U,
+                              *step_aff->y_c(),
+                              *step_aff->y_d(),
+                              *step_aff->z_L(),
+                              *step_aff->z_U(),
+                              *step_aff->v_L(),
+                              *step_aff->v_U(),
+                              *step_cen_x_L,
+                              *step_cen_x_U,
+                              *step_cen_s_L,
+                              *step_cen_s_U,
+                              *step_cen->y_c(),
+                              *step_cen->y_d(),
+                              *step_cen->z_L(),
+                              *step_cen->z_U(),
+                              *step_cen->v_L(),
+                              *step_cen->v_U());
+    Number qf_1 = qf_1s[0];
+    Number qf_1minus = qf_1s[1];
 
     if (qf_1minus > qf_1) {
       // It seems that the quality function decreases for values
@@ -408,29 +453,56 @@ namespace Ipopt
       }
       else {
         // ToDo maybe we should use different tolerances for sigma>1
-        sigma = PerformGoldenSection(sigma_up, -100., sigma_lo, qf_1,
-                                     quality_function_section_sigma_tol_,
-                                     quality_function_section_qf_tol_,
-                                     *step_aff_x_L,
-                                     *step_aff_x_U,
-                                     *step_aff_s_L,
-                                     *step_aff_s_U,
-                                     *step_aff->y_c(),
-                                     *step_aff->y_d(),
-                                     *step_aff->z_L(),
-                                     *step_aff->z_U(),
-                                     *step_aff->v_L(),
-                                     *step_aff->v_U(),
-                                     *step_cen_x_L,
-                                     *step_cen_x_U,
-                                     *step_cen_s_L,
-                                     *step_cen_s_U,
-                                     *step_cen->y_c(),
-                                     *step_cen->y_d(),
-                                     *step_cen->z_L(),
-                                     *step_cen->z_U(),
-                                     *step_cen->v_L(),
-                                     *step_cen->v_U());
+        if (quality_function_section_points_ > 1) {
+          sigma = PerformBatchSection(sigma_up, -100., sigma_lo, qf_1,
+                                      quality_function_section_sigma_tol_,
+                                      quality_function_section_qf_tol_,
+                                      *step_aff_x_L,
+                                      *step_aff_x_U,
+                                      *step_aff_s_L,
+                                      *step_aff_s_U,
+                                      *step_aff->y_c(),
+                                      *step_aff->y_d(),
+                                      *step_aff->z_L(),
+                                      *step_aff->z_U(),
+                                      *step_aff->v_L(),
+                                      *step_aff->v_U(),
+                                      *step_cen_x_L,
+                                      *step_cen_x_U,
+                                      *step_cen_s_L,
+                                      *step_cen_s_U,
+                                      *step_cen->y_c(),
+                                      *step_cen->y_d(),
+                                      *step_cen->z_L(),
+                                      *step_cen->z_U(),
+                                      *step_cen->v_L(),
+                                      *step_cen->v_U());
+        }
+        else {
+          sigma = PerformGoldenSection(sigma_up, -100., sigma_lo, qf_1,
+                                       quality_function_section_sigma_tol_,
+                                       quality_function_section_qf_tol_,
+                                       *step_aff_x_L,
+                                       *step_aff_x_U,
+                                       *step_aff_s_L,
+                                       *step_aff_s_U,
+                                       *step_aff->y_c(),
+                                       *step_aff->y_d(),
+                                       *step_aff->z_L(),
+                                       *step_aff->z_U(),
+                                       *step_aff->v_L(),
+                                       *step_aff->v_U(),
+                                       *step_cen_x_L,
+                                       *step_cen_x_U,
+                                       *step_cen_s_L,
+                                       *step_cen_s_U,
+                                       *step_cen->y_c(),
+                                       *step_cen->y_d(),
+                                       *step_cen->z_L(),
+                                       *step_cen->z_U(),
+                                       *step_cen->v_L(),
+                                       *step_cen->v_U());
+        }
       }
     }
     else {
@@ -443,29 +515,56 @@ namespace Ipopt
         sigma = sigma_lo;
       }
       else {
-        sigma = PerformGoldenSection(sigma_up, qf_1minus, sigma_lo, -100.,
-                                     quality_function_section_sigma_tol_,
-                                     quality_function_section_qf_tol_,
-                                     *step_aff_x_L,
-                                     *step_aff_x_U,
-                                     *step_aff_s_L,
-                                     *step_aff_s_U,
-                                     *step_aff->y_c(),
-                                     *step_aff->y_d(),
-                                     *step_aff->z_L(),
-                                     *step_aff->z_U(),
-                                     *step_aff->v_L(),
-                                     *step_aff->v_U(),
-                                     *step_cen_x_L,
-                                     *step_cen_x_U,
-                                     *step_cen_s_L,
-                                     *step_cen_s_U,
-                                     *step_cen->y_c(),
-                                     *step_cen->y_d(),
-                                     *step_cen->z_L(),
-                                     *step_cen->z_U(),
-                                     *step_cen->v_L(),
-                                     *step_cen->v_U());
+        if (quality_function_section_points_ > 1) {
+          sigma = PerformBatchSection(sigma_up, qf_1minus, sigma_lo, -100.,
+                                      quality_function_section_sigma_tol_,
+                                      quality_function_section_qf_tol_,
+                                      *step_aff_x_L,
+                                      *step_aff_x_U,
+                                      *step_aff_s_L,
+                                      *step_aff_s_U,
+                                      *step_aff->y_c(),
+                                      *step_aff->y_d(),
+                                      *step_aff->z_L(),
+                                      *step_aff->z_U(),
+                                      *step_aff->v_L(),
+                                      *step_aff->v_U(),
+                                      *step_cen_x_L,
+                                      *step_cen_x_U,
+                                      *step_cen_s_L,
+                                      *step_cen_s_U,
+                                      *step_cen->y_c(),
+                                      *step_cen->y_d(),
+                                      *step_cen->z_L(),
+                                      *step_cen->z_U(),
+                                      *step_cen->v_L(),
+                                      *step_cen->v_U());
+        }
+        else {
+          sigma = PerformGoldenSection(sigma_up, qf_1minus, sigma_lo, -100.,
+                                       quality_function_section_sigma_tol_,
+                                       quality_function_section_qf_tol_,
+                                       *step_aff_x_L,
+                                       *step_aff_x_U,
+                                       *step_aff_s_L,
+                                       *step_aff_s_U,
+                                       *step_aff->y_c(),
+                                       *step_aff->y_d(),
+                                       *step_aff->z_L(),
+                                       *step_aff->z_U(),
+                                       *step_aff->v_L(),
+                                       *step_aff->v_U(),
+                                       *step_cen_x_L,
+                                       *step_cen_x_U,
+                                       *step_cen_s_L,
+                                       *step_cen_s_U,
+                                       *step_cen->y_c(),
+                                       *step_cen->y_d(),
+                                       *step_cen->z_L(),
+                                       *step_cen->z_U(),
+                                       *step_cen->v_L(),
+                                       *step_cen->v_U());
+        }
       }
     }
 
@@ -553,6 +652,8 @@ namespace Ipopt
     curr_slack_s_L_ = NULL;
     curr_slack_s_U_ = NULL;
 
+    use_dense_eval_ = false;
+
     // DELETEME
     char ssigma[40];
     Snprintf(ssigma, 39, " sigma=%8.2e", sigma);
@@ -660,11 +761,53 @@ namespace Ipopt
     DBG_PRINT_VECTOR(2, "compl_s_L", *tmp_slack_s_L_);
     DBG_PRINT_VECTOR(2, "compl_s_U", *tmp_slack_s_U_);
 
-    Number dual_inf=-1.;
-    Number primal_inf=-1.;
     Number compl_inf=-1.;
 
     IpData().TimingStats().Task5().Start();
+    switch (quality_function_norm_) {
+    case NM_NORM_1:
+      compl_inf = tmp_slack_x_L_->Asum() + tmp_slack_x_U_->Asum() +
+                  tmp_slack_s_L_->Asum() + tmp_slack_s_U_->Asum();
+      break;
+    case NM_NORM_2_SQUARED:
+      compl_inf =
+        pow(tmp_slack_x_L_->Nrm2(), 2) + pow(tmp_slack_x_U_->Nrm2(), 2) +
+        pow(tmp_slack_s_L_->Nrm2(), 2) + pow(tmp_slack_s_U_->Nrm2(), 2);
+      break;
+    case NM_NORM_MAX:
+      compl_inf =
+        Max(tmp_slack_x_L_->Amax(), tmp_slack_x_U_->Amax(),
+            tmp_slack_s_L_->Amax(), tmp_slack_s_U_->Amax());
+      break;
+    case NM_NORM_2:
+      compl_inf =
+        sqrt(pow(tmp_slack_x_L_->Nrm2(), 2) + pow(tmp_slack_x_U_->Nrm2(), 2) +
+             pow(tmp_slack_s_L_->Nrm2(), 2) + pow(tmp_slack_s_U_->Nrm2(), 2));
+      break;
+    default:
+      DBG_ASSERT(false && "Unknown value for quality_function_norm_");
+    }
+    IpData().TimingStats().Task5().End();
+
+    if (quality_function_centrality_!=CEN_NONE) {
+      IpData().TimingStats().Task4().Start();
+      xi = IpCq().CalcCentralityMeasure(*tmp_slack_x_L_, *tmp_slack_x_U_,
+                                        *tmp_slack_s_L_, *tmp_slack_s_U_);
+      IpData().TimingStats().Task4().End();
+    }
+
+    return QualityFunctionValue(sigma, alpha_primal, alpha_dual, compl_inf, xi);
+  }
+
+  Number QualityFunctionMuOracle::QualityFunctionValue(Number sigma,
+      Number alpha_primal,
+      Number alpha_dual,
+      Number compl_inf,
+      Number xi)
+  {
+    Number dual_inf=-1.;
+    Number primal_inf=-1.;
+
     switch (quality_function_norm_) {
     case NM_NORM_1:
       dual_inf = (1.-alpha_dual)*(curr_grad_lag_x_asum_ +
@@ -673,9 +816,6 @@ namespace Ipopt
       primal_inf = (1.-alpha_primal)*(curr_c_asum_ +
                                       curr_d_minus_s_asum_);
 
-      compl_inf = tmp_slack_x_L_->Asum() + tmp_slack_x_U_->Asum() +
-                  tmp_slack_s_L_->Asum() + tmp_slack_s_U_->Asum();
-
       dual_inf /= n_dual_;
       if (n_pri_>0) {
         primal_inf /= n_pri_;
@@ -690,9 +830,6 @@ namespace Ipopt
       primal_inf =
         pow(1.-alpha_primal, 2)*(pow(curr_c_nrm2_, 2) +
                                  pow(curr_d_minus_s_nrm2_, 2));
-      compl_inf =
-        pow(tmp_slack_x_L_->Nrm2(), 2) + pow(tmp_slack_x_U_->Nrm2(), 2) +
-        pow(tmp_slack_s_L_->Nrm2(), 2) + pow(tmp_slack_s_U_->Nrm2(), 2);
 
       dual_inf /= n_dual_;
       if (n_pri_>0) {
@@ -708,9 +845,6 @@ namespace Ipopt
       primal_inf =
         (1.-alpha_primal)*Max(curr_c_amax_,
                               curr_d_minus_s_amax_);
-      compl_inf =
-        Max(tmp_slack_x_L_->Amax(), tmp_slack_x_U_->Amax(),
-            tmp_slack_s_L_->Amax(), tmp_slack_s_U_->Amax());
       break;
     case NM_NORM_2:
       dual_inf =
@@ -719,9 +853,6 @@ namespace Ipopt
       primal_inf =
         (1.-alpha_primal)*sqrt(pow(curr_c_nrm2_, 2) +
                                pow(curr_d_minus_s_nrm2_, 2));
-      compl_inf =
-        sqrt(pow(tmp_slack_x_L_->Nrm2(), 2) + pow(tmp_slack_x_U_->Nrm2(), 2) +
-             pow(tmp_slack_s_L_->Nrm2(), 2) + pow(tmp_slack_s_U_->Nrm2(), 2));
 
       dual_inf /= sqrt((Number)n_dual_);
       if (n_pri_>0) {
@@ -733,16 +864,9 @@ namespace Ipopt
     default:
       DBG_ASSERT(false && "Unknown value for quality_function_norm_");
     }
-    IpData().TimingStats().Task5().End();
 
     Number quality_function = dual_inf + primal_inf + compl_inf;
 
-    if (quality_function_centrality_!=CEN_NONE) {
-      IpData().TimingStats().Task4().Start();
-      xi = IpCq().CalcCentralityMeasure(*tmp_slack_x_L_, *tmp_slack_x_U_,
-                                        *tmp_slack_s_L_, *tmp_slack_s_U_);
-      IpData().TimingStats().Task4().End();
-    }
     switch (quality_function_centrality_) {
     case CEN_NONE:
       //Nothing
@@ -816,48 +940,34 @@ namespace Ipopt
     Number sigma_mid1 = sigma_lo + gfac*(sigma_up-sigma_lo);
     Number sigma_mid2 = sigma_lo + (1.-gfac)*(sigma_up-sigma_lo);
 
-    Number qmid1 = CalculateQualityFunction(UnscaleSigma(sigma_mid1),
-                                            step_aff_x_L,
-                                            step_aff_x_U,
-                                            step_aff_s_L,
-                                            step_aff_s_U,
-                                            step_aff_y_c,
-                                            step_aff_y_d,
-                                            step_aff_z_L,
-                                            step_aff_z_U,
-                                            step_aff_v_L,
-                                            step_aff_v_U,
-                                            step_cen_x_L,
-                                            step_cen_x_U,
-                                            step_cen_s_L,
-                                            step_cen_s_U,
-                                            step_cen_y_c,
-                                            step_cen_y_d,
-                                            step_cen_z_L,
-                                            step_cen_z_U,
-                                            step_cen_v_L,
-                                            step_cen_v_U);
-    Number qmid2 = CalculateQualityFunction(UnscaleSigma(sigma_mid2),
-                                            step_aff_x_L,
-                                            step_aff_x_U,
-                                            step_aff_s_L,
-                                            step_aff_s_U,
-                                            step_aff_y_c,
-                                            step_aff_y_d,
-                                            step_aff_z_L,
-                                            step_aff_z_U,
-                                            step_aff_v_L,
-                                            step_aff_v_U,
-                                            step_cen_x_L,
-                                            step_cen_x_U,
-                                            step_cen_s_L,
-                                            step_cen_s_U,
-                                            step_cen_y_c,
-                                            step_cen_y_d,
-                                            step_cen_z_L,
-                                            step_cen_z_U,
-                                            step_cen_v_L,
-                                            step_cen_v_U);
+    // The first two values are evaluated together
+    Number sigma_mid[2];
+    Number qmid[2];
+    sigma_mid[0] = UnscaleSigma(sigma_mid1);
+    sigma_mid[1] = UnscaleSigma(sigma_mid2);
+    CalculateQualityFunctions(2, sigma_mid, qmid,
+                              step_aff_x_L,
+                              step_aff_x_U,
+                              step_aff_s_L,
+                              step_aff_s_U,
+                              step_aff_y_c,
+                              step_aff_y_d,
+                              step_aff_z_L,
+                              step_aff_z_U,
+                              step_aff_v_L,
+                              step_aff_v_U,
+                              step_cen_x_L,
+                              step_cen_x_U,
+                              step_cen_s_L,
+                              step_cen_s_U,
+                              step_cen_y_c,
+                              step_cen_y_d,
+                              step_cen_z_L,
+                              step_cen_z_U,
+                              step_cen_v_L,
+                              step_cen_v_U);
+    Number qmid1 = qmid[0];
+    Number qmid2 = qmid[1];
 
     Index nsections = 0;
     while ((sigma_up-sigma_lo)>=sigma_tol*sigma_up &&
@@ -1024,6 +1134,469 @@ namespace Ipopt
     return UnscaleSigma(sigma);
   }
 
+  Number
+  QualityFunctionMuOracle::PerformBatchSection
+  (Number sigma_up_in,
+   Number q_up,
+   Number sigma_lo_in,
+   Number q_lo,
+   Number sigma_tol,
+   Number qf_tol,
+   const Vector& step_aff_x_L,
+   const Vector& step_aff_x_U,
+   const Vector& step_aff_s_L,
+   const Vector& step_aff_s_U,
+   const Vector& step_aff_y_c,
+   const Vector& step_aff_y_d,
+   const Vector& step_aff_z_L,
+   const Vector& step_aff_z_U,
+   const Vector& step_aff_v_L,
+   const Vector& step_aff_v_U,
+   const Vector& step_cen_x_L,
+   const Vector& step_cen_x_U,
+   const Vector& step_cen_s_L,
+   const Vector& step_cen_s_U,
+   const Vector& step_cen_y_c,
+   const Vector& step_cen_y_d,
+   const Vector& step_cen_z_L,
+   const Vector& step_cen_z_U,
+   const Vector& step_cen_v_L,
+   const Vector& step_cen_v_U
+  )
+  {
+    DBG_START_METH("QualityFunctionMuOracle::PerformBatchSection",
+                   dbg_verbosity);
+    const Index npoints = quality_function_section_points_;
+    DBG_ASSERT(npoints > 1);
+
+    Number sigma_up = ScaleSigma(sigma_up_in);
+    Number sigma_lo = ScaleSigma(sigma_lo_in);
+
+    std::vector<Number> sigma_pts(npoints);
+    std::vector<Number> unscaled_pts(npoints);
+    std::vector<Number> q_pts(npoints);
+
+    Number sigma = sigma_lo;
+    Number q = -1.;
+    Index nsections = 0;
+    while (true) {
+      // Evaluate npoints equally spaced values inside the interval
+      Number h = (sigma_up-sigma_lo)/(npoints+1);
+      for (Index i=0; i<npoints; i++) {
+        sigma_pts[i] = sigma_lo + (i+1)*h;
+        unscaled_pts[i] = UnscaleSigma(sigma_pts[i]);
+      }
+      CalculateQualityFunctions(npoints, &unscaled_pts[0], &q_pts[0],
+                                step_aff_x_L,
+                                step_aff_x_U,
+                                step_aff_s_L,
+                                step_aff_s_U,
+                                step_aff_y_c,
+                                step_aff_y_d,
+                                step_aff_z_L,
+                                step_aff_z_U,
+                                step_aff_v_L,
+                                step_aff_v_U,
+                                step_cen_x_L,
+                                step_cen_x_U,
+                                step_cen_s_L,
+                                step_cen_s_U,
+                                step_cen_y_c,
+                                step_cen_y_d,
+                                step_cen_z_L,
+                                step_cen_z_U,
+                                step_cen_v_L,
+                                step_cen_v_U);
+
+      Index imin = 0;
+      Number q_min = q_pts[0];
+      Number q_max = q_pts[0];
+      for (Index i=1; i<npoints; i++) {
+        if (q_pts[i] < q_min) {
+          q_min = q_pts[i];
+          imin = i;
+        }
+        q_max = Max(q_max, q_pts[i]);
+      }
+      if (q_lo >= 0.) {
+        q_max = Max(q_max, q_lo);
+      }
+      if (q_up >= 0.) {
+        q_max = Max(q_max, q_up);
+      }
+      sigma = sigma_pts[imin];
+      q = q_min;
+
+      // The new interval is given by the neighbors of the best value
+      if (imin > 0) {
+        sigma_lo = sigma_pts[imin-1];
+        q_lo = q_pts[imin-1];
+      }
+      if (imin < npoints-1) {
+        sigma_up = sigma_pts[imin+1];
+        q_up = q_pts[imin+1];
+      }
+
+      if ((sigma_up-sigma_lo)<sigma_tol*sigma_up) {
+        break;
+      }
+      if ((1.-q_min/q_max)<qf_tol) {
+        // The qf tolerance make it stop
+        IpData().Append_info_string("qf_tol ");
+        break;
+      }
+      if (nsections>=quality_function_max_section_steps_) {
+        break;
+      }
+      nsections++;
+    }
+
+    // Check the end of the original interval if it has not been left
+    if (sigma_up == ScaleSigma(sigma_up_in) ||
+        sigma_lo == ScaleSigma(sigma_lo_in)) {
+      Number sigma_end;
+      Number q_end;
+      if (sigma_up == ScaleSigma(sigma_up_in)) {
+        sigma_end = sigma_up;
+        q_end = q_up;
+      }
+      else {
+        sigma_end = sigma_lo;
+        q_end = q_lo;
+      }
+      if (q_end<0.) {
+        Number unscaled_end = UnscaleSigma(sigma_end);
+        CalculateQualityFunctions(1, &unscaled_end, &q_end,
+                                  step_aff_x_L,
+                                  step_aff_x_U,
+                                  step_aff_s_L,
+                                  step_aff_s_U,
+                                  step_aff_y_c,
+                                  step_aff_y_d,
+                                  step_aff_z_L,
+                                  step_aff_z_U,
+                                  step_aff_v_L,
+                                  step_aff_v_U,
+                                  step_cen_x_L,
+                                  step_cen_x_U,
+                                  step_cen_s_L,
+                                  step_cen_s_U,
+                                  step_cen_y_c,
+                                  step_cen_y_d,
+                                  step_cen_z_L,
+                                  step_cen_z_U,
+                                  step_cen_v_L,
+                                  step_cen_v_U);
+      }
+      if (q_end < q) {
+        sigma = sigma_end;
+        q = q_end;
+      }
+    }
+
+    return UnscaleSigma(sigma);
+  }
+
+  void QualityFunctionMuOracle::CalculateQualityFunctions
+  (Index n_sigma,
+   const Number* sigma,
+   Number* qf,
+   const Vector& step_aff_x_L,
+   const Vector& step_aff_x_U,
+   const Vector& step_aff_s_L,
+   const Vector& step_aff_s_U,
+   const Vector& step_aff_y_c,
+   const Vector& step_aff_y_d,
+   const Vector& step_aff_z_L,
+   const Vector& step_aff_z_U,
+   const Vector& step_aff_v_L,
+   const Vector& step_aff_v_U,
+   const Vector& step_cen_x_L,
+   const Vector& step_cen_x_U,
+   const Vector& step_cen_s_L,
+   const Vector& step_cen_s_U,
+   const Vector& step_cen_y_c,
+   const Vector& step_cen_y_d,
+   const Vector& step_cen_z_L,
+   const Vector& step_cen_z_U,
+   const Vector& step_cen_v_L,
+   const Vector& step_cen_v_U
+  )
+  {
+    DBG_START_METH("QualityFunctionMuOracle::CalculateQualityFunctions",
+                   dbg_verbosity);
+    if (!use_dense_eval_) {
+      for (Index k=0; k<n_sigma; k++) {
+        qf[k] = CalculateQualityFunction(sigma[k],
+                                         step_aff_x_L,
+                                         step_aff_x_U,
+                                         step_aff_s_L,
+                                         step_aff_s_U,
+                                         step_aff_y_c,
+                                         step_aff_y_d,
+                                         step_aff_z_L,
+                                         step_aff_z_U,
+                                         step_aff_v_L,
+                                         step_aff_v_U,
+                                         step_cen_x_L,
+                                         step_cen_x_U,
+                                         step_cen_s_L,
+                                         step_cen_s_U,
+                                         step_cen_y_c,
+                                         step_cen_y_d,
+                                         step_cen_z_L,
+                                         step_cen_z_U,
+                                         step_cen_v_L,
+                                         step_cen_v_U);
+      }
+      return;
+    }
+
+    count_qf_evals_ += n_sigma;
+
+    const Index n_tasks = (Index)task_block_.size();
+    task_results_.resize(4*n_sigma*Max(n_tasks, 1));
+
+    DenseEvalData data;
+    data.blocks = dense_blocks_;
+    data.task_block = n_tasks>0 ? &task_block_[0] : NULL;
+    data.task_begin = n_tasks>0 ? &task_begin_[0] : NULL;
+    data.task_end = n_tasks>0 ? &task_end_[0] : NULL;
+    data.n_sigma = n_sigma;
+    data.sigma = sigma;
+    data.tau = IpData().curr_tau();
+    data.results = &task_results_[0];
+
+    // First pass: fraction-to-the-boundary step sizes
+    IpData().TimingStats().Task2().Start();
+    if (IsValid(thread_pool_)) {
+      thread_pool_->Run(DenseFracToBoundTask, &data, n_tasks);
+    }
+    else {
+      for (Index t=0; t<n_tasks; t++) {
+        DenseFracToBoundTask(&data, t);
+      }
+    }
+    std::vector<Number> alpha_primal(n_sigma, 1.);
+    std::vector<Number> alpha_dual(n_sigma, 1.);
+    for (Index t=0; t<n_tasks; t++) {
+      const Number* res = data.results + 4*n_sigma*t;
+      for (Index k=0; k<n_sigma; k++) {
+        alpha_primal[k] = Min(alpha_primal[k], res[k]);
+        alpha_dual[k] = Min(alpha_dual[k], res[n_sigma+k]);
+      }
+    }
+    IpData().TimingStats().Task2().End();
+
+    // Second pass: complementarity at the resulting points
+    IpData().TimingStats().Task3().Start();
+    data.alpha_primal = &alpha_primal[0];
+    data.alpha_dual = &alpha_dual[0];
+    if (IsValid(thread_pool_)) {
+      thread_pool_->Run(DenseComplTask, &data, n_tasks);
+    }
+    else {
+      for (Index t=0; t<n_tasks; t++) {
+        DenseComplTask(&data, t);
+      }
+    }
+    IpData().TimingStats().Task3().End();
+
+    for (Index k=0; k<n_sigma; k++) {
+      Number compl_asum = 0.;
+      Number compl_sqsum = 0.;
+      Number compl_amax = 0.;
+      Number compl_min = 0.;
+      for (Index t=0; t<n_tasks; t++) {
+        const Number* res = data.results + 4*n_sigma*t;
+        compl_asum += res[k];
+        compl_sqsum += res[n_sigma+k];
+        compl_amax = Max(compl_amax, res[2*n_sigma+k]);
+        compl_min = (t==0) ? res[3*n_sigma+k] : Min(compl_min, res[3*n_sigma+k]);
+      }
+
+      Number compl_inf = -1.;
+      switch (quality_function_norm_) {
+      case NM_NORM_1:
+        compl_inf = compl_asum;
+        break;
+      case NM_NORM_2_SQUARED:
+        compl_inf = compl_sqsum;
+        break;
+      case NM_NORM_MAX:
+        compl_inf = compl_amax;
+        break;
+      case NM_NORM_2:
+        compl_inf = sqrt(compl_sqsum);
+        break;
+      default:
+        DBG_ASSERT(false && "Unknown value for quality_function_norm_");
+      }
+
+      // Centrality measure as in IpoptCalculatedQuantities::CalcCentralityMeasure
+      Number xi = 0.;
+      if (quality_function_centrality_!=CEN_NONE && n_comp_>0) {
+        xi = Min(1., compl_min/(compl_asum/n_comp_));
+      }
+
+      qf[k] = QualityFunctionValue(sigma[k], alpha_primal[k], alpha_dual[k],
+                                   compl_inf, xi);
+    }
+  }
+
+  /** Get the values of a vector if it is a DenseVector */
+  static bool GetDenseValues(const Vector& vec, const Number*& values)
+  {
+    const DenseVector* dense_vec = dynamic_cast<const DenseVector*>(&vec);
+    if (!dense_vec) {
+      return false;
+    }
+    values = dense_vec->ExpandedValues();
+    return true;
+  }
+
+  bool QualityFunctionMuOracle::SetupDenseEvaluation
+  (const Vector& step_aff_x_L,
+   const Vector& step_aff_x_U,
+   const Vector& step_aff_s_L,
+   const Vector& step_aff_s_U,
+   const Vector& step_aff_z_L,
+   const Vector& step_aff_z_U,
+   const Vector& step_aff_v_L,
+   const Vector& step_aff_v_U,
+   const Vector& step_cen_x_L,
+   const Vector& step_cen_x_U,
+   const Vector& step_cen_s_L,
+   const Vector& step_cen_s_U,
+   const Vector& step_cen_z_L,
+   const Vector& step_cen_z_U,
+   const Vector& step_cen_v_L,
+   const Vector& step_cen_v_U
+  )
+  {
+    DBG_START_METH("QualityFunctionMuOracle::SetupDenseEvaluation",
+                   dbg_verbosity);
+    const Vector* slack[4] = {GetRawPtr(curr_slack_x_L_),
+                              GetRawPtr(curr_slack_x_U_),
+                              GetRawPtr(curr_slack_s_L_),
+                              GetRawPtr(curr_slack_s_U_)
+                             };
+    const Vector* step_aff[4] = {&step_aff_x_L, &step_aff_x_U,
+                                 &step_aff_s_L, &step_aff_s_U
+                                };
+    const Vector* step_cen[4] = {&step_cen_x_L, &step_cen_x_U,
+                                 &step_cen_s_L, &step_cen_s_U
+                                };
+    const Vector* mult[4] = {GetRawPtr(curr_z_L_), GetRawPtr(curr_z_U_),
+                             GetRawPtr(curr_v_L_), GetRawPtr(curr_v_U_)
+                            };
+    const Vector* mult_aff[4] = {&step_aff_z_L, &step_aff_z_U,
+                                 &step_aff_v_L, &step_aff_v_U
+                                };
+    const Vector* mult_cen[4] = {&step_cen_z_L, &step_cen_z_U,
+                                 &step_cen_v_L, &step_cen_v_U
+                                };
+
+    task_block_.clear();
+    task_begin_.clear();
+    task_end_.clear();
+    for (Index b=0; b<4; b++) {
+      DenseBlock& block = dense_blocks_[b];
+      block.dim = slack[b]->Dim();
+      if (block.dim == 0) {
+        continue;
+      }
+      if (!GetDenseValues(*slack[b], block.slack) ||
+          !GetDenseValues(*step_aff[b], block.step_aff) ||
+          !GetDenseValues(*step_cen[b], block.step_cen) ||
+          !GetDenseValues(*mult[b], block.mult) ||
+          !GetDenseValues(*mult_aff[b], block.mult_aff) ||
+          !GetDenseValues(*mult_cen[b], block.mult_cen)) {
+        return false;
+      }
+      for (Index begin=0; begin<block.dim; begin+=dense_task_size) {
+        task_block_.push_back(b);
+        task_begin_.push_back(begin);
+        task_end_.push_back(Min(begin+dense_task_size, block.dim));
+      }
+    }
+    return true;
+  }
+
+  void QualityFunctionMuOracle::DenseFracToBoundTask(void* data, Index task)
+  {
+    DenseEvalData* eval_data = static_cast<DenseEvalData*>(data);
+    const DenseBlock& block = eval_data->blocks[eval_data->task_block[task]];
+    const Index n_sigma = eval_data->n_sigma;
+    const Number* sigma = eval_data->sigma;
+    const Number tau = eval_data->tau;
+    Number* alpha_primal = eval_data->results + 4*n_sigma*task;
+    Number* alpha_dual = alpha_primal + n_sigma;
+    for (Index k=0; k<n_sigma; k++) {
+      alpha_primal[k] = 1.;
+      alpha_dual[k] = 1.;
+    }
+
+    for (Index i=eval_data->task_begin[task]; i<eval_data->task_end[task]; i++) {
+      const Number slack = block.slack[i];
+      const Number step_aff = block.step_aff[i];
+      const Number step_cen = block.step_cen[i];
+      const Number mult = block.mult[i];
+      const Number mult_aff = block.mult_aff[i];
+      const Number mult_cen = block.mult_cen[i];
+      for (Index k=0; k<n_sigma; k++) {
+        Number step = step_aff + sigma[k]*step_cen;
+        if (step<0.) {
+          alpha_primal[k] = Min(alpha_primal[k], -tau/step * slack);
+        }
+        Number mult_step = mult_aff + sigma[k]*mult_cen;
+        if (mult_step<0.) {
+          alpha_dual[k] = Min(alpha_dual[k], -tau/mult_step * mult);
+        }
+      }
+    }
+  }
+
+  void QualityFunctionMuOracle::DenseComplTask(void* data, Index task)
+  {
+    DenseEvalData* eval_data = static_cast<DenseEvalData*>(data);
+    const DenseBlock& block = eval_data->blocks[eval_data->task_block[task]];
+    const Index n_sigma = eval_data->n_sigma;
+    const Number* sigma = eval_data->sigma;
+    const Number* alpha_primal = eval_data->alpha_primal;
+    const Number* alpha_dual = eval_data->alpha_dual;
+    Number* compl_asum = eval_data->results + 4*n_sigma*task;
+    Number* compl_sqsum = compl_asum + n_sigma;
+    Number* compl_amax = compl_sqsum + n_sigma;
+    Number* compl_min = compl_amax + n_sigma;
+    const Index begin = eval_data->task_begin[task];
+    for (Index k=0; k<n_sigma; k++) {
+      compl_asum[k] = 0.;
+      compl_sqsum[k] = 0.;
+      compl_amax[k] = 0.;
+      compl_min[k] = std::numeric_limits<Number>::max();
+    }
+
+    for (Index i=begin; i<eval_data->task_end[task]; i++) {
+      const Number slack = block.slack[i];
+      const Number step_aff = block.step_aff[i];
+      const Number step_cen = block.step_cen[i];
+      const Number mult = block.mult[i];
+      const Number mult_aff = block.mult_aff[i];
+      const Number mult_cen = block.mult_cen[i];
+      for (Index k=0; k<n_sigma; k++) {
+        Number cmpl =
+          (slack + alpha_primal[k]*(step_aff + sigma[k]*step_cen)) *
+          (mult + alpha_dual[k]*(mult_aff + sigma[k]*mult_cen));
+        Number abs_compl = fabs(cmpl);
+        compl_asum[k] += abs_compl;
+        compl_sqsum[k] += cmpl*cmpl;
+        compl_amax[k] = Max(compl_amax[k], abs_compl);
+        compl_min[k] = Min(compl_min[k], cmpl);
+      }
+    }
+  }
+
   /*
   Number QualityFunctionMuOracle::ScaleSigma(Number sigma) {return log(sigma);}
   Number QualityFunctionMuOracle::UnscaleSigma(Number scaled_sigma) {return exp(scaled_sigma);}
@@ -12,6 +12,9 @@
 #include "IpMuOracle.hpp"
 #include "IpPDSystemSolver.hpp"
 #include "IpIpoptCalculatedQuantities.hpp"
+#include "IpThreadPool.hpp"
+
+#include <vector>
 
 namespace Ipopt
 {
@@ -121,6 +124,65 @@ namespace Ipopt
                                     const Vector& step_cen_v_L,
                                     const Vector& step_cen_v_U);
 
+    /** Auxilliary function for computing the quality function for
+     *  n_sigma values of sigma at once.  If all vectors are dense,
+     *  this is done in two passes over the vectors for all values
+     *  together; otherwise CalculateQualityFunction is called for
+     *  each value. */
+    void CalculateQualityFunctions(Index n_sigma,
+                                   const Number* sigma,
+                                   Number* qf,
+                                   const Vector& step_aff_x_L,
+                                   const Vector& step_aff_x_U,
+                                   const Vector& step_aff_s_L,
+                                   const Vector& step_aff_s_U,
+                                   const Vector& step_aff_y_c,
+                                   const Vector& step_aff_y_d,
+                                   const Vector& step_aff_z_L,
+                                   const Vector& step_aff_z_U,
+                                   const Vector& step_aff_v_L,
+                                   const Vector& step_aff_v_U,
+                                   const Vector& step_cen_x_L,
+                                   const Vector& step_cen_x_U,
+                                   const Vector& step_cen_s_L,
+                                   const Vector& step_cen_s_U,
+                                   const Vector& step_cen_y_c,
+                                   const Vector& step_cen_y_d,
+                                   const Vector& step_cen_z_L,
+                                   const Vector& step_cen_z_U,
+                                   const Vector& step_cen_v_L,
+                                   const Vector& step_cen_v_U);
+
+    /** Auxilliary function computing the quality function from the
+     *  step sizes, the norm of the complementarity (before the
+     *  division by the number of entries), and the centrality
+     *  measure xi */
+    Number QualityFunctionValue(Number sigma,
+                                Number alpha_primal,
+                                Number alpha_dual,
+                                Number compl_inf,
+                                Number xi);
+
+    /** Auxilliary function that collects the values of the dense
+     *  vectors for CalculateQualityFunctions.  Returns false if one of
+     *  the vectors is not a DenseVector. */
+    bool SetupDenseEvaluation(const Vector& step_aff_x_L,
+                              const Vector& step_aff_x_U,
+                              const Vector& step_aff_s_L,
+                              const Vector& step_aff_s_U,
+                              const Vector& step_aff_z_L,
+                              const Vector& step_aff_z_U,
+                              const Vector& step_aff_v_L,
+                              const Vector& step_aff_v_U,
+                              const Vector& step_cen_x_L,
+                              const Vector& step_cen_x_U,
+                              const Vector& step_cen_s_L,
+                              const Vector& step_cen_s_U,
+                              const Vector& step_cen_z_L,
+                              const Vector& step_cen_z_U,
+                              const Vector& step_cen_v_L,
+                              const Vector& step_cen_v_U);
+
     /** Auxilliary function performing the golden section */
     Number PerformGoldenSection(Number sigma_up,
                                 Number q_up,
@@ -149,6 +211,36 @@ namespace Ipopt
                                 const Vector& step_cen_v_L,
                                 const Vector& step_cen_v_U);
 
+    /** Auxilliary function performing a section search that
+     *  evaluates quality_function_section_points values of sigma in
+     *  each step */
+    Number PerformBatchSection(Number sigma_up,
+                               Number q_up,
+                               Number sigma_lo,
+                               Number q_lo,
+                               Number sigma_tol,
+                               Number qf_tol,
+                               const Vector& step_aff_x_L,
+                               const Vector& step_aff_x_U,
+                               const Vector& step_aff_s_L,
+                               const Vector& step_aff_s_U,
+                               const Vector& step_aff_y_c,
+                               const Vector& step_aff_y_d,
+                               const Vector& step_aff_z_L,
+                               const Vector& step_aff_z_U,
+                               const Vector& step_aff_v_L,
+                               const Vector& step_aff_v_U,
+                               const Vector& step_cen_x_L,
+                               const Vector& step_cen_x_U,
+                               const Vector& step_cen_s_L,
+                               const Vector& step_cen_s_U,
+                               const Vector& step_cen_y_c,
+                               const Vector& step_cen_y_d,
+                               const Vector& step_cen_z_L,
+                               const Vector& step_cen_z_U,
+                               const Vector& step_cen_v_L,
+                               const Vector& step_cen_v_U);
+
     /** Auxilliary functions for scaling the sigma axis in the golden
      *  section procedure */
     //@{
@@ -208,6 +300,71 @@ namespace Ipopt
     /** Maximal number of bi-section steps in the golden section
      *  search for sigma. */
     Index quality_function_max_section_steps_;
+    /** Number of values of sigma evaluated in one step of the section
+     *  search.  If this is 1, the golden section search is used. */
+    Index quality_function_section_points_;
+    /** Number of threads that evaluate the quality function. */
+    Index quality_function_threads_;
+    //@}
+
+    /** Thread pool for the evaluation of the quality function, NULL
+     *  if quality_function_threads is 1 */
+    SmartPtr<ThreadPool> thread_pool_;
+
+    /** @name Data for the evaluation of the quality function directly
+     *  on the values of dense vectors. */
+    //@{
+    /** Values of the slacks and multipliers for one kind of bounds
+     *  (x_L, x_U, s_L, or s_U), and of their affine scaling and
+     *  centering steps */
+    struct DenseBlock
+    {
+      Index dim;
+      const Number* slack;
+      const Number* step_aff;
+      const Number* step_cen;
+      const Number* mult;
+      const Number* mult_aff;
+      const Number* mult_cen;
+    };
+
+    /** Data given to the tasks of the dense evaluation */
+    struct DenseEvalData
+    {
+      const DenseBlock* blocks;
+      const Index* task_block;
+      const Index* task_begin;
+      const Index* task_end;
+      Index n_sigma;
+      const Number* sigma;
+      Number tau;
+      const Number* alpha_primal;
+      const Number* alpha_dual;
+      /** 4*n_sigma results for each task */
+      Number* results;
+    };
+
+    /** Task computing the fraction-to-the-boundary step sizes for one
+     *  part of a block */
+    static void DenseFracToBoundTask(void* data, Index task);
+
+    /** Task computing the norms and the minimum of the
+     *  complementarity for one part of a block */
+    static void DenseComplTask(void* data, Index task);
+
+    /** Flag indicating whether the dense evaluation can be used in
+     *  the current call of CalculateMu */
+    bool use_dense_eval_;
+    /** Blocks for x_L, x_U, s_L, and s_U */
+    DenseBlock dense_blocks_[4];
+    /** Block and range of entries for each task */
+    //@{
+    std::vector<Index> task_block_;
+    std::vector<Index> task_begin_;
+    std::vector<Index> task_end_;
+    //@}
+    /** Results of the tasks */
+    std::vector<Number> task_results_;
     //@}
 
     /** @name Temporary work space vectors.  We use those to avoid
@@ -113,6 +113,10 @@ namespace Ipopt
      *  as equalities with slacks */
     virtual SmartPtr<const Vector> d(const Vector& x);
 
+    /** Evaluate f, c, and d at several points with one call of the
+     *  NLP (see IpoptNLP::Prefetch_f_c_d) */
+    virtual bool Prefetch_f_c_d(const std::vector<SmartPtr<const Vector> >& x);
+
     /** Jacobian Matrix for inequality constraints */
     virtual SmartPtr<const Matrix> jac_d(const Vector& x);
 
@@ -384,6 +388,8 @@ namespace Ipopt
     /** Scaling factors for the \$x\$ part of the regularization term */
     SmartPtr<Vector> dr_x_;
     SmartPtr<DiagMatrix> DR_x_; //TODO We can get rid of one of the dr DR
+    /** Space for DR_x_ */
+    SmartPtr<DiagMatrixSpace> DR_x_space_;
     /** \$x\$ part of the reference point in the regularization term */
     SmartPtr<Vector> x_ref_;
     //@}
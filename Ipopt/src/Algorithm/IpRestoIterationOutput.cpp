@@ -54,7 +54,10 @@ namespace Ipopt
       retval = resto_orig_iteration_output_->Initialize(Jnlst(), IpNLP(),
                IpData(), IpCq(),
                options, prefix);
+      // The record for the iteration trace is written here
+      resto_orig_iteration_output_->DisableTrace();
     }
+    InitializeTrace();
     return retval;
   }
 
@@ -182,6 +185,8 @@ namespace Ipopt
       IpData().Inc_info_iters_since_header();
     }
 
+    WriteTraceRecord(true, f, inf_pr, inf_du, *orig_ip_nlp);
+
     //////////////////////////////////////////////////////////////////////
     //           Now if desired more detail on the iterates             //
     //////////////////////////////////////////////////////////////////////
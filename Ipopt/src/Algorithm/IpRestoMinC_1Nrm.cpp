@@ -102,6 +102,9 @@ namespace Ipopt
     }
 
     count_restorations_ = 0;
+    resto_ip_data_ = NULL;
+    resto_ip_nlp_ = NULL;
+    resto_ip_cq_ = NULL;
 
     bool retvalue = true;
     if (IsValid(eq_mult_calculator_)) {
@@ -125,14 +128,18 @@ namespace Ipopt
 
     DBG_ASSERT(IpCq().curr_constraint_violation()>0.);
 
-    // ToDo set those up during initialize?
-    // Create the restoration phase NLP etc objects
-    SmartPtr<IpoptData> resto_ip_data =
-      new IpoptData(NULL, IpData().cpu_time_start());
-    SmartPtr<IpoptNLP> resto_ip_nlp =
-      new RestoIpoptNLP(IpNLP(), IpData(), IpCq());
-    SmartPtr<IpoptCalculatedQuantities> resto_ip_cq =
-      new IpoptCalculatedQuantities(resto_ip_nlp, resto_ip_data);
+    // Create the restoration phase NLP etc objects the first time the
+    // restoration phase is entered.  Later they are initialized again
+    // for the current point, but RestoIpoptNLP keeps its spaces.
+    if (IsNull(resto_ip_data_)) {
+      resto_ip_data_ = new IpoptData(NULL, IpData().cpu_time_start());
+      resto_ip_nlp_ = new RestoIpoptNLP(IpNLP(), IpData(), IpCq());
+      resto_ip_cq_ =
+        new IpoptCalculatedQuantities(resto_ip_nlp_, resto_ip_data_);
+    }
+    SmartPtr<IpoptData> resto_ip_data = resto_ip_data_;
+    SmartPtr<IpoptNLP> resto_ip_nlp = resto_ip_nlp_;
+    SmartPtr<IpoptCalculatedQuantities> resto_ip_cq = resto_ip_cq_;
 
     // Determine if this is a square problem
     bool square_problem = IpCq().IsSquareProblem();
@@ -164,12 +171,16 @@ namespace Ipopt
     // Set iteration counter and info field for the restoration phase
     resto_ip_data->Set_iter_count(IpData().iter_count()+1);
     resto_ip_data->Set_info_regu_x(IpData().info_regu_x());
+    resto_ip_data->Set_info_regu_c(IpData().info_regu_c());
     resto_ip_data->Set_info_alpha_primal(IpData().info_alpha_primal());
     resto_ip_data->Set_info_alpha_primal_char(IpData().info_alpha_primal_char());
     resto_ip_data->Set_info_alpha_dual(IpData().info_alpha_dual());
     resto_ip_data->Set_info_ls_count(IpData().info_ls_count());
     resto_ip_data->Set_info_iters_since_header(IpData().info_iters_since_header());
     resto_ip_data->Set_info_last_output(IpData().info_last_output());
+    // The restoration phase has to stop at the deadline of the
+    // regular algorithm
+    resto_ip_data->Set_wall_time_deadline(IpData().wall_time_deadline());
 
     // Call the optimization algorithm to solve the restoration phase
     // problem
@@ -282,6 +293,10 @@ namespace Ipopt
       THROW_EXCEPTION(RESTORATION_CPUTIME_EXCEEDED,
                       "Maximal CPU time exceeded in restoration phase.");
     }
+    else if (resto_status == WALLTIME_EXCEEDED) {
+      THROW_EXCEPTION(RESTORATION_WALLTIME_EXCEEDED,
+                      "Maximal wallclock time exceeded in restoration phase.");
+    }
     else if (resto_status == LOCAL_INFEASIBILITY) {
       // converged to locally infeasible point - pass this on to the outer algorithm...
       THROW_EXCEPTION(LOCALLY_INFEASIBLE, "Restoration phase converged to a point of local infeasibility");
@@ -78,6 +78,15 @@ namespace Ipopt
      *  started. */
     SmartPtr<OptionsList> resto_options_;
 
+    /** @name Objects of the restoration phase problem.  They are
+     *  created when the restoration phase is entered for the first
+     *  time and reused when it is entered again. */
+    //@{
+    SmartPtr<IpoptData> resto_ip_data_;
+    SmartPtr<IpoptNLP> resto_ip_nlp_;
+    SmartPtr<IpoptCalculatedQuantities> resto_ip_cq_;
+    //@}
+
     /** @name Algorithmic parameters */
     //@{
     Number constr_mult_reset_threshold_;
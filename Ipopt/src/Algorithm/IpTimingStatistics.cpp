@@ -10,6 +10,38 @@
 
 namespace Ipopt
 {
+  TimingStatistics::TimingStatistics()
+  {
+    OverallAlgorithm_.SetTraceName("OverallAlgorithm");
+    PrintProblemStatistics_.SetTraceName("PrintProblemStatistics");
+    InitializeIterates_.SetTraceName("InitializeIterates");
+    UpdateHessian_.SetTraceName("UpdateHessian");
+    OutputIteration_.SetTraceName("OutputIteration");
+    UpdateBarrierParameter_.SetTraceName("UpdateBarrierParameter");
+    ComputeSearchDirection_.SetTraceName("ComputeSearchDirection");
+    ComputeAcceptableTrialPoint_.SetTraceName("ComputeAcceptableTrialPoint");
+    AcceptTrialPoint_.SetTraceName("AcceptTrialPoint");
+    CheckConvergence_.SetTraceName("CheckConvergence");
+    PDSystemSolverTotal_.SetTraceName("PDSystemSolverTotal");
+    PDSystemSolverSolveOnce_.SetTraceName("PDSystemSolverSolveOnce");
+    ComputeResiduals_.SetTraceName("ComputeResiduals");
+    StdAugSystemSolverMultiSolve_.SetTraceName("StdAugSystemSolverMultiSolve");
+    LinearSystemScaling_.SetTraceName("LinearSystemScaling");
+    LinearSystemSymbolicFactorization_.SetTraceName("LinearSystemSymbolicFactorization");
+    LinearSystemFactorization_.SetTraceName("LinearSystemFactorization");
+    LinearSystemBackSolve_.SetTraceName("LinearSystemBackSolve");
+    LinearSystemStructureConverter_.SetTraceName("LinearSystemStructureConverter");
+    LinearSystemStructureConverterInit_.SetTraceName("LinearSystemStructureConverterInit");
+    QualityFunctionSearch_.SetTraceName("QualityFunctionSearch");
+    TryCorrector_.SetTraceName("TryCorrector");
+    Task1_.SetTraceName("Task1");
+    Task2_.SetTraceName("Task2");
+    Task3_.SetTraceName("Task3");
+    Task4_.SetTraceName("Task4");
+    Task5_.SetTraceName("Task5");
+    Task6_.SetTraceName("Task6");
+  }
+
   void
   TimingStatistics::ResetTimes()
   {
@@ -43,6 +75,39 @@ namespace Ipopt
     Task6_.Reset();
   }
 
+  void
+  TimingStatistics::GetSnapshot(std::vector<TimedTaskSnapshot>& snapshot) const
+  {
+    snapshot.push_back(OverallAlgorithm_.Snapshot("OverallAlgorithm"));
+    snapshot.push_back(PrintProblemStatistics_.Snapshot("PrintProblemStatistics"));
+    snapshot.push_back(InitializeIterates_.Snapshot("InitializeIterates"));
+    snapshot.push_back(UpdateHessian_.Snapshot("UpdateHessian"));
+    snapshot.push_back(OutputIteration_.Snapshot("OutputIteration"));
+    snapshot.push_back(UpdateBarrierParameter_.Snapshot("UpdateBarrierParameter"));
+    snapshot.push_back(ComputeSearchDirection_.Snapshot("ComputeSearchDirection"));
+    snapshot.push_back(ComputeAcceptableTrialPoint_.Snapshot("ComputeAcceptableTrialPoint"));
+    snapshot.push_back(AcceptTrialPoint_.Snapshot("AcceptTrialPoint"));
+    snapshot.push_back(CheckConvergence_.Snapshot("CheckConvergence"));
+    snapshot.push_back(PDSystemSolverTotal_.Snapshot("PDSystemSolverTotal"));
+    snapshot.push_back(PDSystemSolverSolveOnce_.Snapshot("PDSystemSolverSolveOnce"));
+    snapshot.push_back(ComputeResiduals_.Snapshot("ComputeResiduals"));
+    snapshot.push_back(StdAugSystemSolverMultiSolve_.Snapshot("StdAugSystemSolverMultiSolve"));
+    snapshot.push_back(LinearSystemScaling_.Snapshot("LinearSystemScaling"));
+    snapshot.push_back(LinearSystemSymbolicFactorization_.Snapshot("LinearSystemSymbolicFactorization"));
+    snapshot.push_back(LinearSystemFactorization_.Snapshot("LinearSystemFactorization"));
+    snapshot.push_back(LinearSystemBackSolve_.Snapshot("LinearSystemBackSolve"));
+    snapshot.push_back(LinearSystemStructureConverter_.Snapshot("LinearSystemStructureConverter"));
+    snapshot.push_back(LinearSystemStructureConverterInit_.Snapshot("LinearSystemStructureConverterInit"));
+    snapshot.push_back(QualityFunctionSearch_.Snapshot("QualityFunctionSearch"));
+    snapshot.push_back(TryCorrector_.Snapshot("TryCorrector"));
+    snapshot.push_back(Task1_.Snapshot("Task1"));
+    snapshot.push_back(Task2_.Snapshot("Task2"));
+    snapshot.push_back(Task3_.Snapshot("Task3"));
+    snapshot.push_back(Task4_.Snapshot("Task4"));
+    snapshot.push_back(Task5_.Snapshot("Task5"));
+    snapshot.push_back(Task6_.Snapshot("Task6"));
+  }
+
   void
   TimingStatistics::PrintAllTimingStatistics(
     Journalist& jnlst,
@@ -13,6 +13,8 @@
 #include "IpJournalist.hpp"
 #include "IpTimedTask.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
   /** This class collects all timing statistics for Ipopt.
@@ -22,9 +24,9 @@ namespace Ipopt
   public:
     /**@name Constructors/Destructors */
     //@{
-    /** Default constructor. */
-    TimingStatistics()
-    {}
+    /** Default constructor.  The names of the tasks for the
+     *  TraceRecorder are set here. */
+    TimingStatistics();
 
     /** Default destructor */
     virtual ~TimingStatistics()
@@ -39,6 +41,12 @@ namespace Ipopt
                                   EJournalLevel level,
                                   EJournalCategory category) const;
 
+    /** Method for taking a snapshot of the times and numbers of
+     *  calls of all timed tasks.  The entries are appended to
+     *  snapshot, with the names used in PrintAllTimingStatistics.
+     *  This can be called at any time during the optimization. */
+    void GetSnapshot(std::vector<TimedTaskSnapshot>& snapshot) const;
+
     /**@name Accessor methods to all timed tasks. */
     //@{
     TimedTask& OverallAlgorithm()
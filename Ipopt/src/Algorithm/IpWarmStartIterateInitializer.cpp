@@ -131,7 +131,12 @@ namespace Ipopt
     SmartPtr<IteratesVector> init_vec;
     bool have_iterate = false;
 
-    if (warm_start_entire_iterate_) {
+    // A warm start snapshot given to IpoptData takes precedence over
+    // the iterate provided by the NLP
+    SmartPtr<const WarmStartSnapshot> snapshot =
+      IpData().GetWarmStartSnapshot();
+
+    if (IsValid(snapshot) || warm_start_entire_iterate_) {
       if (!IpData().InitializeDataStructures(IpNLP(), false, false, false,
                                              false, false)) {
         return false;
@@ -139,12 +144,45 @@ namespace Ipopt
 
       init_vec = IpData().curr()->MakeNewIteratesVector(true);
 
-      have_iterate = IpNLP().GetWarmStartIterate(*init_vec);
+      if (IsValid(snapshot)) {
+        // The values in the snapshot are scaled, so they can only be
+        // used if the scaling determined for this problem is the same
+        if (!snapshot->HasSameScaling(*IpNLP().NLP_scaling(), *init_vec)) {
+          Jnlst().Printf(J_WARNING, J_INITIALIZATION,
+                         "WARNING: Warm start snapshot was taken with a different scaling of the problem and is ignored.\n");
+        }
+        else {
+          have_iterate = snapshot->PutInto(*init_vec);
+          if (!have_iterate) {
+            Jnlst().Printf(J_WARNING, J_INITIALIZATION,
+                           "WARNING: Warm start snapshot does not match the dimensions of the problem and is ignored.\n");
+          }
+        }
 
-      if (!have_iterate) {
-        Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
-                       "Tried to obtain entire warm start iterate from NLP, but it returned false.\n");
-        IpData().Append_info_string("NW");
+        if (have_iterate) {
+          // Continue with the barrier parameters of the snapshot
+          if (snapshot->mu() > 0.) {
+            IpData().Set_mu(snapshot->mu());
+          }
+          if (snapshot->tau() > 0.) {
+            IpData().Set_tau(snapshot->tau());
+          }
+        }
+        else {
+          // Make sure that the rest of the algorithm does not use
+          // the snapshot either
+          IpData().SetWarmStartSnapshot(NULL);
+        }
+      }
+
+      if (!have_iterate && warm_start_entire_iterate_) {
+        have_iterate = IpNLP().GetWarmStartIterate(*init_vec);
+
+        if (!have_iterate) {
+          Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
+                         "Tried to obtain entire warm start iterate from NLP, but it returned false.\n");
+          IpData().Append_info_string("NW");
+        }
       }
 
       // Make sure given bounds are respected
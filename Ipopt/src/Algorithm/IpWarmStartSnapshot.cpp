@@ -0,0 +1,380 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpWarmStartSnapshot.hpp"
+#include "IpTripletHelper.hpp"
+#include "IpNLPScaling.hpp"
+#include "IpMultiVectorMatrix.hpp"
+
+#include <iomanip>
+#include <string>
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  /** Keyword in the first line of a written snapshot */
+  static const char* snapshot_keyword = "IPOPT_WARM_START_SNAPSHOT";
+
+  /** Version of the format of a written snapshot */
+  static const Index snapshot_version = 3;
+
+  /** Names of the components of an iterate, in the order of the
+   *  IteratesVector */
+  static const char* comp_names[] = {
+    "x", "s", "y_c", "y_d", "z_L", "z_U", "v_L", "v_U"
+  };
+
+  /** Names of the scaling factors for x, c, and d */
+  static const char* scaling_names[] = {
+    "scaling_x", "scaling_c", "scaling_d"
+  };
+
+  /** Relative tolerance for comparing scaling factors */
+  static const Number scaling_rel_tol = 1e-12;
+
+  static bool SameScalingFactor(Number a, Number b)
+  {
+    return fabs(a - b) <= scaling_rel_tol*Max(fabs(a), fabs(b));
+  }
+
+  WarmStartSnapshot::WarmStartSnapshot()
+      :
+      have_values_(false),
+      have_scaling_(false),
+      obj_scaling_(1.),
+      mu_(-1.),
+      tau_(-1.),
+      lm_length_(0),
+      lm_dim_(0),
+      lm_sigma_(-1.)
+  {
+    pd_pert_state_.valid = false;
+  }
+
+  WarmStartSnapshot::~WarmStartSnapshot()
+  {}
+
+  void WarmStartSnapshot::TakeFrom(const IteratesVector& iterates,
+                                   Number mu, Number tau)
+  {
+    DBG_START_METH("WarmStartSnapshot::TakeFrom", dbg_verbosity);
+    DBG_ASSERT(iterates.NComps() == N_COMPS);
+    for (Index i=0; i<N_COMPS; i++) {
+      SmartPtr<const Vector> comp = iterates.GetComp(i);
+      Index dim = comp->Dim();
+      values_[i].resize(dim);
+      if (dim > 0) {
+        TripletHelper::FillValuesFromVector(dim, *comp, &values_[i][0]);
+      }
+    }
+    mu_ = mu;
+    tau_ = tau;
+    have_values_ = true;
+    have_scaling_ = false;
+  }
+
+  void WarmStartSnapshot::GetScaling(NLPScalingObject& scaling,
+                                     const IteratesVector& iterates,
+                                     Number& obj_scaling,
+                                     std::vector<Number>* scaling_factors)
+  {
+    obj_scaling = scaling.apply_obj_scaling(1.);
+
+    SmartPtr<const Vector> comps[N_SCALINGS];
+    SmartPtr<Vector> ones = iterates.x()->MakeNew();
+    ones->Set(1.);
+    comps[0] = scaling.apply_vector_scaling_x(ConstPtr(ones));
+    ones = iterates.y_c()->MakeNew();
+    ones->Set(1.);
+    comps[1] = scaling.apply_vector_scaling_c(ConstPtr(ones));
+    ones = iterates.y_d()->MakeNew();
+    ones->Set(1.);
+    comps[2] = scaling.apply_vector_scaling_d(ConstPtr(ones));
+
+    for (Index i=0; i<N_SCALINGS; i++) {
+      Index dim = comps[i]->Dim();
+      scaling_factors[i].resize(dim);
+      if (dim > 0) {
+        TripletHelper::FillValuesFromVector(dim, *comps[i],
+                                            &scaling_factors[i][0]);
+      }
+    }
+  }
+
+  void WarmStartSnapshot::TakeScalingFrom(NLPScalingObject& scaling,
+                                          const IteratesVector& iterates)
+  {
+    DBG_START_METH("WarmStartSnapshot::TakeScalingFrom", dbg_verbosity);
+    GetScaling(scaling, iterates, obj_scaling_, scaling_factors_);
+    have_scaling_ = true;
+  }
+
+  bool WarmStartSnapshot::HasSameScaling(NLPScalingObject& scaling,
+                                         const IteratesVector& iterates) const
+  {
+    DBG_START_METH("WarmStartSnapshot::HasSameScaling", dbg_verbosity);
+    if (!have_scaling_) {
+      return true;
+    }
+
+    Number obj_scaling;
+    std::vector<Number> scaling_factors[N_SCALINGS];
+    GetScaling(scaling, iterates, obj_scaling, scaling_factors);
+
+    if (!SameScalingFactor(obj_scaling, obj_scaling_)) {
+      return false;
+    }
+    for (Index i=0; i<N_SCALINGS; i++) {
+      if (scaling_factors[i].size() != scaling_factors_[i].size()) {
+        return false;
+      }
+      for (size_t j=0; j<scaling_factors[i].size(); j++) {
+        if (!SameScalingFactor(scaling_factors[i][j],
+                               scaling_factors_[i][j])) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool WarmStartSnapshot::PutInto(IteratesVector& iterates) const
+  {
+    DBG_START_METH("WarmStartSnapshot::PutInto", dbg_verbosity);
+    if (!have_values_ || iterates.NComps() != N_COMPS) {
+      return false;
+    }
+    for (Index i=0; i<N_COMPS; i++) {
+      if (iterates.GetComp(i)->Dim() != (Index)values_[i].size()) {
+        return false;
+      }
+    }
+    for (Index i=0; i<N_COMPS; i++) {
+      if (!values_[i].empty()) {
+        SmartPtr<Vector> comp = iterates.GetCompNonConst(i);
+        TripletHelper::PutValuesInVector(comp->Dim(), &values_[i][0], *comp);
+      }
+    }
+    return true;
+  }
+
+  void WarmStartSnapshot::SetLimMemHistory(const MultiVectorMatrix& S,
+      const MultiVectorMatrix& Y,
+      Number sigma)
+  {
+    DBG_START_METH("WarmStartSnapshot::SetLimMemHistory", dbg_verbosity);
+    DBG_ASSERT(S.NCols() == Y.NCols());
+    lm_length_ = S.NCols();
+    lm_dim_ = S.NRows();
+    lm_sigma_ = sigma;
+    lm_s_.resize(lm_length_*lm_dim_);
+    lm_y_.resize(lm_length_*lm_dim_);
+    if (lm_dim_ > 0) {
+      for (Index i=0; i<lm_length_; i++) {
+        TripletHelper::FillValuesFromVector(lm_dim_, *S.GetVector(i),
+                                            &lm_s_[i*lm_dim_]);
+        TripletHelper::FillValuesFromVector(lm_dim_, *Y.GetVector(i),
+                                            &lm_y_[i*lm_dim_]);
+      }
+    }
+  }
+
+  bool WarmStartSnapshot::GetLimMemPair(Index i, Vector& s, Vector& y) const
+  {
+    DBG_ASSERT(i >= 0 && i < lm_length_);
+    if (s.Dim() != lm_dim_ || y.Dim() != lm_dim_) {
+      return false;
+    }
+    if (lm_dim_ > 0) {
+      TripletHelper::PutValuesInVector(lm_dim_, &lm_s_[i*lm_dim_], s);
+      TripletHelper::PutValuesInVector(lm_dim_, &lm_y_[i*lm_dim_], y);
+    }
+    return true;
+  }
+
+  bool WarmStartSnapshot::Write(std::ostream& os) const
+  {
+    if (!have_values_) {
+      return false;
+    }
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::scientific << std::setprecision(17);
+
+    os << snapshot_keyword << " " << snapshot_version << "\n";
+    os << "mu " << mu_ << "\n";
+    os << "tau " << tau_ << "\n";
+    for (Index i=0; i<N_COMPS; i++) {
+      os << comp_names[i] << " " << values_[i].size() << "\n";
+      for (size_t j=0; j<values_[i].size(); j++) {
+        os << values_[i][j] << "\n";
+      }
+    }
+    os << "scaling " << (have_scaling_ ? 1 : 0) << "\n";
+    if (have_scaling_) {
+      os << "obj_scaling " << obj_scaling_ << "\n";
+      for (Index i=0; i<N_SCALINGS; i++) {
+        os << scaling_names[i] << " " << scaling_factors_[i].size() << "\n";
+        for (size_t j=0; j<scaling_factors_[i].size(); j++) {
+          os << scaling_factors_[i][j] << "\n";
+        }
+      }
+    }
+    os << "pd_pert " << (pd_pert_state_.valid ? 1 : 0) << "\n";
+    if (pd_pert_state_.valid) {
+      os << pd_pert_state_.delta_x_last << "\n";
+      os << pd_pert_state_.delta_s_last << "\n";
+      os << pd_pert_state_.delta_c_last << "\n";
+      os << pd_pert_state_.delta_d_last << "\n";
+      os << pd_pert_state_.hess_degenerate << "\n";
+      os << pd_pert_state_.jac_degenerate << "\n";
+      os << pd_pert_state_.degen_iters << "\n";
+    }
+    os << "lm_history " << lm_length_ << " " << lm_dim_ << "\n";
+    if (lm_length_ > 0) {
+      os << "lm_sigma " << lm_sigma_ << "\n";
+      for (size_t j=0; j<lm_s_.size(); j++) {
+        os << lm_s_[j] << "\n";
+      }
+      for (size_t j=0; j<lm_y_.size(); j++) {
+        os << lm_y_[j] << "\n";
+      }
+    }
+    os << "end\n";
+
+    os.flags(flags);
+    os.precision(precision);
+    return os.good();
+  }
+
+  bool WarmStartSnapshot::Read(std::istream& is)
+  {
+    have_values_ = false;
+    have_scaling_ = false;
+    pd_pert_state_.valid = false;
+    lm_length_ = 0;
+
+    std::string keyword;
+    Index version;
+    is >> keyword >> version;
+    if (!is || keyword != snapshot_keyword || version != snapshot_version) {
+      return false;
+    }
+    is >> keyword >> mu_;
+    if (!is || keyword != "mu") {
+      return false;
+    }
+    is >> keyword >> tau_;
+    if (!is || keyword != "tau") {
+      return false;
+    }
+    for (Index i=0; i<N_COMPS; i++) {
+      Index dim;
+      is >> keyword >> dim;
+      if (!is || keyword != comp_names[i] || dim < 0) {
+        return false;
+      }
+      values_[i].resize(dim);
+      for (Index j=0; j<dim; j++) {
+        is >> values_[i][j];
+      }
+      if (!is) {
+        return false;
+      }
+    }
+    Index have_scaling;
+    is >> keyword >> have_scaling;
+    if (!is || keyword != "scaling") {
+      return false;
+    }
+    if (have_scaling) {
+      is >> keyword >> obj_scaling_;
+      if (!is || keyword != "obj_scaling") {
+        return false;
+      }
+      for (Index i=0; i<N_SCALINGS; i++) {
+        Index dim;
+        is >> keyword >> dim;
+        if (!is || keyword != scaling_names[i] || dim < 0) {
+          return false;
+        }
+        scaling_factors_[i].resize(dim);
+        for (Index j=0; j<dim; j++) {
+          is >> scaling_factors_[i][j];
+        }
+        if (!is) {
+          return false;
+        }
+      }
+    }
+    // The histories are only kept if the whole snapshot is valid
+    PDPertHistory pd_pert_state;
+    Index have_pd_pert;
+    is >> keyword >> have_pd_pert;
+    if (!is || keyword != "pd_pert") {
+      return false;
+    }
+    pd_pert_state.valid = (have_pd_pert != 0);
+    if (pd_pert_state.valid) {
+      is >> pd_pert_state.delta_x_last;
+      is >> pd_pert_state.delta_s_last;
+      is >> pd_pert_state.delta_c_last;
+      is >> pd_pert_state.delta_d_last;
+      is >> pd_pert_state.hess_degenerate;
+      is >> pd_pert_state.jac_degenerate;
+      is >> pd_pert_state.degen_iters;
+      if (!is) {
+        return false;
+      }
+    }
+    Index lm_length;
+    is >> keyword >> lm_length >> lm_dim_;
+    if (!is || keyword != "lm_history" || lm_length < 0 || lm_dim_ < 0) {
+      return false;
+    }
+    lm_s_.resize(lm_length*lm_dim_);
+    lm_y_.resize(lm_length*lm_dim_);
+    if (lm_length > 0) {
+      is >> keyword >> lm_sigma_;
+      if (!is || keyword != "lm_sigma") {
+        return false;
+      }
+      for (size_t j=0; j<lm_s_.size(); j++) {
+        is >> lm_s_[j];
+      }
+      for (size_t j=0; j<lm_y_.size(); j++) {
+        is >> lm_y_[j];
+      }
+      if (!is) {
+        return false;
+      }
+    }
+    is >> keyword;
+    if (!is || keyword != "end") {
+      return false;
+    }
+
+    pd_pert_state_ = pd_pert_state;
+    lm_length_ = lm_length;
+    have_values_ = true;
+    have_scaling_ = (have_scaling != 0);
+    return true;
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,226 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPWARMSTARTSNAPSHOT_HPP__
+#define __IPWARMSTARTSNAPSHOT_HPP__
+
+#include "IpReferenced.hpp"
+#include "IpIteratesVector.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace Ipopt
+{
+  /* forward declarations */
+  class NLPScalingObject;
+  class MultiVectorMatrix;
+
+  /** History of the perturbation of the primal-dual system that is
+   *  kept by the PDPerturbationHandler: the last perturbations and
+   *  the degeneracy flags. */
+  struct PDPertHistory
+  {
+    /** Flag indicating whether the history is known */
+    bool valid;
+    Number delta_x_last;
+    Number delta_s_last;
+    Number delta_c_last;
+    Number delta_d_last;
+    Index hess_degenerate;
+    Index jac_degenerate;
+    Index degen_iters;
+  };
+
+  /** Snapshot of the state of the algorithm at an iterate, which can
+   *  be used to warm start a later optimization of a problem with
+   *  the same structure.  It contains all primal and dual variables,
+   *  including the slacks s and the bound multipliers v_L and v_U,
+   *  as they are used inside the algorithm (i.e., after scaling and
+   *  after the fixed variables have been removed), the barrier
+   *  parameter mu, the fraction-to-the-boundary parameter tau, the
+   *  history of the perturbation of the primal-dual system that is
+   *  kept by the PDPerturbationHandler, and the pairs of the
+   *  limited-memory BFGS approximation of the Hessian, if one is
+   *  used.  Since the values are
+   *  scaled, the snapshot also keeps the scaling factors, and it
+   *  is only used for a problem with the same scaling.
+   *
+   *  A snapshot is taken with IpoptApplication::GetWarmStartSnapshot
+   *  and given to a later optimization with
+   *  IpoptApplication::SetWarmStartSnapshot.  It is used if the
+   *  option warm_start_init_point is set to yes.  Write and Read
+   *  store the snapshot as text, so that it can be kept between
+   *  different runs of a program.
+   */
+  class WarmStartSnapshot : public ReferencedObject
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Default constructor, creates an empty snapshot */
+    WarmStartSnapshot();
+
+    /** Destructor */
+    virtual ~WarmStartSnapshot();
+    //@}
+
+    /** Store the values of an iterate and the barrier parameters */
+    void TakeFrom(const IteratesVector& iterates, Number mu, Number tau);
+
+    /** Copy the stored values into iterates, which must have been
+     *  created with all components.  Returns false if the snapshot
+     *  is empty or the dimensions do not match. */
+    bool PutInto(IteratesVector& iterates) const;
+
+    /** Store the objective scaling factor and the scaling factors
+     *  for x, c, and d that were used for the iterate */
+    void TakeScalingFrom(NLPScalingObject& scaling,
+                         const IteratesVector& iterates);
+
+    /** Check whether the scaling factors are the same as the ones
+     *  stored with TakeScalingFrom.  If no scaling factors have
+     *  been stored, the scaling is assumed to be the same. */
+    bool HasSameScaling(NLPScalingObject& scaling,
+                        const IteratesVector& iterates) const;
+
+    /** Barrier parameter at the iterate */
+    Number mu() const
+    {
+      return mu_;
+    }
+
+    /** Fraction-to-the-boundary parameter at the iterate */
+    Number tau() const
+    {
+      return tau_;
+    }
+
+    /** Store the history of the perturbation of the primal-dual
+     *  system */
+    void SetPDPertState(const PDPertHistory& pd_pert_state)
+    {
+      pd_pert_state_ = pd_pert_state;
+    }
+
+    /** History of the perturbation of the primal-dual system.  Its
+     *  valid flag is false if it is not known. */
+    const PDPertHistory& PDPertState() const
+    {
+      return pd_pert_state_;
+    }
+
+    /** Store the history of the limited-memory BFGS approximation:
+     *  the columns of S and Y are the pairs of steps and differences
+     *  of the gradient of the Lagrangian, and sigma is the factor of
+     *  the initial matrix sigma*I. */
+    void SetLimMemHistory(const MultiVectorMatrix& S,
+                          const MultiVectorMatrix& Y, Number sigma);
+
+    /** Number of pairs in the limited-memory history, 0 if it is not
+     *  known */
+    Index LimMemHistoryLength() const
+    {
+      return lm_length_;
+    }
+
+    /** Factor of the initial matrix of the limited-memory history */
+    Number LimMemSigma() const
+    {
+      return lm_sigma_;
+    }
+
+    /** Copy the i-th pair of the limited-memory history into s and
+     *  y.  Returns false if the dimension of s and y is not the one
+     *  of the stored pairs. */
+    bool GetLimMemPair(Index i, Vector& s, Vector& y) const;
+
+    /** Write the snapshot as text to a stream.  Returns false if
+     *  there was an error writing to the stream. */
+    bool Write(std::ostream& os) const;
+
+    /** Read a snapshot written with Write from a stream.  Returns
+     *  false if the stream does not contain a valid snapshot; then
+     *  the snapshot is empty. */
+    bool Read(std::istream& is);
+
+  private:
+    /**@name Default Compiler Generated Methods (Hidden to avoid
+     * implicit creation/calling).  These methods are not
+     * implemented and we do not want the compiler to implement
+     * them for us, so we declare them private and do not define
+     * them. This ensures that they will not be implicitly
+     * created/called. */
+    //@{
+    /** Copy Constructor */
+    WarmStartSnapshot(const WarmStartSnapshot&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const WarmStartSnapshot&);
+    //@}
+
+    /** Number of components of an iterate (x, s, y_c, y_d, z_L, z_U,
+     *  v_L, v_U) */
+    enum {
+      N_COMPS = 8
+    };
+
+    /** Number of scaled spaces (x, c, d) */
+    enum {
+      N_SCALINGS = 3
+    };
+
+    /** Compute the objective scaling factor and the scaling factors
+     *  for x, c, and d */
+    static void GetScaling(NLPScalingObject& scaling,
+                           const IteratesVector& iterates,
+                           Number& obj_scaling,
+                           std::vector<Number>* scaling_factors);
+
+    /** Flag indicating whether the snapshot contains values */
+    bool have_values_;
+
+    /** Values of the components of the iterate */
+    std::vector<Number> values_[N_COMPS];
+
+    /** Flag indicating whether the snapshot contains scaling
+     *  factors */
+    bool have_scaling_;
+
+    /** Objective scaling factor */
+    Number obj_scaling_;
+
+    /** Scaling factors for x, c, and d */
+    std::vector<Number> scaling_factors_[N_SCALINGS];
+
+    /** Barrier parameter */
+    Number mu_;
+
+    /** Fraction-to-the-boundary parameter */
+    Number tau_;
+
+    /** History of the perturbation of the primal-dual system */
+    PDPertHistory pd_pert_state_;
+
+    /** @name Limited-memory history */
+    //@{
+    /** Number of pairs */
+    Index lm_length_;
+    /** Dimension of the vectors in the pairs */
+    Index lm_dim_;
+    /** Factor of the initial matrix */
+    Number lm_sigma_;
+    /** Steps, one pair after another */
+    std::vector<Number> lm_s_;
+    /** Differences of the gradient of the Lagrangian, one pair after
+     *  another */
+    std::vector<Number> lm_y_;
+    //@}
+  };
+
+} // namespace Ipopt
+
+#endif
@@ -163,6 +163,17 @@ namespace Ipopt
       "When MUMPS is used to determine linearly dependent constraints, this "
       "is determines the threshold for a pivot to be considered zero.  This "
       "is CNTL(3) in MUMPS.");
+    roptions->AddBoundedNumberOption(
+      "mumps_sparse_rhs_density",
+      "Maximal density of right hand sides that are given to MUMPS in sparse format.",
+      0, false, 1, false, 0.,
+      "If the fraction of nonzero entries in the right hand sides of a solve "
+      "is at most this value, all right hand sides are given to MUMPS in one "
+      "call in sparse format (ICNTL(20)=1), so that MUMPS can exploit their "
+      "sparsity in the forward elimination.  This happens for the unit vector "
+      "right hand sides in the sensitivity computations of sIPOPT.  The "
+      "default value 0 disables the sparse format; then each right hand side "
+      "is solved in a separate call.");
   }
 
   bool MumpsSolverInterface::InitializeImpl(const OptionsList& options,
@@ -190,6 +201,8 @@ namespace Ipopt
     options.GetIntegerValue("mumps_pivot_order", mumps_pivot_order_, prefix);
     options.GetIntegerValue("mumps_scaling", mumps_scaling_, prefix);
     options.GetNumericValue("mumps_dep_tol", mumps_dep_tol_, prefix);
+    options.GetNumericValue("mumps_sparse_rhs_density",
+                            mumps_sparse_rhs_density_, prefix);
 
     // Reset all private data
     initialized_ = false;
@@ -485,12 +498,52 @@ namespace Ipopt
     if (HaveIpData()) {
       IpData().TimingStats().LinearSystemBackSolve().Start();
     }
-    for (Index i = 0; i < nrhs; i++) {
-      Index offset = i * mumps_data->n;
-      mumps_data->rhs = &(rhs_vals[offset]);
+    const Index n = mumps_data->n;
+
+    // Count the nonzeros in the right hand sides to decide whether
+    // they are given to MUMPS in sparse format
+    bool sparse_rhs = false;
+    Index nz_rhs = 0;
+    if (mumps_sparse_rhs_density_ > 0.) {
+      for (Index i = 0; i < n*nrhs; i++) {
+        if (rhs_vals[i] != 0.) {
+          nz_rhs++;
+        }
+      }
+      sparse_rhs = nz_rhs > 0 && nz_rhs <= mumps_sparse_rhs_density_*n*nrhs;
+    }
+
+    if (sparse_rhs) {
+      // Compressed column format with Fortran indices; MUMPS returns
+      // the dense solution in rhs.  All right hand sides are solved
+      // in one call.
+      Number* rhs_sparse = new Number[nz_rhs];
+      int* irhs_sparse = new int[nz_rhs];
+      int* irhs_ptr = new int[nrhs+1];
+      Index k = 0;
+      for (Index j = 0; j < nrhs; j++) {
+        irhs_ptr[j] = k + 1;
+        for (Index i = 0; i < n; i++) {
+          if (rhs_vals[j*n + i] != 0.) {
+            rhs_sparse[k] = rhs_vals[j*n + i];
+            irhs_sparse[k] = i + 1;
+            k++;
+          }
+        }
+      }
+      irhs_ptr[nrhs] = k + 1;
+      mumps_data->icntl[19] = 1;
+      mumps_data->nz_rhs = nz_rhs;
+      mumps_data->rhs_sparse = rhs_sparse;
+      mumps_data->irhs_sparse = irhs_sparse;
+      mumps_data->irhs_ptr = irhs_ptr;
+      mumps_data->nrhs = nrhs;
+      mumps_data->lrhs = n;
+      mumps_data->rhs = rhs_vals;
       mumps_data->job = 3;//solve
       Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
-                     "Calling MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
+                     "Calling MUMPS-3 for solve with %d sparse right hand sides at cpu time %10.3f (wall %10.3f).\n",
+                     nrhs, CpuTime(), WallclockTime());
       dmumps_c(mumps_data);
       Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                      "Done with MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
@@ -501,6 +554,34 @@ namespace Ipopt
                        error);
         retval = SYMSOLVER_FATAL_ERROR;
       }
+      mumps_data->icntl[19] = 0;
+      mumps_data->nz_rhs = 0;
+      mumps_data->rhs_sparse = NULL;
+      mumps_data->irhs_sparse = NULL;
+      mumps_data->irhs_ptr = NULL;
+      mumps_data->nrhs = 1;
+      delete [] rhs_sparse;
+      delete [] irhs_sparse;
+      delete [] irhs_ptr;
+    }
+    else {
+      for (Index i = 0; i < nrhs; i++) {
+        Index offset = i * n;
+        mumps_data->rhs = &(rhs_vals[offset]);
+        mumps_data->job = 3;//solve
+        Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
+                       "Calling MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
+        dmumps_c(mumps_data);
+        Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
+                       "Done with MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
+        int error = mumps_data->info[0];
+        if (error < 0) {
+          Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
+                         "Error=%d returned from MUMPS in Solve.\n",
+                         error);
+          retval = SYMSOLVER_FATAL_ERROR;
+        }
+      }
     }
     if (HaveIpData()) {
       IpData().TimingStats().LinearSystemBackSolve().End();
@@ -188,6 +188,10 @@ namespace Ipopt
      *  dependent */
     Number mumps_dep_tol_;
 
+    /** Maximal fraction of nonzero entries in the right hand sides
+     *  for which they are given to MUMPS in sparse format */
+    Number mumps_sparse_rhs_density_;
+
     /** Flag indicating whether the TNLP with identical structure has
      *  already been solved before. */
     bool warm_start_same_structure_;
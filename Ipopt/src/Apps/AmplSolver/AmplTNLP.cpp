@@ -57,6 +57,8 @@ namespace Ipopt
       g_sol_(NULL),
       lambda_sol_(NULL),
       obj_sol_(0.0),
+      obj_val_cache_(0.0),
+      g_cache_(NULL),
       objval_called_with_current_x_(false),
       conval_called_with_current_x_(false),
       hesset_called_(false),
@@ -276,6 +278,8 @@ namespace Ipopt
     g_sol_ = NULL;
     delete [] lambda_sol_;
     lambda_sol_ = NULL;
+    delete [] g_cache_;
+    g_cache_ = NULL;
 
     if (Oinfo_ptr_) {
       Option_Info* Oinfo = (Option_Info*) Oinfo_ptr_;
@@ -636,6 +640,10 @@ namespace Ipopt
       message = "Maximum CPU Time Exceeded.";
       solve_result_num = 401;
     }
+    else if (status == WALLTIME_EXCEEDED) {
+      message = "Maximum Wallclock Time Exceeded.";
+      solve_result_num = 402;
+    }
     else if (status == STOP_AT_TINY_STEP) {
       message = "Search Direction becomes Too Small.";
       solve_result_num = 500;
@@ -682,23 +690,26 @@ namespace Ipopt
                    dbg_verbosity);
     ASL_pfgh* asl = asl_;
     DBG_ASSERT(asl_);
-    objval_called_with_current_x_ = false; // in case the call below fails
 
-    if (n_obj==0) {
-      obj_val = 0;
-      objval_called_with_current_x_ = true;
+    if (objval_called_with_current_x_) {
+      obj_val = obj_val_cache_;
       return true;
     }
+
+    if (n_obj==0) {
+      obj_val_cache_ = 0;
+    }
     else {
       Number retval = objval(obj_no, const_cast<Number*>(x), (fint*)nerror_);
-      if (nerror_ok(nerror_)) {
-        obj_val = obj_sign_*retval;
-        objval_called_with_current_x_ = true;
-        return true;
+      if (!nerror_ok(nerror_)) {
+        return false;
       }
+      obj_val_cache_ = obj_sign_*retval;
     }
 
-    return false;
+    obj_val = obj_val_cache_;
+    objval_called_with_current_x_ = true;
+    return true;
   }
 
   bool AmplTNLP::internal_conval(const Number* x, Index m, Number* g)
@@ -708,25 +719,22 @@ namespace Ipopt
     ASL_pfgh* asl = asl_;
     DBG_ASSERT(asl_);
     DBG_ASSERT(m == n_con);
-    conval_called_with_current_x_ = false; // in case the call below fails
 
-    bool allocated = false;
-    if (!g) {
-      g = new double[m];
-      allocated = true;
-    }
-    conval(const_cast<Number*>(x), g, (fint*)nerror_);
-
-    if (allocated) {
-      delete [] g;
-      g = NULL;
+    if (!conval_called_with_current_x_) {
+      if (!g_cache_) {
+        g_cache_ = new Number[m];
+      }
+      conval(const_cast<Number*>(x), g_cache_, (fint*)nerror_);
+      if (!nerror_ok(nerror_)) {
+        return false;
+      }
+      conval_called_with_current_x_ = true;
     }
 
-    if (nerror_ok(nerror_)) {
-      conval_called_with_current_x_ = true;
-      return true;
+    if (g) {
+      IpBlasDcopy(m, g_cache_, 1, g, 1);
     }
-    return false;
+    return true;
   }
 
 
@@ -503,6 +503,16 @@ namespace Ipopt
     Number obj_sol_;
     //@}
 
+    /**@name Values computed by AMPL at the current x, reused until
+     *  apply_new_x is called with a new x */
+    //@{
+    /** Objective value, valid if objval_called_with_current_x_ is true */
+    Number obj_val_cache_;
+    /** Constraint values, valid if conval_called_with_current_x_ is
+     *  true */
+    Number* g_cache_;
+    //@}
+
     /**@name Flags to track internal state */
     //@{
     /** true when the objective value has been calculated with the
@@ -528,10 +538,12 @@ namespace Ipopt
     /** Suffix Handler */
     SmartPtr<AmplSuffixHandler> suffix_handler_;
 
-    /** Make the objective call to ampl */
+    /** Make the objective call to ampl, unless the objective has
+     *  already been evaluated at the current x */
     bool internal_objval(const Number* x, Number& obj_val);
 
-    /** Make the constraint call to ampl*/
+    /** Make the constraint call to ampl, unless the constraints have
+     *  already been evaluated at the current x */
     bool internal_conval(const Number* x, Index m, Number* g=NULL);
 
     /** Internal function to update the internal and ampl state if the
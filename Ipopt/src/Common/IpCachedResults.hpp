@@ -13,7 +13,6 @@
 #include "IpObserver.hpp"
 #include <algorithm>
 #include <vector>
-#include <list>
 
 namespace Ipopt
 {
@@ -65,6 +64,14 @@ namespace Ipopt
    *  DependentResult, inherits off an Observer.  This Observer
    *  retrieves notification whenever a TaggedObject dependency has
    *  changed.  Stale results are later removed from the cache.
+   *
+   *  Since the cache is queried very often, the array-based methods
+   *  and the methods for one, two, or three TaggedObject dependencies
+   *  (e.g. GetCachedResult2Dep) do not create any temporary
+   *  std::vectors, and a DependentResult
+   *  with at most three such dependencies stores their tags inline.
+   *  The cached results themselves are kept in a contiguous array,
+   *  most recent result last.
    */
   template <class T>
   class CachedResults
@@ -117,6 +124,27 @@ namespace Ipopt
                          const std::vector<const TaggedObject*>& dependents) const;
     //@}
 
+    /** @name Array-based methods for adding and retrieving cached
+     *  results.  The TaggedObject dependencies are given as an array
+     *  of length n_dependents, and the Number dependencies as an
+     *  array of length n_scalar_dependents (which can be NULL if
+     *  n_scalar_dependents is zero).  Since no std::vectors need to
+     *  be created, these should be preferred in frequently called
+     *  code.  All other Add and Get methods call these. */
+    //@{
+    void AddCachedResult(const T& result,
+                         Index n_dependents,
+                         const TaggedObject* const* dependents,
+                         Index n_scalar_dependents,
+                         const Number* scalar_dependents);
+
+    bool GetCachedResult(T& retResult,
+                         Index n_dependents,
+                         const TaggedObject* const* dependents,
+                         Index n_scalar_dependents,
+                         const Number* scalar_dependents) const;
+    //@}
+
     /** @name Pointer-based methods for adding and retrieving cached
      *  results, providing dependencies explicitly.
      */
@@ -235,11 +263,12 @@ namespace Ipopt
     /** maximum number of cached results */
     Int max_cache_size_;
 
-    /** list of currently cached results. */
-    mutable std::list<DependentResult<T>*>* cached_results_;
+    /** array of currently cached results, the most recently added
+     *  result is at the end. */
+    mutable std::vector<DependentResult<T>*> cached_results_;
 
     /** internal method for removing stale DependentResults from the
-     *  list.  It is called at the beginning of every
+     *  array.  It is called at the beginning of every
      *  GetDependentResult method.
      */
     void CleanupInvalidatedResults() const;
@@ -250,8 +279,8 @@ namespace Ipopt
 
   /** Templated class which stores one entry for the CachedResult
    *  class.  It stores the result (of type T), together with its
-   *  dependencies (vector of TaggedObjects and vector of Numbers).
-   *  It also stores a priority.
+   *  dependencies (tags of TaggedObjects and Numbers).  Up to
+   *  max_inline_dependents tags are stored inside the object itself.
    */
   template <class T>
   class DependentResult : public Observer
@@ -262,12 +291,26 @@ namespace Ipopt
     static const Index dbg_verbosity;
 #endif
 
+    /** Maximal number of TaggedObject dependencies for which the
+     *  tags are stored without allocating memory */
+    enum
+    {
+      max_inline_dependents = 3
+    };
+
     /** @name Constructor, Destructors */
     //@{
     /** Constructor, given all information about the result. */
     DependentResult(const T& result, const std::vector<const TaggedObject*>& dependents,
                     const std::vector<Number>& scalar_dependents);
 
+    /** Constructor, given the dependencies as arrays. */
+    DependentResult(const T& result,
+                    Index n_dependents,
+                    const TaggedObject* const* dependents,
+                    Index n_scalar_dependents,
+                    const Number* scalar_dependents);
+
     /** Destructor. */
     ~DependentResult();
     //@}
@@ -291,6 +334,12 @@ namespace Ipopt
     bool DependentsIdentical(const std::vector<const TaggedObject*>& dependents,
                              const std::vector<Number>& scalar_dependents) const;
 
+    /** Same as above, with the dependencies given as arrays. */
+    bool DependentsIdentical(Index n_dependents,
+                             const TaggedObject* const* dependents,
+                             Index n_scalar_dependents,
+                             const Number* scalar_dependents) const;
+
     /** Print information about this DependentResults. */
     void DebugPrint() const;
 
@@ -324,14 +373,27 @@ namespace Ipopt
     void operator=(const DependentResult&);
     //@}
 
+    /** Method for storing the dependencies, called by the
+     *  constructors. */
+    void SetDependents(Index n_dependents,
+                       const TaggedObject* const* dependents,
+                       Index n_scalar_dependents,
+                       const Number* scalar_dependents);
+
     /** Flag indicating, if the cached result is still valid.  A
     result becomes invalid, if the RecieveNotification method is
     called with NT_Changed */
     bool stale_;
     /** The value of the dependent results */
     const T result_;
-    /** Dependencies in form of TaggedObjects */
-    std::vector<TaggedObject::Tag> dependent_tags_;
+    /** Number of dependencies in form of TaggedObjects */
+    Index n_dependents_;
+    /** Dependencies in form of TaggedObjects.  This points to
+     *  inline_tags_ if there are at most max_inline_dependents
+     *  dependencies, and to an allocated array otherwise. */
+    TaggedObject::Tag* dependent_tags_;
+    /** Storage for the tags of a small number of dependencies */
+    TaggedObject::Tag inline_tags_[max_inline_dependents];
     /** Dependencies in form a Numbers */
     std::vector<Number> scalar_dependents_;
   };
@@ -352,14 +414,56 @@ namespace Ipopt
       :
       stale_(false),
       result_(result),
-      dependent_tags_(dependents.size()),
-      scalar_dependents_(scalar_dependents)
+      n_dependents_(0),
+      dependent_tags_(inline_tags_)
+  {
+#ifdef IP_DEBUG_CACHE
+    DBG_START_METH("DependentResult<T>::DependentResult()", dbg_verbosity);
+#endif
+
+    SetDependents((Index)dependents.size(),
+                  dependents.empty() ? NULL : &dependents[0],
+                  (Index)scalar_dependents.size(),
+                  scalar_dependents.empty() ? NULL : &scalar_dependents[0]);
+  }
+
+  template <class T>
+  DependentResult<T>::DependentResult(
+    const T& result,
+    Index n_dependents,
+    const TaggedObject* const* dependents,
+    Index n_scalar_dependents,
+    const Number* scalar_dependents)
+      :
+      stale_(false),
+      result_(result),
+      n_dependents_(0),
+      dependent_tags_(inline_tags_)
   {
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("DependentResult<T>::DependentResult()", dbg_verbosity);
 #endif
 
-    for (Index i=0; i<(Index)dependents.size(); i++) {
+    SetDependents(n_dependents, dependents,
+                  n_scalar_dependents, scalar_dependents);
+  }
+
+  template <class T>
+  void DependentResult<T>::SetDependents(Index n_dependents,
+                                         const TaggedObject* const* dependents,
+                                         Index n_scalar_dependents,
+                                         const Number* scalar_dependents)
+  {
+    n_dependents_ = n_dependents;
+    if (n_dependents_ > max_inline_dependents) {
+      dependent_tags_ = new TaggedObject::Tag[n_dependents_];
+    }
+    if (n_scalar_dependents > 0) {
+      scalar_dependents_.assign(scalar_dependents,
+                                scalar_dependents + n_scalar_dependents);
+    }
+
+    for (Index i=0; i<n_dependents_; i++) {
       if (dependents[i]) {
         // Call the RequestAttach method of the Observer base class.
         // This will add this dependent result in the Observer list
@@ -384,9 +488,10 @@ namespace Ipopt
     DBG_START_METH("DependentResult<T>::~DependentResult()", dbg_verbosity);
     //DBG_ASSERT(stale_ == true);
 #endif
-    // Nothing to be done here, destructor
-    // of T should sufficiently remove
-    // any memory, etc.
+    if (dependent_tags_ != inline_tags_) {
+      delete [] dependent_tags_;
+    }
+    // The destructor of T should sufficiently remove any memory, etc.
   }
 
   template <class T>
@@ -419,37 +524,42 @@ namespace Ipopt
   bool DependentResult<T>::DependentsIdentical(const std::vector<const TaggedObject*>& dependents,
       const std::vector<Number>& scalar_dependents) const
   {
+    return DependentsIdentical((Index)dependents.size(),
+                               dependents.empty() ? NULL : &dependents[0],
+                               (Index)scalar_dependents.size(),
+                               scalar_dependents.empty() ? NULL : &scalar_dependents[0]);
+  }
+
+  template <class T>
+  bool DependentResult<T>::DependentsIdentical(Index n_dependents,
+      const TaggedObject* const* dependents,
+      Index n_scalar_dependents,
+      const Number* scalar_dependents) const
+  {
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("DependentResult<T>::DependentsIdentical", dbg_verbosity);
     DBG_ASSERT(stale_ == false);
-    DBG_ASSERT(dependents.size() == dependent_tags_.size());
+    DBG_ASSERT(n_dependents == n_dependents_);
 #endif
 
-    bool retVal = true;
-
-    if (dependents.size() != dependent_tags_.size()
-        || scalar_dependents.size() != scalar_dependents_.size()) {
-      retVal = false;
+    if (n_dependents != n_dependents_
+        || n_scalar_dependents != (Index)scalar_dependents_.size()) {
+      return false;
     }
-    else {
-      for (Index i=0; i<(Index)dependents.size(); i++) {
-        if ( (dependents[i] && dependents[i]->GetTag() != dependent_tags_[i])
-             || (!dependents[i] && dependent_tags_[i] != 0) ) {
-          retVal = false;
-          break;
-        }
+
+    for (Index i=0; i<n_dependents; i++) {
+      if ( (dependents[i] && dependents[i]->GetTag() != dependent_tags_[i])
+           || (!dependents[i] && dependent_tags_[i] != 0) ) {
+        return false;
       }
-      if (retVal) {
-        for (Index i=0; i<(Index)scalar_dependents.size(); i++) {
-          if (scalar_dependents[i] != scalar_dependents_[i]) {
-            retVal = false;
-            break;
-          }
-        }
+    }
+    for (Index i=0; i<n_scalar_dependents; i++) {
+      if (scalar_dependents[i] != scalar_dependents_[i]) {
+        return false;
       }
     }
 
-    return retVal;
+    return true;
   }
 
   template <class T>
@@ -475,8 +585,7 @@ namespace Ipopt
   template <class T>
   CachedResults<T>::CachedResults(Int max_cache_size)
       :
-      max_cache_size_(max_cache_size),
-      cached_results_(NULL)
+      max_cache_size_(max_cache_size)
   {
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("CachedResults<T>::CachedResults", dbg_verbosity);
@@ -491,28 +600,20 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::!CachedResults()", dbg_verbosity);
 #endif
 
-    if (cached_results_) {
-      for (typename std::list< DependentResult<T>* >::iterator iter = cached_results_->
-           begin();
-           iter != cached_results_->end();
-           iter++) {
-        delete *iter;
-      }
-      delete cached_results_;
-    }
-    /*
-    while (!cached_results_.empty()) {
-      DependentResult<T>* result = cached_results_.back();
-      cached_results_.pop_back();
-      delete result;
+    for (typename std::vector< DependentResult<T>* >::iterator iter =
+           cached_results_.begin();
+         iter != cached_results_.end();
+         iter++) {
+      delete *iter;
     }
-    */
   }
 
   template <class T>
   void CachedResults<T>::AddCachedResult(const T& result,
-                                         const std::vector<const TaggedObject*>& dependents,
-                                         const std::vector<Number>& scalar_dependents)
+                                         Index n_dependents,
+                                         const TaggedObject* const* dependents,
+                                         Index n_scalar_dependents,
+                                         const Number* scalar_dependents)
   {
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("CachedResults<T>::AddCachedResult", dbg_verbosity);
@@ -521,19 +622,18 @@ namespace Ipopt
     CleanupInvalidatedResults();
 
     // insert the new one here
-    DependentResult<T>* newResult = new DependentResult<T>(result, dependents, scalar_dependents);
-    if (!cached_results_) {
-      cached_results_ = new std::list<DependentResult<T>*>;
-    }
-    cached_results_->push_front(newResult);
+    DependentResult<T>* newResult =
+      new DependentResult<T>(result, n_dependents, dependents,
+                             n_scalar_dependents, scalar_dependents);
+    cached_results_.push_back(newResult);
 
-    // keep the list small enough
+    // keep the array small enough
     if (max_cache_size_ >= 0) { // if negative, allow infinite cache
-      // non-negative - limit size of list to max_cache_size
-      DBG_ASSERT((Int)cached_results_->size()<=max_cache_size_+1);
-      if ((Int)cached_results_->size() > max_cache_size_) {
-        delete cached_results_->back();
-        cached_results_->pop_back();
+      // non-negative - limit size of array to max_cache_size
+      DBG_ASSERT((Int)cached_results_.size()<=max_cache_size_+1);
+      if ((Int)cached_results_.size() > max_cache_size_) {
+        delete cached_results_.front();
+        cached_results_.erase(cached_results_.begin());
       }
     }
 
@@ -544,31 +644,28 @@ namespace Ipopt
   }
 
   template <class T>
-  void CachedResults<T>::AddCachedResult(const T& result,
-                                         const std::vector<const TaggedObject*>& dependents)
-  {
-    std::vector<Number> scalar_dependents;
-    AddCachedResult(result, dependents, scalar_dependents);
-  }
-
-  template <class T>
-  bool CachedResults<T>::GetCachedResult(T& retResult, const std::vector<const TaggedObject*>& dependents,
-                                         const std::vector<Number>& scalar_dependents) const
+  bool CachedResults<T>::GetCachedResult(T& retResult,
+                                         Index n_dependents,
+                                         const TaggedObject* const* dependents,
+                                         Index n_scalar_dependents,
+                                         const Number* scalar_dependents) const
   {
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("CachedResults<T>::GetCachedResult", dbg_verbosity);
 #endif
 
-    if (!cached_results_)
+    if (cached_results_.empty())
       return false;
 
     CleanupInvalidatedResults();
 
+    // search from the most recent result backwards
     bool retValue = false;
-    typename std::list< DependentResult<T>* >::const_iterator iter;
-    for (iter = cached_results_->begin(); iter != cached_results_->end(); iter++) {
-      if ((*iter)->DependentsIdentical(dependents, scalar_dependents)) {
-        retResult = (*iter)->GetResult();
+    for (Index i=(Index)cached_results_.size()-1; i>=0; i--) {
+      if (cached_results_[i]->DependentsIdentical(n_dependents, dependents,
+          n_scalar_dependents,
+          scalar_dependents)) {
+        retResult = cached_results_[i]->GetResult();
         retValue = true;
         break;
       }
@@ -581,12 +678,41 @@ namespace Ipopt
     return retValue;
   }
 
+  template <class T>
+  void CachedResults<T>::AddCachedResult(const T& result,
+                                         const std::vector<const TaggedObject*>& dependents,
+                                         const std::vector<Number>& scalar_dependents)
+  {
+    AddCachedResult(result, (Index)dependents.size(),
+                    dependents.empty() ? NULL : &dependents[0],
+                    (Index)scalar_dependents.size(),
+                    scalar_dependents.empty() ? NULL : &scalar_dependents[0]);
+  }
+
+  template <class T>
+  void CachedResults<T>::AddCachedResult(const T& result,
+                                         const std::vector<const TaggedObject*>& dependents)
+  {
+    AddCachedResult(result, (Index)dependents.size(),
+                    dependents.empty() ? NULL : &dependents[0], 0, NULL);
+  }
+
+  template <class T>
+  bool CachedResults<T>::GetCachedResult(T& retResult, const std::vector<const TaggedObject*>& dependents,
+                                         const std::vector<Number>& scalar_dependents) const
+  {
+    return GetCachedResult(retResult, (Index)dependents.size(),
+                           dependents.empty() ? NULL : &dependents[0],
+                           (Index)scalar_dependents.size(),
+                           scalar_dependents.empty() ? NULL : &scalar_dependents[0]);
+  }
+
   template <class T>
   bool CachedResults<T>::GetCachedResult(
     T& retResult, const std::vector<const TaggedObject*>& dependents) const
   {
-    std::vector<Number> scalar_dependents;
-    return GetCachedResult(retResult, dependents, scalar_dependents);
+    return GetCachedResult(retResult, (Index)dependents.size(),
+                           dependents.empty() ? NULL : &dependents[0], 0, NULL);
   }
 
   template <class T>
@@ -597,10 +723,7 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::AddCachedResult1Dep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(1);
-    dependents[0] = dependent1;
-
-    AddCachedResult(result, dependents);
+    AddCachedResult(result, 1, &dependent1, 0, NULL);
   }
 
   template <class T>
@@ -610,10 +733,7 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::GetCachedResult1Dep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(1);
-    dependents[0] = dependent1;
-
-    return GetCachedResult(retResult, dependents);
+    return GetCachedResult(retResult, 1, &dependent1, 0, NULL);
   }
 
   template <class T>
@@ -625,11 +745,9 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::AddCachedResult2dDep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(2);
-    dependents[0] = dependent1;
-    dependents[1] = dependent2;
+    const TaggedObject* dependents[2] = {dependent1, dependent2};
 
-    AddCachedResult(result, dependents);
+    AddCachedResult(result, 2, dependents, 0, NULL);
   }
 
   template <class T>
@@ -639,11 +757,9 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::GetCachedResult2Dep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(2);
-    dependents[0] = dependent1;
-    dependents[1] = dependent2;
+    const TaggedObject* dependents[2] = {dependent1, dependent2};
 
-    return GetCachedResult(retResult, dependents);
+    return GetCachedResult(retResult, 2, dependents, 0, NULL);
   }
 
   template <class T>
@@ -656,12 +772,9 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::AddCachedResult2dDep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(3);
-    dependents[0] = dependent1;
-    dependents[1] = dependent2;
-    dependents[2] = dependent3;
+    const TaggedObject* dependents[3] = {dependent1, dependent2, dependent3};
 
-    AddCachedResult(result, dependents);
+    AddCachedResult(result, 3, dependents, 0, NULL);
   }
 
   template <class T>
@@ -673,29 +786,24 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::GetCachedResult2Dep", dbg_verbosity);
 #endif
 
-    std::vector<const TaggedObject*> dependents(3);
-    dependents[0] = dependent1;
-    dependents[1] = dependent2;
-    dependents[2] = dependent3;
+    const TaggedObject* dependents[3] = {dependent1, dependent2, dependent3};
 
-    return GetCachedResult(retResult, dependents);
+    return GetCachedResult(retResult, 3, dependents, 0, NULL);
   }
 
   template <class T>
   bool CachedResults<T>::InvalidateResult(const std::vector<const TaggedObject*>& dependents,
                                           const std::vector<Number>& scalar_dependents)
   {
-    if (!cached_results_)
+    if (cached_results_.empty())
       return false;
 
     CleanupInvalidatedResults();
 
     bool retValue = false;
-    typename std::list< DependentResult<T>* >::const_iterator iter;
-    for (iter = cached_results_->begin(); iter != cached_results_->end();
-         iter++) {
-      if ((*iter)->DependentsIdentical(dependents, scalar_dependents)) {
-        (*iter)->Invalidate();
+    for (Index i=(Index)cached_results_.size()-1; i>=0; i--) {
+      if (cached_results_[i]->DependentsIdentical(dependents, scalar_dependents)) {
+        cached_results_[i]->Invalidate();
         retValue = true;
         break;
       }
@@ -707,11 +815,8 @@ namespace Ipopt
   template <class T>
   void CachedResults<T>::Clear()
   {
-    if (!cached_results_)
-      return;
-
-    typename std::list< DependentResult<T>* >::const_iterator iter;
-    for (iter = cached_results_->begin(); iter != cached_results_->end();
+    typename std::vector< DependentResult<T>* >::const_iterator iter;
+    for (iter = cached_results_.begin(); iter != cached_results_.end();
          iter++) {
       (*iter)->Invalidate();
     }
@@ -733,24 +838,18 @@ namespace Ipopt
     DBG_START_METH("CachedResults<T>::CleanupInvalidatedResults", dbg_verbosity);
 #endif
 
-    if (!cached_results_)
-      return;
-
-    typename std::list< DependentResult<T>* >::iterator iter;
-    iter = cached_results_->begin();
-    while (iter != cached_results_->end()) {
-      if ((*iter)->IsStale()) {
-        typename std::list< DependentResult<T>* >::iterator
-        iter_to_remove = iter;
-        iter++;
-        DependentResult<T>* result_to_delete = (*iter_to_remove);
-        cached_results_->erase(iter_to_remove);
-        delete result_to_delete;
+    // remove the stale results and move the remaining ones to the
+    // front, keeping their order
+    Index n_valid = 0;
+    for (Index i=0; i<(Index)cached_results_.size(); i++) {
+      if (cached_results_[i]->IsStale()) {
+        delete cached_results_[i];
       }
       else {
-        iter++;
+        cached_results_[n_valid++] = cached_results_[i];
       }
     }
+    cached_results_.resize(n_valid);
   }
 
   template <class T>
@@ -759,14 +858,13 @@ namespace Ipopt
 #ifdef IP_DEBUG_CACHE
     DBG_START_METH("CachedResults<T>::DebugPrintCachedResults", dbg_verbosity);
     if (DBG_VERBOSITY()>=2 ) {
-      if (!cached_results_) {
+      if (cached_results_.empty()) {
         DBG_PRINT((2,"Currentlt no cached results:\n"));
       }
       else {
-        typename std::list< DependentResult<T>* >::const_iterator iter;
         DBG_PRINT((2,"Current set of cached results:\n"));
-        for (iter = cached_results_->begin(); iter != cached_results_->end(); iter++) {
-          DBG_PRINT((2,"  DependentResult:0x%x\n", (*iter)));
+        for (Index i=(Index)cached_results_.size()-1; i>=0; i--) {
+          DBG_PRINT((2,"  DependentResult:0x%x\n", cached_results_[i]));
         }
       }
     }
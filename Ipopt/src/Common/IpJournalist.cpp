@@ -30,10 +30,24 @@
 # endif
 #endif
 
+// The AsyncFileJournal needs POSIX threads and memory barriers
+#if defined(HAVE_PTHREAD) && defined(HAVE_PTHREAD_H) && \
+    (defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__clang__))
+# define IP_ASYNC_JOURNAL
+# include <pthread.h>
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+# pragma intrinsic(_InterlockedIncrement)
+#endif
+
 namespace Ipopt
 {
 
   Journalist::Journalist()
+      :
+      accepted_levels_version_(-1)
   {}
 
   Journalist::~Journalist()
@@ -167,6 +181,10 @@ namespace Ipopt
     EJournalCategory category,
     const char* pformat, va_list ap) const
   {
+    if (!ProduceOutput(level, category)) {
+      return;
+    }
+
     // print the msg on every journal that accepts
     // the category and output level
     for (Index i=0; i<(Index)journals_.size(); i++) {
@@ -192,6 +210,10 @@ namespace Ipopt
     Index indent_level,
     const char* pformat, va_list ap) const
   {
+    if (!ProduceOutput(level, category)) {
+      return;
+    }
+
     // print the msg on every journal that accepts
     // the category and output level
     for (Index i=0; i<(Index)journals_.size(); i++) {
@@ -220,12 +242,28 @@ namespace Ipopt
   bool Journalist::ProduceOutput(EJournalLevel level,
                                  EJournalCategory category) const
   {
-    for (Index i=0; i<(Index)journals_.size(); i++) {
-      if (journals_[i]->IsAccepted(category, level)) {
-        return true;
+    if (accepted_levels_version_ != Journal::PrintLevelsVersion()) {
+      UpdateAcceptedLevels();
+    }
+    return (accepted_levels_[(Index)category] >= (Index)level);
+  }
+
+  void Journalist::UpdateAcceptedLevels() const
+  {
+    for (Index category=0; category<(Index)J_LAST_CATEGORY; category++) {
+      Index accepted_level = (Index)J_INSUPPRESSIBLE - 1;
+      for (Index i=0; i<(Index)journals_.size(); i++) {
+        for (Index level=J_LAST_LEVEL-1; level>accepted_level; level--) {
+          if (journals_[i]->IsAccepted((EJournalCategory)category,
+                                       (EJournalLevel)level)) {
+            accepted_level = level;
+            break;
+          }
+        }
       }
+      accepted_levels_[category] = accepted_level;
     }
-    return false;
+    accepted_levels_version_ = Journal::PrintLevelsVersion();
   }
 
   bool Journalist::AddJournal(const SmartPtr<Journal> jrnl)
@@ -240,6 +278,7 @@ namespace Ipopt
     }
 
     journals_.push_back(jrnl);
+    accepted_levels_version_ = -1;
     return true;
   }
 
@@ -266,9 +305,23 @@ namespace Ipopt
     }
   }
 
+  void Journalist::Synchronize() const
+  {
+    for (Index i=0; i<(Index)journals_.size(); i++) {
+      journals_[i]->Synchronize();
+    }
+  }
+
   SmartPtr<Journal> Journalist::GetJournal(
     const std::string& journal_name
   )
+  {
+    return FindJournal(journal_name);
+  }
+
+  SmartPtr<Journal> Journalist::FindJournal(
+    const std::string& journal_name
+  ) const
   {
     SmartPtr<Journal> retValue = NULL;
 
@@ -290,12 +343,28 @@ namespace Ipopt
       journals_[i]=NULL;
     }
     journals_.resize(0);
+    accepted_levels_version_ = -1;
   }
 
   ///////////////////////////////////////////////////////////////////////////
   //                 Implementation of the Journal class                   //
   ///////////////////////////////////////////////////////////////////////////
 
+  volatile Index Journal::print_levels_version_ = 0;
+
+  void Journal::IncreasePrintLevelsVersion()
+  {
+#if defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__clang__)
+    __sync_add_and_fetch(&print_levels_version_, 1);
+#elif defined(_MSC_VER)
+    _InterlockedIncrement((volatile long*)&print_levels_version_);
+#else
+    // No atomic operation available; a lost increment only delays
+    // the update of cached print levels of other journalists
+    print_levels_version_++;
+#endif
+  }
+
   Journal::Journal(
     const std::string& name,
     EJournalLevel default_level
@@ -333,6 +402,7 @@ namespace Ipopt
     EJournalLevel level)
   {
     print_levels_[(Index)category] = (Index) level;
+    IncreasePrintLevelsVersion();
   }
 
   void Journal::SetAllPrintLevels(
@@ -343,6 +413,7 @@ namespace Ipopt
          category++) {
       print_levels_[category] = (Index) level;
     }
+    IncreasePrintLevelsVersion();
   }
 
 
@@ -425,6 +496,466 @@ namespace Ipopt
   }
 
 
+  ///////////////////////////////////////////////////////////////////////////
+  //              Implementation of the AsyncFileJournal class             //
+  ///////////////////////////////////////////////////////////////////////////
+
+#ifdef IP_ASYNC_JOURNAL
+  /** Synchronization objects of an AsyncFileJournal.  They are only
+   *  used to put a thread to sleep while it has to wait for the other
+   *  one; the ring buffer itself is accessed without locking. */
+  struct AsyncJournalSync
+  {
+    pthread_mutex_t mutex;
+    /** Signaled when there is new output, or when a flush or the
+     *  termination of the writer thread is requested, while the
+     *  writer thread is waiting */
+    pthread_cond_t data_cond;
+    /** Signaled when the writer thread has taken output out of the
+     *  ring buffer while the printing thread is waiting */
+    pthread_cond_t space_cond;
+  };
+#endif
+
+  AsyncFileJournal::AsyncFileJournal(
+    const std::string& name,
+    EJournalLevel default_level,
+    Index buffer_size
+  )
+      :
+      Journal(name, default_level),
+      file_(NULL),
+      ring_(NULL),
+      ring_size_(1),
+      head_(0),
+      tail_(0),
+      flush_requested_(0),
+      stop_(0),
+      writer_waiting_(0),
+      printer_waiting_(0),
+      writer_(NULL),
+      sync_(NULL)
+  {
+    // The size of the ring buffer must be a power of two, so that
+    // positions can be computed with a mask
+    while (ring_size_ < (unsigned long)buffer_size) {
+      ring_size_ *= 2;
+    }
+  }
+
+  AsyncFileJournal::~AsyncFileJournal()
+  {
+    Close();
+#ifdef IP_ASYNC_JOURNAL
+    if (sync_) {
+      AsyncJournalSync* sync = static_cast<AsyncJournalSync*>(sync_);
+      pthread_cond_destroy(&sync->space_cond);
+      pthread_cond_destroy(&sync->data_cond);
+      pthread_mutex_destroy(&sync->mutex);
+      delete sync;
+    }
+#endif
+    delete [] ring_;
+  }
+
+  bool AsyncFileJournal::Open(const char* fname)
+  {
+    Close();
+
+    if (strcmp("stdout", fname)==0) {
+      file_=stdout;
+    }
+    else if (strcmp("stderr", fname)==0) {
+      file_=stderr;
+    }
+    else {
+      // open the file on disk
+      file_ = fopen(fname, "w+");
+      if (!file_) {
+        return false;
+      }
+    }
+
+#ifdef IP_ASYNC_JOURNAL
+    if (!ring_) {
+      ring_ = new char[ring_size_];
+    }
+    if (!sync_) {
+      AsyncJournalSync* sync = new AsyncJournalSync;
+      pthread_mutex_init(&sync->mutex, NULL);
+      pthread_cond_init(&sync->data_cond, NULL);
+      pthread_cond_init(&sync->space_cond, NULL);
+      sync_ = sync;
+    }
+    head_ = 0;
+    tail_ = 0;
+    flush_requested_ = 0;
+    stop_ = 0;
+    writer_waiting_ = 0;
+    printer_waiting_ = 0;
+    pthread_t* writer = new pthread_t;
+    if (pthread_create(writer, NULL, WriterThread, this) == 0) {
+      writer_ = writer;
+    }
+    else {
+      // Write synchronously if no thread could be started
+      delete writer;
+    }
+#endif
+
+    return true;
+  }
+
+  void AsyncFileJournal::Close()
+  {
+#ifdef IP_ASYNC_JOURNAL
+    if (writer_) {
+      AsyncJournalSync* sync = static_cast<AsyncJournalSync*>(sync_);
+      pthread_t* writer = static_cast<pthread_t*>(writer_);
+      stop_ = 1;
+      __sync_synchronize();
+      pthread_mutex_lock(&sync->mutex);
+      pthread_cond_signal(&sync->data_cond);
+      pthread_mutex_unlock(&sync->mutex);
+      pthread_join(*writer, NULL);
+      delete writer;
+      writer_ = NULL;
+    }
+#endif
+    if (file_ && file_ != stdout && file_ != stderr) {
+      fclose(file_);
+    }
+    else if (file_) {
+      fflush(file_);
+    }
+    file_ = NULL;
+  }
+
+  void* AsyncFileJournal::WriterThread(void* arg)
+  {
+#ifdef IP_ASYNC_JOURNAL
+    AsyncFileJournal* jrnl = static_cast<AsyncFileJournal*>(arg);
+    AsyncJournalSync* sync = static_cast<AsyncJournalSync*>(jrnl->sync_);
+    const unsigned long mask = jrnl->ring_size_ - 1;
+    while (true) {
+      // The requests are read before head_, so that all output
+      // printed before a flush or stop request is written
+      bool stop = (jrnl->stop_ != 0);
+      bool flush = (__sync_lock_test_and_set(&jrnl->flush_requested_, 0) != 0);
+      __sync_synchronize();
+      unsigned long head = jrnl->head_;
+      unsigned long tail = jrnl->tail_;
+      // The output must be read only after head_
+      __sync_synchronize();
+
+      if (tail == head && !flush) {
+        if (stop) {
+          break;
+        }
+        // Nothing to do; sleep until the printing thread wakes us.
+        // The flag is set before the buffer is checked again, and
+        // the printing thread checks the flag after it has changed
+        // head_, so that no wakeup is lost.
+        pthread_mutex_lock(&sync->mutex);
+        jrnl->writer_waiting_ = 1;
+        __sync_synchronize();
+        while (jrnl->head_ == jrnl->tail_ && !jrnl->flush_requested_ &&
+               !jrnl->stop_) {
+          pthread_cond_wait(&sync->data_cond, &sync->mutex);
+        }
+        jrnl->writer_waiting_ = 0;
+        pthread_mutex_unlock(&sync->mutex);
+        continue;
+      }
+
+      while (tail != head) {
+        unsigned long pos = tail & mask;
+        unsigned long len = head - tail;
+        if (len > jrnl->ring_size_ - pos) {
+          len = jrnl->ring_size_ - pos;
+        }
+        fwrite(jrnl->ring_ + pos, 1, len, jrnl->file_);
+        tail += len;
+      }
+      if (flush || stop) {
+        fflush(jrnl->file_);
+      }
+
+      // Give the space free only after the output has been read
+      __sync_synchronize();
+      jrnl->tail_ = tail;
+      __sync_synchronize();
+      if (jrnl->printer_waiting_) {
+        pthread_mutex_lock(&sync->mutex);
+        pthread_cond_broadcast(&sync->space_cond);
+        pthread_mutex_unlock(&sync->mutex);
+      }
+    }
+#endif
+    return NULL;
+  }
+
+#ifdef IP_ASYNC_JOURNAL
+  void AsyncFileJournal::WakeWriter()
+  {
+    // Make the new head_ or flag visible before checking whether the
+    // writer thread sleeps
+    __sync_synchronize();
+    if (writer_waiting_) {
+      AsyncJournalSync* sync = static_cast<AsyncJournalSync*>(sync_);
+      pthread_mutex_lock(&sync->mutex);
+      pthread_cond_signal(&sync->data_cond);
+      pthread_mutex_unlock(&sync->mutex);
+    }
+  }
+
+  void AsyncFileJournal::WaitForWriter(unsigned long min_tail)
+  {
+    WakeWriter();
+    AsyncJournalSync* sync = static_cast<AsyncJournalSync*>(sync_);
+    pthread_mutex_lock(&sync->mutex);
+    printer_waiting_ = 1;
+    __sync_synchronize();
+    while ((long)(tail_ - min_tail) < 0) {
+      pthread_cond_wait(&sync->space_cond, &sync->mutex);
+    }
+    printer_waiting_ = 0;
+    pthread_mutex_unlock(&sync->mutex);
+  }
+#endif
+
+  void AsyncFileJournal::Write(const char* str, size_t len)
+  {
+#ifdef IP_ASYNC_JOURNAL
+    if (writer_) {
+      const unsigned long mask = ring_size_ - 1;
+      // Only this thread changes head_
+      unsigned long head = head_;
+      while (len > 0) {
+        unsigned long space = ring_size_ - (head - tail_);
+        if (space == 0) {
+          // Buffer is full, wait until the writer thread has taken
+          // at least one character out
+          WaitForWriter(head - ring_size_ + 1);
+          continue;
+        }
+        // Do not overwrite output before the writer thread has read it
+        __sync_synchronize();
+        unsigned long n = (len < space) ? (unsigned long)len : space;
+        unsigned long pos = head & mask;
+        unsigned long n1 = (n < ring_size_ - pos) ? n : ring_size_ - pos;
+        memcpy(ring_ + pos, str, n1);
+        memcpy(ring_, str + n1, n - n1);
+        head += n;
+        str += n;
+        len -= n;
+        // The output must be in the buffer before head_ is changed
+        __sync_synchronize();
+        head_ = head;
+      }
+      WakeWriter();
+      return;
+    }
+#endif
+    fwrite(str, 1, len, file_);
+  }
+
+  void AsyncFileJournal::PrintImpl(EJournalCategory category, EJournalLevel level,
+                                   const char* str)
+  {
+    DBG_START_METH("AsyncFileJournal::PrintImpl", 0);
+    if (file_) {
+      Write(str, strlen(str));
+    }
+  }
+
+  void AsyncFileJournal::PrintfImpl(EJournalCategory category, EJournalLevel level,
+                                    const char* pformat, va_list ap)
+  {
+    DBG_START_METH("AsyncFileJournal::PrintfImpl", 0);
+    if (!file_) {
+      return;
+    }
+#if defined(HAVE_VA_COPY) && (defined(HAVE_VSNPRINTF) || defined(HAVE__VSNPRINTF))
+    // Format into buffer_; if the output does not fit, format it
+    // again into a larger buffer, so that long lines are not cut off
+    char* buffer = buffer_;
+    int size = (int)sizeof(buffer_);
+    int len;
+    while (true) {
+      va_list apcopy;
+      va_copy(apcopy, ap);
+# ifdef HAVE_VSNPRINTF
+      len = vsnprintf(buffer, size, pformat, apcopy);
+# else
+      len = _vsnprintf(buffer, size, pformat, apcopy);
+# endif
+      va_end(apcopy);
+      if (len >= 0 && len < size) {
+        break;
+      }
+      if (buffer != buffer_) {
+        delete [] buffer;
+      }
+      // _vsnprintf returns -1 if the output does not fit
+      size = (len >= 0) ? len + 1 : 2*size;
+      buffer = new char[size];
+    }
+    Write(buffer, len);
+    if (buffer != buffer_) {
+      delete [] buffer;
+    }
+#else
+    // Without va_copy the arguments can only be formatted once, so
+    // write directly to the file, after all buffered output
+    Synchronize();
+    vfprintf(file_, pformat, ap);
+#endif
+  }
+
+  void AsyncFileJournal::FlushBufferImpl()
+  {
+    if (!file_) {
+      return;
+    }
+#ifdef IP_ASYNC_JOURNAL
+    if (writer_) {
+      flush_requested_ = 1;
+      WakeWriter();
+      return;
+    }
+#endif
+    fflush(file_);
+  }
+
+  void AsyncFileJournal::Synchronize()
+  {
+    if (!file_) {
+      return;
+    }
+#ifdef IP_ASYNC_JOURNAL
+    if (writer_) {
+      WaitForWriter(head_);
+    }
+#endif
+    fflush(file_);
+  }
+
+
+  ///////////////////////////////////////////////////////////////////////////
+  //                Implementation of the TraceJournal class               //
+  ///////////////////////////////////////////////////////////////////////////
+
+  /** Identification at the beginning of a trace file */
+  static const char trace_magic[] = "IPTRACE1";
+
+  TraceJournal::TraceJournal(const std::string& name)
+      :
+      Journal(name, J_NONE),
+      file_(NULL),
+      n_columns_(0)
+  {}
+
+  TraceJournal::~TraceJournal()
+  {
+    if (file_) {
+      fclose(file_);
+    }
+    file_ = NULL;
+  }
+
+  bool TraceJournal::Open(const char* fname)
+  {
+    if (file_) {
+      fclose(file_);
+    }
+    n_columns_ = 0;
+
+    file_ = fopen(fname, "wb");
+    return (file_ != NULL);
+  }
+
+  void TraceJournal::SetColumns(Index n_columns, const char* const* column_names)
+  {
+    if (n_columns_ > 0) {
+      DBG_ASSERT(n_columns == n_columns_);
+      return;
+    }
+    n_columns_ = n_columns;
+    if (!file_) {
+      return;
+    }
+    const Index one = 1;
+    fwrite(trace_magic, 1, strlen(trace_magic), file_);
+    fwrite(&one, sizeof(Index), 1, file_);
+    fwrite(&n_columns, sizeof(Index), 1, file_);
+    for (Index i=0; i<n_columns; i++) {
+      Index len = (Index)strlen(column_names[i]);
+      fwrite(&len, sizeof(Index), 1, file_);
+      fwrite(column_names[i], 1, len, file_);
+    }
+  }
+
+  void TraceJournal::WriteRow(const Number* values)
+  {
+    DBG_ASSERT(n_columns_ > 0);
+    if (file_) {
+      fwrite(values, sizeof(Number), n_columns_, file_);
+    }
+  }
+
+  void TraceJournal::FlushBufferImpl()
+  {
+    if (file_) {
+      fflush(file_);
+    }
+  }
+
+  bool TraceJournal::ReadTrace(const std::string& fname,
+                               std::vector<std::string>& column_names,
+                               std::vector<Number>& values)
+  {
+    column_names.clear();
+    values.clear();
+
+    FILE* fp = fopen(fname.c_str(), "rb");
+    if (!fp) {
+      return false;
+    }
+
+    bool retval = false;
+    char magic[sizeof(trace_magic)];
+    Index one, n_columns;
+    if (fread(magic, 1, strlen(trace_magic), fp) == strlen(trace_magic) &&
+        strncmp(magic, trace_magic, strlen(trace_magic)) == 0 &&
+        fread(&one, sizeof(Index), 1, fp) == 1 && one == 1 &&
+        fread(&n_columns, sizeof(Index), 1, fp) == 1 && n_columns > 0) {
+      retval = true;
+      for (Index i=0; i<n_columns && retval; i++) {
+        Index len;
+        retval = (fread(&len, sizeof(Index), 1, fp) == 1 && len >= 0);
+        if (retval) {
+          std::string name(len, ' ');
+          if (len > 0) {
+            retval = (fread(&name[0], 1, len, fp) == (size_t)len);
+          }
+          column_names.push_back(name);
+        }
+      }
+      // Read the rows; an incomplete last row (e.g., if the
+      // optimization was aborted) is ignored
+      std::vector<Number> row(n_columns);
+      while (retval &&
+             fread(&row[0], sizeof(Number), n_columns, fp) == (size_t)n_columns) {
+        values.insert(values.end(), row.begin(), row.end());
+      }
+    }
+
+    fclose(fp);
+    return retval;
+  }
+
+
   ///////////////////////////////////////////////////////////////////////////
   //                 Implementation of the StreamJournal class               //
   ///////////////////////////////////////////////////////////////////////////
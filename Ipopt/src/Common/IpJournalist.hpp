@@ -44,6 +44,8 @@ namespace Ipopt
   // forward declarations
   class Journal;
   class FileJournal;
+  class AsyncFileJournal;
+  class TraceJournal;
 
   /**@name Journalist Enumerations. */
   //@{
@@ -189,6 +191,13 @@ namespace Ipopt
      *  This is useful if expensive computation would be required for
      *  a particular output.  The author code can check with this
      *  method if the computations are indeed required.
+     *
+     *  The answer is looked up in a table with the largest accepted
+     *  level for each category, which is recomputed only after a
+     *  journal has been added or the print level of a journal has
+     *  been changed.  Therefore, the acceptance of a Journal must
+     *  only depend on its print levels, and a journal that accepts a
+     *  level must also accept all smaller levels.
      */
     virtual bool ProduceOutput(EJournalLevel level,
                                EJournalCategory category) const;
@@ -199,6 +208,11 @@ namespace Ipopt
      cluttering output with that produced by other parts of the
      program (e.g. written in Fortran) */
     virtual void FlushBuffer() const;
+
+    /** Method that waits until all output has been written by all
+     *  Journals.  This differs from FlushBuffer only for Journals
+     *  that write asynchronously, such as the AsyncFileJournal. */
+    virtual void Synchronize() const;
     //@}
 
     /**@name Reader Methods.
@@ -239,6 +253,11 @@ namespace Ipopt
      */
     virtual SmartPtr<Journal> GetJournal(const std::string& location_name);
 
+    /** Get an existing journal through a const Journalist, e.g., for
+     *  algorithm objects that want to write to a journal of a
+     *  specific type.  Returns NULL if there is no such journal. */
+    SmartPtr<Journal> FindJournal(const std::string& location_name) const;
+
     /** Delete all journals curently known by the journalist. */
     virtual void DeleteAllJournals();
     //@}
@@ -259,9 +278,20 @@ namespace Ipopt
     void operator=(const Journalist&);
     //@}
 
+    /** Recompute accepted_levels_ from the current journals. */
+    void UpdateAcceptedLevels() const;
+
     //** Private Data Members. */
     //@{
     std::vector< SmartPtr<Journal> > journals_;
+
+    /** Largest level that is accepted by any journal, for each
+     *  category (J_INSUPPRESSIBLE-1 if there is no journal). */
+    mutable Index accepted_levels_[J_LAST_CATEGORY];
+
+    /** Value of Journal::PrintLevelsVersion() when accepted_levels_
+     *  was computed, or -1 if it must be recomputed. */
+    mutable Index accepted_levels_version_;
     //@}
   };
 
@@ -326,8 +356,24 @@ namespace Ipopt
     {
       FlushBufferImpl();
     }
+
+    /** Wait until all output has been written to the output
+     *  location.  This is the same as FlushBuffer, unless the
+     *  Journal writes asynchronously. */
+    virtual void Synchronize()
+    {
+      FlushBufferImpl();
+    }
     //@}
 
+    /** Counter that is increased whenever the print level of any
+     *  Journal is changed.  This is used by the Journalist to decide
+     *  whether its table of accepted levels is still up to date. */
+    static Index PrintLevelsVersion()
+    {
+      return print_levels_version_;
+    }
+
   protected:
     /**@name Implementation version of Print methods. Derived classes
      * should overload the Impl methods.
@@ -369,6 +415,14 @@ namespace Ipopt
 
     /** vector of integers indicating the level for each category */
     Index print_levels_[J_LAST_CATEGORY];
+
+    /** Increase the counter returned by PrintLevelsVersion.  This is
+     *  an atomic operation, since the journals of different threads
+     *  share the counter. */
+    static void IncreasePrintLevelsVersion();
+
+    /** Counter returned by PrintLevelsVersion */
+    static volatile Index print_levels_version_;
   };
 
 
@@ -434,6 +488,232 @@ namespace Ipopt
     FILE* file_;
   };
 
+  /** AsyncFileJournal class.  This is a Journal implementation that
+   *  writes to a file (or stdout or stderr) like the FileJournal, but
+   *  it only copies the formatted output into a ring buffer of fixed
+   *  size.  The buffer is written to the file by a separate writer
+   *  thread, so that slow output does not delay the thread that is
+   *  printing.  The printing thread and the writer thread share the
+   *  ring buffer without a lock; a mutex is only taken to wake up a
+   *  thread that sleeps because the buffer is empty (writer thread)
+   *  or full (printing thread).  Output longer than the buffer is
+   *  written in several pieces.  FlushBuffer only asks the writer
+   *  thread to flush the file; Synchronize waits until all output
+   *  has been written.
+   *
+   *  Only one thread may print to the journal at a time.  If Ipopt
+   *  has been compiled without POSIX threads, the output is written
+   *  directly, as in the FileJournal.
+   */
+  class AsyncFileJournal : public Journal
+  {
+  public:
+    /** Constructor.  buffer_size is the size of the ring buffer in
+     *  bytes; it is rounded up to a power of two. */
+    AsyncFileJournal(const std::string& name, EJournalLevel default_level,
+                     Index buffer_size = 1048576);
+
+    /** Destructor.  This writes all remaining output. */
+    virtual ~AsyncFileJournal();
+
+    /** Open a new file for the output location.
+     *  Special Names: stdout means stdout,
+     *               : stderr means stderr.
+     *
+     *  Return code is false only if the file with the given name
+     *  could not be opened.
+     */
+    virtual bool Open(const char* fname);
+
+    /** Wait until all output has been written to the file. */
+    virtual void Synchronize();
+
+  protected:
+    /**@name Implementation version of Print methods - Overloaded from
+     * Journal base class.
+     */
+    //@{
+    /** Print to the designated output location */
+    virtual void PrintImpl(EJournalCategory category, EJournalLevel level,
+                           const char* str);
+
+    /** Printf to the designated output location */
+    virtual void PrintfImpl(EJournalCategory category, EJournalLevel level,
+                            const char* pformat, va_list ap);
+
+    /** Flush output buffer.*/
+    virtual void FlushBufferImpl();
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    AsyncFileJournal();
+
+    /** Copy Constructor */
+    AsyncFileJournal(const AsyncFileJournal&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const AsyncFileJournal&);
+    //@}
+
+    /** Copy len characters into the ring buffer (or write them
+     *  directly if there is no writer thread) */
+    void Write(const char* str, size_t len);
+
+    /** Wake up the writer thread if it is waiting for output */
+    void WakeWriter();
+
+    /** Wait until the writer thread has taken all characters before
+     *  position min_tail out of the ring buffer */
+    void WaitForWriter(unsigned long min_tail);
+
+    /** Stop the writer thread after it has written all output, and
+     *  close the file */
+    void Close();
+
+    /** Main loop of the writer thread; arg is the journal */
+    static void* WriterThread(void* arg);
+
+    /** FILE pointer for the output destination */
+    FILE* file_;
+
+    /** @name Ring buffer.  head_ and tail_ are the total number of
+     *  characters written into and taken out of the buffer; only the
+     *  printing thread changes head_, and only the writer thread
+     *  changes tail_.  Each thread changes its position only after
+     *  a memory barrier, so that the other thread sees the
+     *  characters (or the free space) when it sees the new
+     *  position. */
+    //@{
+    char* ring_;
+    unsigned long ring_size_;
+    volatile unsigned long head_;
+    volatile unsigned long tail_;
+    //@}
+
+    /** Flag set by FlushBufferImpl to ask the writer thread to flush
+     *  the file */
+    volatile int flush_requested_;
+
+    /** Flag asking the writer thread to terminate */
+    volatile int stop_;
+
+    /** @name Flags telling that a thread sleeps on a condition
+     *  variable and has to be signaled */
+    //@{
+    volatile int writer_waiting_;
+    volatile int printer_waiting_;
+    //@}
+
+    /** Handle of the writer thread, NULL if there is none */
+    void* writer_;
+
+    /** Mutex and condition variables (hidden to avoid including
+     *  pthread.h here) */
+    void* sync_;
+
+    /** buffer for vsnprintf */
+    char buffer_[32768];
+  };
+
+  /** TraceJournal class.  This Journal writes a binary table of
+   *  numbers, e.g., one row with performance data per iteration, to
+   *  a file.  It does not accept any text output.  The columns are
+   *  defined by SetColumns before the first row is written with
+   *  WriteRow.  The file consists of the characters "IPTRACE1", the
+   *  Index 1 (to detect a different byte order), the number of
+   *  columns, for each column the length of its name and the name
+   *  (without terminating zero), and then the rows, each as the
+   *  given number of Numbers.  Such a file can be read with
+   *  ReadTrace.
+   */
+  class TraceJournal : public Journal
+  {
+  public:
+    /** Constructor. */
+    TraceJournal(const std::string& name);
+
+    /** Destructor. */
+    virtual ~TraceJournal();
+
+    /** Open a new file for the trace.  Return code is false only if
+     *  the file with the given name could not be opened. */
+    virtual bool Open(const char* fname);
+
+    /** Define the columns of the table.  This writes the header of
+     *  the file, if it has not been written yet; otherwise the
+     *  number of columns must be the same as before. */
+    virtual void SetColumns(Index n_columns, const char* const* column_names);
+
+    /** Write one row with as many values as there are columns. */
+    virtual void WriteRow(const Number* values);
+
+    /** Number of columns set by SetColumns, 0 if not called yet */
+    Index NumColumns() const
+    {
+      return n_columns_;
+    }
+
+    /** Read a file written by a TraceJournal.  The rows are returned
+     *  one after another in values.  Returns false if the file could
+     *  not be read or does not have the expected format. */
+    static bool ReadTrace(const std::string& fname,
+                          std::vector<std::string>& column_names,
+                          std::vector<Number>& values);
+
+  protected:
+    /**@name Implementation version of Print methods - Overloaded from
+     * Journal base class.  No text output is written.
+     */
+    //@{
+    /** Print to the designated output location */
+    virtual void PrintImpl(EJournalCategory category, EJournalLevel level,
+                           const char* str)
+    {}
+
+    /** Printf to the designated output location */
+    virtual void PrintfImpl(EJournalCategory category, EJournalLevel level,
+                            const char* pformat, va_list ap)
+    {}
+
+    /** Flush output buffer.*/
+    virtual void FlushBufferImpl();
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    TraceJournal();
+
+    /** Copy Constructor */
+    TraceJournal(const TraceJournal&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const TraceJournal&);
+    //@}
+
+    /** FILE pointer for the output destination */
+    FILE* file_;
+
+    /** Number of columns in the table */
+    Index n_columns_;
+  };
+
   /** StreamJournal class. This is a particular Journal implementation that
    *  writes to a stream for output.
    */
@@ -120,6 +120,7 @@ namespace Ipopt
       //    if (will_allow_clobber(tag)) {
       OptionsList::OptionValue optval(value, allow_clobber, dont_print);
       options_[lowercase(tag)] = optval;
+      clear_resolved_values();
     }
     return true;
 
@@ -204,6 +205,7 @@ namespace Ipopt
     else {
       OptionsList::OptionValue optval(buffer, allow_clobber, dont_print);
       options_[lowercase(tag)] = optval;
+      clear_resolved_values();
     }
     return true;
   }
@@ -280,6 +282,7 @@ namespace Ipopt
       //    if (will_allow_clobber(tag)) {
       OptionsList::OptionValue optval(buffer, allow_clobber, dont_print);
       options_[lowercase(tag)] = optval;
+      clear_resolved_values();
     }
     return true;
   }
@@ -323,47 +326,57 @@ namespace Ipopt
     return true;
   }
 
+  OptionsList::OptionHandle
+  OptionsList::GetOptionHandle(const std::string& tag,
+                               const std::string& prefix) const
+  {
+    ASSERT_EXCEPTION(IsValid(reg_options_), OPTION_INVALID,
+                     "Option handles are only available for registered options.");
+    OptionHandle handle;
+    handle.option_ = registered_option(tag);
+    handle.tag_ = tag;
+    handle.prefix_index_ = prefix_index(prefix);
+    return handle;
+  }
+
   bool OptionsList::GetStringValue(const std::string& tag, std::string& value,
                                    const std::string& prefix) const
   {
-    SmartPtr<const RegisteredOption> option = NULL;
-
-    bool found = find_tag(tag, prefix, value);
+    if (IsNull(reg_options_)) {
+      return find_tag(tag, prefix, value);
+    }
 
-    if (IsValid(reg_options_)) {
-      option = reg_options_->GetOption(tag);
-      if (IsNull(option)) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is not a valid registered option.";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+    SmartPtr<const RegisteredOption> option = registered_option(tag);
+    check_option_type(*option, tag, OT_String);
+    ResolvedValue& resolved = resolve_option(*option, tag, prefix_index(prefix));
+    return string_value(*option, resolved, value);
+  }
 
-      if (option->Type() != OT_String) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is a valid option, but it is of type ";
-        if (option->Type() == OT_Integer) {
-          msg += " Integer";
-        }
-        else if (option->Type() == OT_Number) {
-          msg += " Number";
-        }
-        else {
-          msg += " Unknown";
-        }
-        msg += ", not of type String. Please check the documentation for options.";
-        if (IsValid(jnlst_)) {
-          option->OutputDescription(*jnlst_);
-        }
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+  bool OptionsList::GetStringValue(const OptionHandle& handle,
+                                   std::string& value) const
+  {
+    check_option_type(*handle.option_, handle.tag_, OT_String);
+    ResolvedValue& resolved =
+      resolve_option(*handle.option_, handle.tag_, handle.prefix_index_);
+    return string_value(*handle.option_, resolved, value);
+  }
 
+  bool OptionsList::string_value(const RegisteredOption& option,
+                                 ResolvedValue& resolved,
+                                 std::string& value) const
+  {
+    bool found = (resolved.option_value_ != NULL);
+    if (!resolved.has_string_) {
       if (found) {
-        value = option->MapStringSetting(value);
+        resolved.string_value_ =
+          option.MapStringSetting(resolved.option_value_->Value());
       }
       else {
-        value = option->DefaultString();
+        resolved.string_value_ = option.DefaultString();
       }
+      resolved.has_string_ = true;
     }
+    value = resolved.string_value_;
 
     return found;
   }
@@ -371,45 +384,40 @@ namespace Ipopt
   bool OptionsList::GetEnumValue(const std::string& tag, Index& value,
                                  const std::string& prefix) const
   {
-    std::string str;
-    SmartPtr<const RegisteredOption> option = NULL;
-
-    bool found = find_tag(tag, prefix, str);
+    if (IsNull(reg_options_)) {
+      std::string str;
+      return find_tag(tag, prefix, str);
+    }
 
-    if (IsValid(reg_options_)) {
-      option = reg_options_->GetOption(tag);
-      if (IsNull(option)) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is not a valid registered option.";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+    SmartPtr<const RegisteredOption> option = registered_option(tag);
+    check_option_type(*option, tag, OT_String);
+    ResolvedValue& resolved = resolve_option(*option, tag, prefix_index(prefix));
+    return enum_value(*option, resolved, value);
+  }
 
-      if (option->Type() != OT_String) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is a valid option, but it is of type ";
-        if (option->Type() == OT_Integer) {
-          msg += " Integer";
-        }
-        else if (option->Type() == OT_Number) {
-          msg += " Number";
-        }
-        else {
-          msg += " Unknown";
-        }
-        msg += ", not of type String. Please check the documentation for options.";
-        if (IsValid(jnlst_)) {
-          option->OutputDescription(*jnlst_);
-        }
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+  bool OptionsList::GetEnumValue(const OptionHandle& handle, Index& value) const
+  {
+    check_option_type(*handle.option_, handle.tag_, OT_String);
+    ResolvedValue& resolved =
+      resolve_option(*handle.option_, handle.tag_, handle.prefix_index_);
+    return enum_value(*handle.option_, resolved, value);
+  }
 
+  bool OptionsList::enum_value(const RegisteredOption& option,
+                               ResolvedValue& resolved, Index& value) const
+  {
+    bool found = (resolved.option_value_ != NULL);
+    if (!resolved.has_enum_) {
       if (found) {
-        value = option->MapStringSettingToEnum(str);
+        resolved.enum_value_ =
+          option.MapStringSettingToEnum(resolved.option_value_->Value());
       }
       else {
-        value = option->DefaultStringAsEnum();
+        resolved.enum_value_ = option.DefaultStringAsEnum();
       }
+      resolved.has_enum_ = true;
     }
+    value = resolved.enum_value_;
 
     return found;
   }
@@ -417,137 +425,184 @@ namespace Ipopt
   bool OptionsList::GetBoolValue(const std::string& tag, bool& value,
                                  const std::string& prefix) const
   {
-    std::string str;
-    bool ret = GetStringValue(tag, str, prefix);
+    if (IsNull(reg_options_)) {
+      std::string str;
+      bool ret = find_tag(tag, prefix, str);
+      value = ParseBool(str);
+      return ret;
+    }
+
+    SmartPtr<const RegisteredOption> option = registered_option(tag);
+    check_option_type(*option, tag, OT_String);
+    ResolvedValue& resolved = resolve_option(*option, tag, prefix_index(prefix));
+    return bool_value(*option, resolved, value);
+  }
+
+  bool OptionsList::GetBoolValue(const OptionHandle& handle, bool& value) const
+  {
+    check_option_type(*handle.option_, handle.tag_, OT_String);
+    ResolvedValue& resolved =
+      resolve_option(*handle.option_, handle.tag_, handle.prefix_index_);
+    return bool_value(*handle.option_, resolved, value);
+  }
+
+  bool OptionsList::bool_value(const RegisteredOption& option,
+                               ResolvedValue& resolved, bool& value) const
+  {
+    if (!resolved.has_bool_) {
+      std::string str;
+      string_value(option, resolved, str);
+      resolved.bool_value_ = ParseBool(str);
+      resolved.has_bool_ = true;
+    }
+    value = resolved.bool_value_;
+
+    return (resolved.option_value_ != NULL);
+  }
+
+  bool OptionsList::ParseBool(const std::string& str) const
+  {
     if (str == "no" || str == "false" || str == "off") {
-      value = false;
+      return false;
     }
     else if (str == "yes" || str == "true" || str == "on") {
-      value = true;
-    }
-    else {
-      THROW_EXCEPTION(OPTION_INVALID, "Tried to get a boolean from an option and failed.");
+      return true;
     }
-
-    return ret;
+    THROW_EXCEPTION(OPTION_INVALID, "Tried to get a boolean from an option and failed.");
+    return false;
   }
 
   bool OptionsList::GetNumericValue(const std::string& tag, Number& value,
                                     const std::string& prefix) const
   {
-    SmartPtr<const RegisteredOption> option = NULL;
-
     if (IsValid(reg_options_)) {
-      option = reg_options_->GetOption(tag);
-      if (IsNull(option)) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is not a valid registered option.";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
-
-      if (option->Type() != OT_Number) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is a valid option, but it is of type ";
-        if (option->Type() == OT_Integer) {
-          msg += " Integer";
-        }
-        else if (option->Type() == OT_String) {
-          msg += " String";
-        }
-        else {
-          msg += " Unknown";
-        }
-        msg += ", not of type Number. Please check the documentation for options.";
-        if (IsValid(jnlst_)) {
-          option->OutputDescription(*jnlst_);
-        }
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+      SmartPtr<const RegisteredOption> option = registered_option(tag);
+      check_option_type(*option, tag, OT_Number);
+      ResolvedValue& resolved =
+        resolve_option(*option, tag, prefix_index(prefix));
+      return number_value(*option, tag, resolved, value);
     }
 
     std::string strvalue;
     if (find_tag(tag, prefix, strvalue)) {
-      // Some people like to use 'd' instead of 'e' in floating point
-      // numbers.  Therefore, we change a 'd' to an 'e'
-      char* buffer = new char[strvalue.length()+1];
-      strcpy(buffer, strvalue.c_str());
-      for (int i=0; i<(int)strvalue.length(); ++i) {
-        if (buffer[i]=='d' || buffer[i]=='D') {
-          buffer[i] = 'e';
-        }
+      value = ParseNumber(tag, strvalue);
+      return true;
+    }
+    return false;
+  }
+
+  bool OptionsList::GetNumericValue(const OptionHandle& handle,
+                                    Number& value) const
+  {
+    check_option_type(*handle.option_, handle.tag_, OT_Number);
+    ResolvedValue& resolved =
+      resolve_option(*handle.option_, handle.tag_, handle.prefix_index_);
+    return number_value(*handle.option_, handle.tag_, resolved, value);
+  }
+
+  bool OptionsList::number_value(const RegisteredOption& option,
+                                 const std::string& tag,
+                                 ResolvedValue& resolved, Number& value) const
+  {
+    if (!resolved.has_number_) {
+      if (resolved.option_value_) {
+        // Parse the value only once; the request counter has been
+        // increased already by resolve_option
+        resolved.number_value_ =
+          ParseNumber(tag, resolved.option_value_->Value());
       }
-      char* p_end;
-      Number retval = strtod(buffer, &p_end);
-      if (*p_end!='\0' && !isspace(*p_end)) {
-        delete [] buffer;
-        std::string msg = "Option \"" + tag +
-                          "\": Double value expected, but non-numeric value \"" +
-                          strvalue+"\" found.\n";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
+      else {
+        resolved.number_value_ = option.DefaultNumber();
       }
-      delete [] buffer;
-      value = retval;
-      return true;
+      resolved.has_number_ = true;
     }
-    else if (IsValid(option)) {
-      value = option->DefaultNumber();
-      return false;
+    value = resolved.number_value_;
+    return (resolved.option_value_ != NULL);
+  }
+
+  Number OptionsList::ParseNumber(const std::string& tag,
+                                  const std::string& strvalue) const
+  {
+    // Some people like to use 'd' instead of 'e' in floating point
+    // numbers.  Therefore, we change a 'd' to an 'e'
+    char* buffer = new char[strvalue.length()+1];
+    strcpy(buffer, strvalue.c_str());
+    for (int i=0; i<(int)strvalue.length(); ++i) {
+      if (buffer[i]=='d' || buffer[i]=='D') {
+        buffer[i] = 'e';
+      }
+    }
+    char* p_end;
+    Number retval = strtod(buffer, &p_end);
+    if (*p_end!='\0' && !isspace(*p_end)) {
+      delete [] buffer;
+      std::string msg = "Option \"" + tag +
+                        "\": Double value expected, but non-numeric value \"" +
+                        strvalue+"\" found.\n";
+      THROW_EXCEPTION(OPTION_INVALID, msg);
     }
-    return false;
+    delete [] buffer;
+    return retval;
   }
 
   bool OptionsList::GetIntegerValue(const std::string& tag, Index& value,
                                     const std::string& prefix) const
   {
-    SmartPtr<const RegisteredOption> option = NULL;
-
     if (IsValid(reg_options_)) {
-      option = reg_options_->GetOption(tag);
-      if (IsNull(option)) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is not a valid registered option.";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
-
-      if (option->Type() != OT_Integer) {
-        std::string msg = "IPOPT tried to get the value of Option: " + tag;
-        msg += ". It is a valid option, but it is of type ";
-        if (option->Type() == OT_Number) {
-          msg += " Number";
-        }
-        else if (option->Type() == OT_String) {
-          msg += " String";
-        }
-        else {
-          msg += " Unknown";
-        }
-        msg += ", not of type Integer. Please check the documentation for options.";
-        if (IsValid(jnlst_)) {
-          option->OutputDescription(*jnlst_);
-        }
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
+      SmartPtr<const RegisteredOption> option = registered_option(tag);
+      check_option_type(*option, tag, OT_Integer);
+      ResolvedValue& resolved =
+        resolve_option(*option, tag, prefix_index(prefix));
+      return integer_value(*option, tag, resolved, value);
     }
 
     std::string strvalue;
     if (find_tag(tag, prefix, strvalue)) {
-      char* p_end;
-      size_t retval = strtol(strvalue.c_str(), &p_end, 10);
-      if (*p_end!='\0' && !isspace(*p_end)) {
-        std::string msg = "Option \"" + tag +
-                          "\": Integer value expected, but non-integer value \"" +
-                          strvalue+"\" found.\n";
-        THROW_EXCEPTION(OPTION_INVALID, msg);
-      }
-      value = static_cast<Index>(retval);
+      value = ParseInteger(tag, strvalue);
       return true;
     }
-    else if (IsValid(option)) {
-      value = option->DefaultInteger();
-      return false;
+    return false;
+  }
+
+  bool OptionsList::GetIntegerValue(const OptionHandle& handle,
+                                    Index& value) const
+  {
+    check_option_type(*handle.option_, handle.tag_, OT_Integer);
+    ResolvedValue& resolved =
+      resolve_option(*handle.option_, handle.tag_, handle.prefix_index_);
+    return integer_value(*handle.option_, handle.tag_, resolved, value);
+  }
+
+  bool OptionsList::integer_value(const RegisteredOption& option,
+                                  const std::string& tag,
+                                  ResolvedValue& resolved, Index& value) const
+  {
+    if (!resolved.has_integer_) {
+      if (resolved.option_value_) {
+        resolved.integer_value_ =
+          ParseInteger(tag, resolved.option_value_->Value());
+      }
+      else {
+        resolved.integer_value_ = option.DefaultInteger();
+      }
+      resolved.has_integer_ = true;
     }
+    value = resolved.integer_value_;
+    return (resolved.option_value_ != NULL);
+  }
 
-    return false;
+  Index OptionsList::ParseInteger(const std::string& tag,
+                                  const std::string& strvalue) const
+  {
+    char* p_end;
+    size_t retval = strtol(strvalue.c_str(), &p_end, 10);
+    if (*p_end!='\0' && !isspace(*p_end)) {
+      std::string msg = "Option \"" + tag +
+                        "\": Integer value expected, but non-integer value \"" +
+                        strvalue+"\" found.\n";
+      THROW_EXCEPTION(OPTION_INVALID, msg);
+    }
+    return static_cast<Index>(retval);
   }
 
   const std::string& OptionsList::lowercase(const std::string tag) const
@@ -724,6 +779,107 @@ namespace Ipopt
     return found;
   }
 
+  SmartPtr<const RegisteredOption>
+  OptionsList::registered_option(const std::string& tag) const
+  {
+    SmartPtr<const RegisteredOption> option = reg_options_->GetOption(tag);
+    if (IsNull(option)) {
+      std::string msg = "IPOPT tried to get the value of Option: " + tag;
+      msg += ". It is not a valid registered option.";
+      THROW_EXCEPTION(OPTION_INVALID, msg);
+    }
+    return option;
+  }
+
+  /** Name of an option type in error messages */
+  static const char* OptionTypeName(RegisteredOptionType type)
+  {
+    switch (type) {
+    case OT_Number:
+      return "Number";
+    case OT_Integer:
+      return "Integer";
+    case OT_String:
+      return "String";
+    default:
+      return "Unknown";
+    }
+  }
+
+  void OptionsList::check_option_type(const RegisteredOption& option,
+                                      const std::string& tag,
+                                      RegisteredOptionType type) const
+  {
+    if (option.Type() == type) {
+      return;
+    }
+    std::string msg = "IPOPT tried to get the value of Option: " + tag;
+    msg += ". It is a valid option, but it is of type  ";
+    msg += OptionTypeName(option.Type());
+    msg += ", not of type ";
+    msg += OptionTypeName(type);
+    msg += ". Please check the documentation for options.";
+    if (IsValid(jnlst_)) {
+      option.OutputDescription(*jnlst_);
+    }
+    THROW_EXCEPTION(OPTION_INVALID, msg);
+  }
+
+  Index OptionsList::prefix_index(const std::string& prefix) const
+  {
+    // There are only a few prefixes, so a linear search is enough
+    for (Index i=0; i<(Index)prefixes_.size(); i++) {
+      if (prefixes_[i] == prefix) {
+        return i;
+      }
+    }
+    prefixes_.push_back(prefix);
+    resolved_values_.push_back(std::vector<ResolvedValue>());
+    return (Index)prefixes_.size() - 1;
+  }
+
+  void OptionsList::clear_resolved_values()
+  {
+    // The prefixes are kept, so that option handles stay valid
+    for (size_t i=0; i<resolved_values_.size(); i++) {
+      resolved_values_[i].clear();
+    }
+  }
+
+  OptionsList::ResolvedValue&
+  OptionsList::resolve_option(const RegisteredOption& option,
+                              const std::string& tag,
+                              Index prefix_index) const
+  {
+    DBG_ASSERT(prefix_index >= 0 &&
+               prefix_index < (Index)resolved_values_.size());
+    std::vector<ResolvedValue>& values = resolved_values_[prefix_index];
+    const Index idx = option.Counter();
+    if ((Index)values.size() <= idx) {
+      values.resize(idx+1);
+    }
+    ResolvedValue& resolved = values[idx];
+
+    if (!resolved.resolved_) {
+      const std::string& prefix = prefixes_[prefix_index];
+      std::map< std::string, OptionValue >::const_iterator p = options_.end();
+      if (prefix != "") {
+        p = options_.find(lowercase(prefix+tag));
+      }
+      if (p == options_.end()) {
+        p = options_.find(lowercase(tag));
+      }
+      resolved.option_value_ = (p != options_.end()) ? &p->second : NULL;
+      resolved.resolved_ = true;
+    }
+
+    if (resolved.option_value_) {
+      resolved.option_value_->IncreaseCounter();
+    }
+
+    return resolved;
+  }
+
   bool OptionsList::will_allow_clobber(const std::string& tag) const
   {
     bool allow_clobber=true;
@@ -16,6 +16,7 @@
 
 #include <iostream>
 #include <map>
+#include <vector>
 
 namespace Ipopt
 {
@@ -28,6 +29,19 @@ namespace Ipopt
    *  convenience set and get methods are provided to obtain Index and
    *  Number type values.  For each keyword we also keep track of how
    *  often the value of an option has been requested by a get method.
+   *
+   *  Since the same options are requested over and over again (e.g.,
+   *  whenever an algorithm object is initialized), the get methods
+   *  keep the typed value of each registered option, once it has
+   *  been looked up, parsed, and validated, in a table that is
+   *  addressed by the index of the registered option (one table for
+   *  each prefix).  This table is discarded whenever an option is
+   *  set.
+   *
+   *  Code that requests the same option very often can avoid the
+   *  lookup of the tag in the registered options and of the prefix
+   *  by obtaining an OptionHandle once with GetOptionHandle, and by
+   *  passing it to the get methods.
    */
   class OptionsList : public ReferencedObject
   {
@@ -118,6 +132,13 @@ namespace Ipopt
         return dont_print_;
       }
 
+      /** Increase the request counter without retrieving the value */
+      void IncreaseCounter() const
+      {
+        DBG_ASSERT(initialized_);
+        counter_++;
+      }
+
     private:
       /** Value for this option */
       std::string value_;
@@ -136,7 +157,74 @@ namespace Ipopt
       bool dont_print_;
     };
 
+    /** Class for storing the typed value of a registered option for
+     *  a given prefix, as it has been returned by one of the get
+     *  methods. */
+    class ResolvedValue
+    {
+    public:
+      /** Default constructor */
+      ResolvedValue()
+          :
+          resolved_(false),
+          option_value_(NULL),
+          has_string_(false),
+          has_enum_(false),
+          has_number_(false),
+          has_integer_(false),
+          has_bool_(false)
+      {}
+
+      /** True if the option has been looked up */
+      bool resolved_;
+      /** Value set by the user, or NULL if the default is used */
+      const OptionValue* option_value_;
+
+      /** @name Typed values, with flags indicating whether they have
+       *  been computed */
+      //@{
+      bool has_string_;
+      std::string string_value_;
+      bool has_enum_;
+      Index enum_value_;
+      bool has_number_;
+      Number number_value_;
+      bool has_integer_;
+      Index integer_value_;
+      bool has_bool_;
+      bool bool_value_;
+      //@}
+    };
+
   public:
+    /** Handle for a registered option and a prefix, obtained from
+     *  GetOptionHandle.  A handle can be used with the list that
+     *  created it for as long as the registered options of that list
+     *  are not changed (by SetRegisteredOptions or by an assignment);
+     *  setting options does not invalidate it. */
+    class OptionHandle
+    {
+    public:
+      /** Default constructor, the handle cannot be used before a
+       *  handle from GetOptionHandle has been assigned to it */
+      OptionHandle()
+          :
+          prefix_index_(-1)
+      {}
+
+    private:
+      /** Registered option */
+      SmartPtr<const RegisteredOption> option_;
+      /** Tag of the option, for error messages and for the lookup of
+       *  the value */
+      std::string tag_;
+      /** Position of the prefix in the prefix list of the options
+       *  list */
+      Index prefix_index_;
+
+      friend class OptionsList;
+    };
+
     /**@name Constructors/Destructors */
     //@{
     OptionsList(SmartPtr<RegisteredOptions> reg_options, SmartPtr<Journalist> jnlst)
@@ -165,6 +253,7 @@ namespace Ipopt
       options_ = source.options_;
       reg_options_ = source.reg_options_;
       jnlst_ = source.jnlst_;
+      clear_resolved_values();
     }
     //@}
 
@@ -172,6 +261,7 @@ namespace Ipopt
     virtual void clear()
     {
       options_.clear();
+      clear_resolved_values();
     }
 
     /** @name Get / Set Methods */
@@ -179,6 +269,7 @@ namespace Ipopt
     virtual void SetRegisteredOptions(const SmartPtr<RegisteredOptions> reg_options)
     {
       reg_options_ = reg_options;
+      clear_resolved_values();
     }
     virtual void SetJournalist(const SmartPtr<Journalist> jnlst)
     {
@@ -222,6 +313,22 @@ namespace Ipopt
                                  const std::string& prefix) const;
     //@}
 
+    /** @name Methods for retrieving values with an option handle.
+     *  They return the same as the methods above with the tag and
+     *  prefix of the handle, but they do not look up the tag and the
+     *  prefix again. */
+    //@{
+    /** Get the handle for the registered option tag and the prefix.
+     *  Throws OPTION_INVALID if tag is not a registered option. */
+    OptionHandle GetOptionHandle(const std::string& tag,
+                                 const std::string& prefix) const;
+    bool GetStringValue(const OptionHandle& handle, std::string& value) const;
+    bool GetEnumValue(const OptionHandle& handle, Index& value) const;
+    bool GetBoolValue(const OptionHandle& handle, bool& value) const;
+    bool GetNumericValue(const OptionHandle& handle, Number& value) const;
+    bool GetIntegerValue(const OptionHandle& handle, Index& value) const;
+    //@}
+
     /** Get a string with the list of all options (tag, value, counter) */
     virtual void PrintList(std::string& list) const;
 
@@ -251,6 +358,17 @@ namespace Ipopt
     /** map for storing the options */
     std::map< std::string, OptionValue > options_;
 
+    /** Prefixes for which options have been requested so far.
+     *  Prefixes are never removed, since option handles refer to
+     *  them by their position. */
+    mutable std::vector<std::string> prefixes_;
+
+    /** Typed values of the registered options that have been
+     *  requested so far.  For each prefix in prefixes_, the values
+     *  are stored in a vector that is indexed by the counter of the
+     *  registered option. */
+    mutable std::vector< std::vector<ResolvedValue> > resolved_values_;
+
     /** list of all the registered options to validate against */
     SmartPtr<RegisteredOptions> reg_options_;
 
@@ -270,6 +388,66 @@ namespace Ipopt
     bool find_tag(const std::string& tag, const std::string& prefix,
                   std::string& value) const;
 
+    /** auxilliary method for converting the string value of a
+     *  Number option, throws OPTION_INVALID if it is not a number */
+    Number ParseNumber(const std::string& tag,
+                       const std::string& strvalue) const;
+
+    /** auxilliary method for converting the string value of an
+     *  Integer option, throws OPTION_INVALID if it is not an integer */
+    Index ParseInteger(const std::string& tag,
+                       const std::string& strvalue) const;
+
+    /** auxilliary method for converting the string value of a
+     *  bool option, throws OPTION_INVALID if it is not a bool */
+    bool ParseBool(const std::string& str) const;
+
+    /** auxilliary method returning the registered option for tag,
+     *  throws OPTION_INVALID if there is none */
+    SmartPtr<const RegisteredOption>
+    registered_option(const std::string& tag) const;
+
+    /** auxilliary method that throws OPTION_INVALID if the
+     *  registered option is not of the given type */
+    void check_option_type(const RegisteredOption& option,
+                           const std::string& tag,
+                           RegisteredOptionType type) const;
+
+    /** auxilliary method returning the position of prefix in
+     *  prefixes_, the prefix is added if it is not there yet */
+    Index prefix_index(const std::string& prefix) const;
+
+    /** auxilliary method for discarding the resolved values of all
+     *  prefixes */
+    void clear_resolved_values();
+
+    /** auxilliary method for finding the value of a registered option
+     *  in the table of resolved values.  If the option has not been
+     *  looked up for this prefix before, this is done in the same
+     *  way as in find_tag.  The return value is the entry of the
+     *  table; its option_value_ is NULL if the option has not been
+     *  set.  If the option has been set, its request counter is
+     *  increased. */
+    ResolvedValue& resolve_option(const RegisteredOption& option,
+                                  const std::string& tag,
+                                  Index prefix_index) const;
+
+    /** @name auxilliary methods computing the typed value of a
+     *  resolved option, if it has not been computed before.  The
+     *  return value is true iff the option has been set. */
+    //@{
+    bool string_value(const RegisteredOption& option,
+                      ResolvedValue& resolved, std::string& value) const;
+    bool enum_value(const RegisteredOption& option,
+                    ResolvedValue& resolved, Index& value) const;
+    bool bool_value(const RegisteredOption& option,
+                    ResolvedValue& resolved, bool& value) const;
+    bool number_value(const RegisteredOption& option, const std::string& tag,
+                      ResolvedValue& resolved, Number& value) const;
+    bool integer_value(const RegisteredOption& option, const std::string& tag,
+                       ResolvedValue& resolved, Index& value) const;
+    //@}
+
     /** tells whether or not we can clobber a particular option.
      *  returns true if the option does not already exist, or if
      *  the option exists but is set to allow_clobber
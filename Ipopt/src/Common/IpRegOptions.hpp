@@ -72,6 +72,7 @@ namespace Ipopt
 
     RegisteredOption(const RegisteredOption& copy)
         :
+        ReferencedObject(),
         name_(copy.name_),
         short_description_(copy.short_description_),
         long_description_(copy.long_description_),
@@ -399,6 +400,23 @@ namespace Ipopt
         current_registering_category_("Uncategorized")
     {}
 
+    /** Copy Constructor.  The copy contains copies of the
+     *  registered options, so that it shares no reference counted
+     *  objects with the original object and can be used in another
+     *  thread. */
+    RegisteredOptions(const RegisteredOptions& copy)
+        :
+        ReferencedObject(),
+        next_counter_(copy.next_counter_),
+        current_registering_category_("Uncategorized")
+    {
+      std::map<std::string, SmartPtr<RegisteredOption> >::const_iterator it;
+      for (it = copy.registered_options_.begin();
+           it != copy.registered_options_.end(); it++) {
+        registered_options_[it->first] = new RegisteredOption(*it->second);
+      }
+    }
+
     /** Standard Destructor */
     virtual ~RegisteredOptions()
     {}
@@ -649,6 +667,9 @@ namespace Ipopt
     }
 
   private:
+    /** Overloaded Equals Operator (not implemented) */
+    void operator=(const RegisteredOptions&);
+
     Index next_counter_;
     std::string current_registering_category_;
     std::map<std::string, SmartPtr<RegisteredOption> > registered_options_;
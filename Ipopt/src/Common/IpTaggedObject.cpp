@@ -6,11 +6,67 @@
 //
 // Authors:  Carl Laird, Andreas Waechter     IBM    2004-08-13
 
+#include "IpoptConfig.h"
 #include "IpTaggedObject.hpp"
 
+#if defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__clang__)
+# define IP_TAG_SYNC_BUILTINS
+#elif defined(_MSC_VER)
+# include <intrin.h>
+# pragma intrinsic(_InterlockedCompareExchange64)
+# define IP_TAG_INTERLOCKED
+#elif defined(HAVE_PTHREAD) && defined(HAVE_PTHREAD_H)
+# include <pthread.h>
+# define IP_TAG_MUTEX
+#else
+# error "Ipopt needs atomic operations or pthreads to create unique tags"
+#endif
+
 namespace Ipopt
 {
 
-  TaggedObject::Tag IPOPT_THREAD_LOCAL TaggedObject::unique_tag_ = 1;
+  TaggedObject::Tag IPOPT_THREAD_LOCAL TaggedObject::next_tag_ = 0;
+  TaggedObject::Tag IPOPT_THREAD_LOCAL TaggedObject::tag_batch_end_ = 0;
+
+  /** Number of tags that a thread reserves at a time */
+  static const TaggedObject::Tag tag_batch_size = 1024;
+
+  /** First tag that has not been reserved by any thread yet.  The
+   *  tag 0 is never given out, since it is used to mark a missing
+   *  dependency. */
+  static volatile TaggedObject::Tag global_next_tag = 1;
+
+#ifdef IP_TAG_MUTEX
+  /** Mutex for global_next_tag */
+  static pthread_mutex_t global_next_tag_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+  void TaggedObject::ReserveTagBatch()
+  {
+    Tag batch_start;
+#if defined(IP_TAG_SYNC_BUILTINS)
+    batch_start = __sync_fetch_and_add(&global_next_tag, tag_batch_size);
+#elif defined(IP_TAG_INTERLOCKED)
+    // _InterlockedExchangeAdd64 is not available on 32-bit Windows,
+    // but the compare-and-exchange is
+    __int64 old_value;
+    do {
+      old_value = (__int64)global_next_tag;
+    }
+    while (_InterlockedCompareExchange64((volatile __int64*)&global_next_tag,
+                                         old_value + (__int64)tag_batch_size,
+                                         old_value) != old_value);
+    batch_start = (Tag)old_value;
+#else
+    pthread_mutex_lock(&global_next_tag_mutex);
+    batch_start = global_next_tag;
+    global_next_tag += tag_batch_size;
+    pthread_mutex_unlock(&global_next_tag_mutex);
+#endif
+    DBG_ASSERT(batch_start < std::numeric_limits<Tag>::max() - tag_batch_size);
+
+    next_tag_ = batch_start;
+    tag_batch_end_ = batch_start + tag_batch_size;
+  }
 
 } // namespace Ipopt
@@ -72,12 +72,20 @@ namespace Ipopt
    *  the base class using the protected member function ObjectChanged(). For
    *  example, a Vector class, inside its own set method, MUST call 
    *  ObjectChanged() to update the internally stored tag for comparison.
+   *
+   *  Tags are 64-bit numbers that are unique over all threads, so that
+   *  an object may be created on one thread and changed on another.
+   *  They are obtained from a global counter, which is increased
+   *  atomically.  To avoid contention on this counter, each thread
+   *  reserves a batch of tags at a time and hands them out without
+   *  synchronization.  Tags are therefore unique, but not increasing
+   *  in the order of the changes.  The tag 0 is never given out.
    */
   class TaggedObject : public ReferencedObject, public Subject
   {
   public:
     /** Type for the Tag values */
-    typedef unsigned int Tag;
+    typedef unsigned long long Tag;
 
     /** Constructor. */
     TaggedObject()
@@ -117,9 +125,11 @@ namespace Ipopt
     void ObjectChanged()
     {
       DBG_START_METH("TaggedObject::ObjectChanged()", 0);
-      tag_ = unique_tag_;
-      unique_tag_++;
-      DBG_ASSERT(unique_tag_ < std::numeric_limits<Tag>::max());
+      if (next_tag_ == tag_batch_end_) {
+        ReserveTagBatch();
+      }
+      tag_ = next_tag_;
+      next_tag_++;
       // The Notify method from the Subject base class notifies all
       // registered Observers that this subject has changed.
       Notify(Observer::NT_Changed);
@@ -138,11 +148,21 @@ namespace Ipopt
     void operator=(const TaggedObject&);
     //@}
 
-    /** static data member that is incremented every
-     *  time ANY TaggedObject changes. This allows us
-     *  to obtain a unique Tag when the object changes
-     */
-    static IPOPT_THREAD_LOCAL Tag unique_tag_;
+    /** Method for reserving a new batch of tags for the calling
+     *  thread from the global tag counter.  This sets next_tag_ and
+     *  tag_batch_end_. */
+    static void ReserveTagBatch();
+
+    /** @name Thread-local data members for the tags that have been
+     *  reserved by the current thread.  next_tag_ is incremented
+     *  every time ANY TaggedObject changes on this thread.  This
+     *  allows us to obtain a unique Tag when the object changes. */
+    //@{
+    /** Next tag that is given out by this thread */
+    static IPOPT_THREAD_LOCAL Tag next_tag_;
+    /** First tag that is no longer in the batch of this thread */
+    static IPOPT_THREAD_LOCAL Tag tag_batch_end_;
+    //@}
 
     /** The tag indicating the current state of the object.
      *  We use this to compare against the comparison_tag
@@ -0,0 +1,157 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpoptConfig.h"
+#include "IpThreadPool.hpp"
+
+#if defined(HAVE_PTHREAD) && defined(HAVE_PTHREAD_H)
+# define IP_THREAD_POOL
+# include <pthread.h>
+#endif
+
+namespace Ipopt
+{
+
+#ifdef IP_THREAD_POOL
+  /** Synchronization objects of the pool */
+  struct ThreadPoolSync
+  {
+    pthread_mutex_t mutex;
+    /** Signaled when a new job is available or the pool stops */
+    pthread_cond_t work_cond;
+    /** Signaled when the last task of a job has been completed */
+    pthread_cond_t done_cond;
+  };
+#endif
+
+  ThreadPool::ThreadPool(Index num_threads)
+      :
+      num_threads_(1),
+      num_workers_(0),
+      workers_(NULL),
+      sync_(NULL),
+      func_(NULL),
+      data_(NULL),
+      num_tasks_(0),
+      next_task_(0),
+      tasks_left_(0),
+      stop_(false)
+  {
+#ifdef IP_THREAD_POOL
+    if (num_threads <= 1) {
+      return;
+    }
+
+    ThreadPoolSync* sync = new ThreadPoolSync;
+    pthread_mutex_init(&sync->mutex, NULL);
+    pthread_cond_init(&sync->work_cond, NULL);
+    pthread_cond_init(&sync->done_cond, NULL);
+    sync_ = sync;
+
+    pthread_t* workers = new pthread_t[num_threads-1];
+    workers_ = workers;
+    for (Index i=0; i<num_threads-1; i++) {
+      if (pthread_create(&workers[i], NULL, WorkerThread, this) != 0) {
+        // Work with the threads that could be started
+        break;
+      }
+      num_workers_++;
+    }
+    num_threads_ = num_workers_ + 1;
+#endif
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+#ifdef IP_THREAD_POOL
+    if (sync_) {
+      ThreadPoolSync* sync = static_cast<ThreadPoolSync*>(sync_);
+      pthread_t* workers = static_cast<pthread_t*>(workers_);
+      pthread_mutex_lock(&sync->mutex);
+      stop_ = true;
+      pthread_cond_broadcast(&sync->work_cond);
+      pthread_mutex_unlock(&sync->mutex);
+      for (Index i=0; i<num_workers_; i++) {
+        pthread_join(workers[i], NULL);
+      }
+      delete [] workers;
+      pthread_cond_destroy(&sync->done_cond);
+      pthread_cond_destroy(&sync->work_cond);
+      pthread_mutex_destroy(&sync->mutex);
+      delete sync;
+    }
+#endif
+  }
+
+  void ThreadPool::Run(TaskFunction func, void* data, Index num_tasks)
+  {
+    if (num_workers_ == 0 || num_tasks <= 1) {
+      for (Index i=0; i<num_tasks; i++) {
+        func(data, i);
+      }
+      return;
+    }
+
+#ifdef IP_THREAD_POOL
+    ThreadPoolSync* sync = static_cast<ThreadPoolSync*>(sync_);
+    pthread_mutex_lock(&sync->mutex);
+    func_ = func;
+    data_ = data;
+    num_tasks_ = num_tasks;
+    next_task_ = 0;
+    tasks_left_ = num_tasks;
+    pthread_cond_broadcast(&sync->work_cond);
+
+    WorkOnTasks();
+    while (tasks_left_ > 0) {
+      pthread_cond_wait(&sync->done_cond, &sync->mutex);
+    }
+    num_tasks_ = 0;
+    next_task_ = 0;
+    pthread_mutex_unlock(&sync->mutex);
+#endif
+  }
+
+  void ThreadPool::WorkOnTasks()
+  {
+#ifdef IP_THREAD_POOL
+    ThreadPoolSync* sync = static_cast<ThreadPoolSync*>(sync_);
+    while (next_task_ < num_tasks_) {
+      Index task = next_task_++;
+      TaskFunction func = func_;
+      void* data = data_;
+      pthread_mutex_unlock(&sync->mutex);
+      func(data, task);
+      pthread_mutex_lock(&sync->mutex);
+      tasks_left_--;
+      if (tasks_left_ == 0) {
+        pthread_cond_signal(&sync->done_cond);
+      }
+    }
+#endif
+  }
+
+  void* ThreadPool::WorkerThread(void* arg)
+  {
+#ifdef IP_THREAD_POOL
+    ThreadPool* pool = static_cast<ThreadPool*>(arg);
+    ThreadPoolSync* sync = static_cast<ThreadPoolSync*>(pool->sync_);
+    pthread_mutex_lock(&sync->mutex);
+    while (true) {
+      while (!pool->stop_ && pool->next_task_ >= pool->num_tasks_) {
+        pthread_cond_wait(&sync->work_cond, &sync->mutex);
+      }
+      if (pool->stop_) {
+        break;
+      }
+      pool->WorkOnTasks();
+    }
+    pthread_mutex_unlock(&sync->mutex);
+#endif
+    return NULL;
+  }
+
+} // namespace Ipopt
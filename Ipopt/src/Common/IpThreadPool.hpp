@@ -0,0 +1,111 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPTHREADPOOL_HPP__
+#define __IPTHREADPOOL_HPP__
+
+#include "IpReferenced.hpp"
+#include "IpTypes.hpp"
+
+namespace Ipopt
+{
+  /** Pool of threads that execute a number of independent tasks in
+   *  parallel.  The threads are started in the constructor and wait
+   *  for work until the pool is destroyed, so that the cost for
+   *  starting threads is paid only once.
+   *
+   *  The pool is meant for coarse-grained work, such as evaluations
+   *  of the problem functions at different points: the tasks are
+   *  handed out one by one under a mutex.  The thread calling Run
+   *  executes tasks as well.  If Ipopt has been compiled without
+   *  POSIX threads, or if the threads could not be started, all tasks
+   *  are executed by the calling thread.
+   *
+   *  Run must not be called from several threads at the same time,
+   *  and the tasks must not call Run of the same pool.
+   */
+  class ThreadPool : public ReferencedObject
+  {
+  public:
+    /** Type of the function that executes a task.  data is the
+     *  pointer given to Run, and task is the number of the task. */
+    typedef void (*TaskFunction)(void* data, Index task);
+
+    /** Constructor.  num_threads is the number of threads that work
+     *  on the tasks, including the thread calling Run. */
+    ThreadPool(Index num_threads);
+
+    /** Destructor.  Stops the threads. */
+    virtual ~ThreadPool();
+
+    /** Number of threads that work on the tasks, including the
+     *  thread calling Run. */
+    Index NumThreads() const
+    {
+      return num_threads_;
+    }
+
+    /** Execute func(data, i) for i=0,...,num_tasks-1, and return when
+     *  all tasks are done.  The order in which the tasks are executed
+     *  is not specified. */
+    void Run(TaskFunction func, void* data, Index num_tasks);
+
+  private:
+    /**@name Default Compiler Generated Methods (Hidden to avoid
+     * implicit creation/calling).  These methods are not
+     * implemented and we do not want the compiler to implement
+     * them for us, so we declare them private and do not define
+     * them. This ensures that they will not be implicitly
+     * created/called. */
+    //@{
+    /** Default Constructor */
+    ThreadPool();
+
+    /** Copy Constructor */
+    ThreadPool(const ThreadPool&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const ThreadPool&);
+    //@}
+
+    /** Start routine of the worker threads */
+    static void* WorkerThread(void* arg);
+
+    /** Execute tasks of the current job until all have been handed
+     *  out.  Must be called with the mutex locked. */
+    void WorkOnTasks();
+
+    /** Number of threads working on the tasks, including the calling
+     *  thread of Run */
+    Index num_threads_;
+
+    /** Number of worker threads that have been started */
+    Index num_workers_;
+
+    /** Worker threads (pthread_t array), NULL if there are none */
+    void* workers_;
+
+    /** Mutex and condition variables (hidden to avoid including
+     *  pthread.h here) */
+    void* sync_;
+
+    /** @name Current job, protected by the mutex */
+    //@{
+    TaskFunction func_;
+    void* data_;
+    Index num_tasks_;
+    /** Next task that has not been handed out */
+    Index next_task_;
+    /** Number of tasks that have not been completed */
+    Index tasks_left_;
+    /** Flag telling the workers to stop */
+    bool stop_;
+    //@}
+  };
+
+} // namespace Ipopt
+
+#endif
@@ -10,9 +10,29 @@
 #define __IPTIMEDTASK_HPP__
 
 #include "IpUtils.hpp"
+#include "IpTraceRecorder.hpp"
+
+#include <string>
 
 namespace Ipopt
 {
+  /** Times and number of calls of one timed task at the moment at
+   *  which the snapshot was taken.  The times include the current
+   *  execution of a task that has been started but not yet ended. */
+  struct TimedTaskSnapshot
+  {
+    /** Name of the task */
+    std::string name;
+    /** Total CPU time spend for the task */
+    Number cpu_time;
+    /** Total system time spend for the task */
+    Number sys_time;
+    /** Total wall clock time spend for the task */
+    Number wallclock_time;
+    /** Number of completed executions of the task */
+    Index n_calls;
+  };
+
   /** This class is used to collect timing information for a
    *  particular task. */
   class TimedTask
@@ -26,6 +46,9 @@ namespace Ipopt
         total_cputime_(0.),
         total_systime_(0.),
         total_walltime_(0.),
+        n_calls_(0),
+        trace_name_(NULL),
+        trace_started_(false),
         start_called_(false),
         end_called_(true)
     {}
@@ -41,6 +64,8 @@ namespace Ipopt
       total_cputime_ = 0.;
       total_systime_ = 0.;
       total_walltime_ = 0.;
+      n_calls_ = 0;
+      trace_started_ = false;
       start_called_ = false;
       end_called_ = true;
     }
@@ -55,6 +80,10 @@ namespace Ipopt
       start_cputime_ = CpuTime();
       start_systime_ = SysTime();
       start_walltime_ = WallclockTime();
+      if (trace_name_ && TraceRecorder::IsEnabled()) {
+        trace_started_ = true;
+        trace_start_ = TraceClock();
+      }
     }
 
     /** Method that is called after execution of the task. */
@@ -67,6 +96,8 @@ namespace Ipopt
       total_cputime_ += CpuTime() - start_cputime_;
       total_systime_ += SysTime() - start_systime_;
       total_walltime_ += WallclockTime() - start_walltime_;
+      n_calls_++;
+      EndTrace();
     }
 
     /** Method that is called after execution of the task for which
@@ -81,6 +112,8 @@ namespace Ipopt
         total_cputime_ += CpuTime() - start_cputime_;
         total_systime_ += SysTime() - start_systime_;
         total_walltime_ += WallclockTime() - start_walltime_;
+        n_calls_++;
+        EndTrace();
       }
       DBG_ASSERT(end_called_);
     }
@@ -106,6 +139,41 @@ namespace Ipopt
       return total_walltime_;
     }
 
+    /** Method returning the number of times the task has been
+     *  executed so far. */
+    Index NumberOfCalls() const
+    {
+      return n_calls_;
+    }
+
+    /** Method for setting the name under which the executions of
+     *  the task are recorded by the TraceRecorder.  name must be
+     *  valid as long as this object exists, usually it is a string
+     *  literal.  If no name is set, the task is not traced. */
+    void SetTraceName(const char* name)
+    {
+      trace_name_ = name;
+    }
+
+    /** Method for taking a snapshot of the times and the number of
+     *  calls of the task.  In contrast to the Total*Time methods,
+     *  this may also be called while the task is being executed. */
+    TimedTaskSnapshot Snapshot(const std::string& name) const
+    {
+      TimedTaskSnapshot snapshot;
+      snapshot.name = name;
+      snapshot.cpu_time = total_cputime_;
+      snapshot.sys_time = total_systime_;
+      snapshot.wallclock_time = total_walltime_;
+      snapshot.n_calls = n_calls_;
+      if (start_called_) {
+        snapshot.cpu_time += CpuTime() - start_cputime_;
+        snapshot.sys_time += SysTime() - start_systime_;
+        snapshot.wallclock_time += WallclockTime() - start_walltime_;
+      }
+      return snapshot;
+    }
+
   private:
     /**@name Default Compiler Generated Methods (Hidden to avoid
      * implicit creation/calling).  These methods are not
@@ -121,6 +189,16 @@ namespace Ipopt
     void operator=(const TimedTask&);
     //@}
 
+    /** Record the trace event for the current execution, if its
+     *  start has been recorded. */
+    void EndTrace()
+    {
+      if (trace_started_) {
+        trace_started_ = false;
+        TraceRecorder::Record(trace_name_, trace_start_, TraceClock());
+      }
+    }
+
     /** CPU time at beginning of task. */
     Number start_cputime_;
     /** Total CPU time for task measured so far. */
@@ -133,6 +211,20 @@ namespace Ipopt
     Number start_walltime_;
     /** Total wall clock time for task measured so far. */
     Number total_walltime_;
+    /** Number of completed executions of the task. */
+    Index n_calls_;
+
+    /** @name fields for tracing */
+    //@{
+    /** Name of the task for the TraceRecorder, NULL if the task is
+     *  not traced */
+    const char* trace_name_;
+    /** Flag indicating whether the start of the current execution
+     *  has been recorded */
+    bool trace_started_;
+    /** Trace clock at the beginning of the current execution */
+    TraceTime trace_start_;
+    //@}
 
     /** @name fields for debugging */
     //@{
@@ -0,0 +1,338 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpoptConfig.h"
+#include "IpTraceRecorder.hpp"
+#include "IpTaggedObject.hpp"
+
+#include <vector>
+
+#ifdef HAVE_CSTDIO
+# include <cstdio>
+#else
+# ifdef HAVE_STDIO_H
+#  include <stdio.h>
+# else
+#  error "don't have header file for stdio"
+# endif
+#endif
+
+// The list of buffers is protected by a mutex if POSIX threads are
+// available, and the buffers of exited threads are reclaimed
+#if defined(HAVE_PTHREAD) && defined(HAVE_PTHREAD_H)
+# define IP_TRACE_MUTEX
+# include <pthread.h>
+#endif
+
+#if defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__clang__)
+# define IP_TRACE_BARRIER() __sync_synchronize()
+#elif defined(_MSC_VER)
+# include <intrin.h>
+# define IP_TRACE_BARRIER() _ReadWriteBarrier()
+#else
+# define IP_TRACE_BARRIER()
+#endif
+
+namespace Ipopt
+{
+
+  volatile int TraceRecorder::enabled_ = 0;
+
+  /** One recorded event */
+  struct TraceEvent
+  {
+    const char* name;
+    TraceTime start;
+    TraceTime end;
+  };
+
+  /** Number of events in one chunk of a buffer */
+  static const Index chunk_size = 4096;
+
+  /** Chunk of events in a buffer.  The chunks are kept when recording
+   *  is started again, and reused by the thread. */
+  struct TraceChunk
+  {
+    TraceEvent events[chunk_size];
+    TraceChunk* next;
+  };
+
+  /** Buffer with the events of one thread.  Only the thread itself
+   *  writes to the buffer: it appends an event first and then
+   *  increases num_events, so that WriteChromeTrace can read the
+   *  first num_events events while the thread finishes an event.
+   *  When the thread exits, its buffer is kept until the next Start,
+   *  so that its events can still be written. */
+  struct TraceBuffer
+  {
+    /** Number of the thread in the trace */
+    Index tid;
+    /** Value of generation when the thread recorded its first event
+     *  after Start.  Events of older generations are not written. */
+    volatile unsigned int generation;
+    /** Number of events recorded since Start */
+    volatile Index num_events;
+    /** Number of events that were dropped since Start because the
+     *  buffer was full */
+    volatile Index num_dropped;
+    /** First chunk of events */
+    TraceChunk* first_chunk;
+    /** Chunk in which the next event is stored */
+    TraceChunk* current_chunk;
+    /** Flag indicating whether the thread has exited */
+    bool exited;
+    /** Next buffer in the list of all buffers */
+    TraceBuffer* next;
+  };
+
+  /** Counter increased by every Start.  A thread that finds a
+   *  different value in its buffer discards its events. */
+  static volatile unsigned int generation = 0;
+
+  /** Buffer of the calling thread, NULL if the thread has not
+   *  recorded any event yet */
+  static IPOPT_THREAD_LOCAL TraceBuffer* thread_buffer = NULL;
+
+  /** List of the buffers of all threads */
+  static TraceBuffer* all_buffers = NULL;
+
+  /** Number of buffers in all_buffers */
+  static Index num_buffers = 0;
+
+#ifdef IP_TRACE_MUTEX
+  /** Mutex for all_buffers and num_buffers.  It is locked when a
+   *  thread records its first event and by Start and
+   *  WriteChromeTrace, but not for recording events. */
+  static pthread_mutex_t buffers_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+  /** Key whose destructor marks the buffer of an exiting thread */
+  static pthread_key_t buffer_key;
+  static pthread_once_t buffer_key_once = PTHREAD_ONCE_INIT;
+
+  static void ReleaseThreadBuffer(void* arg)
+  {
+    TraceBuffer* buffer = static_cast<TraceBuffer*>(arg);
+    pthread_mutex_lock(&buffers_mutex);
+    buffer->exited = true;
+    pthread_mutex_unlock(&buffers_mutex);
+  }
+
+  static void CreateBufferKey()
+  {
+    pthread_key_create(&buffer_key, ReleaseThreadBuffer);
+  }
+#endif
+
+  /** @name Trace clock and wall clock time at Start and Stop, used for
+   *  converting ticks into seconds */
+  //@{
+  static TraceTime start_ticks = 0;
+  static Number start_walltime = 0.;
+  static TraceTime stop_ticks = 0;
+  static Number stop_walltime = 0.;
+  //@}
+
+  /** Create the buffer for the calling thread and add it to the list
+   *  of all buffers */
+  static TraceBuffer* RegisterThreadBuffer()
+  {
+    TraceBuffer* buffer = new TraceBuffer;
+    buffer->generation = generation;
+    buffer->num_events = 0;
+    buffer->num_dropped = 0;
+    buffer->first_chunk = new TraceChunk;
+    buffer->first_chunk->next = NULL;
+    buffer->current_chunk = buffer->first_chunk;
+    buffer->exited = false;
+#ifdef IP_TRACE_MUTEX
+    pthread_once(&buffer_key_once, CreateBufferKey);
+    pthread_setspecific(buffer_key, buffer);
+    pthread_mutex_lock(&buffers_mutex);
+#endif
+    buffer->tid = num_buffers++;
+    buffer->next = all_buffers;
+    all_buffers = buffer;
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_unlock(&buffers_mutex);
+#endif
+    thread_buffer = buffer;
+    return buffer;
+  }
+
+  /** Delete a buffer with all its chunks */
+  static void DeleteBuffer(TraceBuffer* buffer)
+  {
+    while (buffer->first_chunk) {
+      TraceChunk* chunk = buffer->first_chunk;
+      buffer->first_chunk = chunk->next;
+      delete chunk;
+    }
+    delete buffer;
+  }
+
+  /** Set the flag for recording events */
+  static void SetEnabled(volatile int& enabled, int value)
+  {
+#if defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__clang__)
+    __sync_lock_test_and_set(&enabled, value);
+    __sync_synchronize();
+#else
+    enabled = value;
+#endif
+  }
+
+  void TraceRecorder::Start()
+  {
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_lock(&buffers_mutex);
+#endif
+    // Reclaim the buffers of exited threads.  The events in the other
+    // buffers are discarded by their threads when they see the new
+    // generation.
+    TraceBuffer** prev = &all_buffers;
+    while (*prev) {
+      TraceBuffer* buffer = *prev;
+      if (buffer->exited) {
+        *prev = buffer->next;
+        DeleteBuffer(buffer);
+        continue;
+      }
+      prev = &buffer->next;
+    }
+    generation++;
+    start_walltime = WallclockTime();
+    start_ticks = TraceClock();
+    stop_ticks = start_ticks;
+    stop_walltime = start_walltime;
+    SetEnabled(enabled_, 1);
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_unlock(&buffers_mutex);
+#endif
+  }
+
+  void TraceRecorder::Stop()
+  {
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_lock(&buffers_mutex);
+#endif
+    if (enabled_) {
+      SetEnabled(enabled_, 0);
+      stop_walltime = WallclockTime();
+      stop_ticks = TraceClock();
+    }
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_unlock(&buffers_mutex);
+#endif
+  }
+
+  void TraceRecorder::Record(const char* name, TraceTime start, TraceTime end)
+  {
+    TraceBuffer* buffer = thread_buffer;
+    if (!buffer) {
+      buffer = RegisterThreadBuffer();
+    }
+    if (buffer->generation != generation) {
+      // First event since Start: discard the old events.  num_events
+      // is reset before the generation is changed, so that
+      // WriteChromeTrace does not see the old events as new ones.
+      buffer->num_events = 0;
+      buffer->num_dropped = 0;
+      buffer->current_chunk = buffer->first_chunk;
+      IP_TRACE_BARRIER();
+      buffer->generation = generation;
+    }
+
+    Index num_events = buffer->num_events;
+    if (num_events >= MaxEventsPerThread) {
+      buffer->num_dropped = buffer->num_dropped + 1;
+      return;
+    }
+    Index pos = num_events % chunk_size;
+    if (pos == 0 && num_events > 0) {
+      TraceChunk* chunk = buffer->current_chunk;
+      if (!chunk->next) {
+        chunk->next = new TraceChunk;
+        chunk->next->next = NULL;
+      }
+      buffer->current_chunk = chunk->next;
+    }
+    TraceEvent& event = buffer->current_chunk->events[pos];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    // Make the event visible before it is counted
+    IP_TRACE_BARRIER();
+    buffer->num_events = num_events + 1;
+  }
+
+  bool TraceRecorder::WriteChromeTrace(const std::string& file_name)
+  {
+    FILE* fp = fopen(file_name.c_str(), "w");
+    if (!fp) {
+      return false;
+    }
+
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_lock(&buffers_mutex);
+#endif
+
+    // Microseconds per tick of the trace clock, from the times taken
+    // in Start and Stop
+    Number us_per_tick = 0.;
+    if (stop_ticks > start_ticks) {
+      us_per_tick = 1e6*(stop_walltime - start_walltime)/
+                    (Number)(stop_ticks - start_ticks);
+    }
+
+    fprintf(fp, "{\"traceEvents\":[\n");
+    bool first = true;
+    Index num_dropped = 0;
+    for (TraceBuffer* buffer = all_buffers; buffer; buffer = buffer->next) {
+      if (buffer->generation != generation) {
+        // The thread has not recorded any event since Start
+        continue;
+      }
+      // Only the events counted at this point are written; the thread
+      // may still append events that it started before Stop
+      Index num_events = buffer->num_events;
+      IP_TRACE_BARRIER();
+      num_dropped += buffer->num_dropped;
+      const TraceChunk* chunk = buffer->first_chunk;
+      for (Index i=0; i<num_events; i++) {
+        if (i > 0 && i % chunk_size == 0) {
+          chunk = chunk->next;
+        }
+        const TraceEvent& event = chunk->events[i % chunk_size];
+        // Events that started before Start are dropped
+        if (event.start < start_ticks) {
+          continue;
+        }
+        fprintf(fp, "%s{\"name\":\"", first ? "" : ",\n");
+        for (const char* c = event.name; *c; c++) {
+          if (*c == '"' || *c == '\\') {
+            fputc('\\', fp);
+          }
+          fputc(*c, fp);
+        }
+        fprintf(fp, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                buffer->tid,
+                us_per_tick*(Number)(event.start - start_ticks),
+                us_per_tick*(Number)(event.end - event.start));
+        first = false;
+      }
+    }
+#ifdef IP_TRACE_MUTEX
+    pthread_mutex_unlock(&buffers_mutex);
+#endif
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":\"%d\"}}\n",
+            num_dropped);
+
+    bool retval = !ferror(fp);
+    fclose(fp);
+    return retval;
+  }
+
+} // namespace Ipopt
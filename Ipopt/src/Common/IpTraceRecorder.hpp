@@ -0,0 +1,148 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPTRACERECORDER_HPP__
+#define __IPTRACERECORDER_HPP__
+
+#include "IpUtils.hpp"
+
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+#endif
+
+namespace Ipopt
+{
+  /** Type for the time stamps of the trace clock */
+  typedef unsigned long long TraceTime;
+
+  /** Read the trace clock.  On x86 processors, this is the time stamp
+   *  counter, which can be read without a system call.  Otherwise,
+   *  the wall clock time in nanoseconds is used.  The ticks are
+   *  converted into seconds only when the trace is written. */
+  inline TraceTime TraceClock()
+  {
+#if (defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)) && \
+  (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#else
+    return (TraceTime)(WallclockTime()*1e9);
+#endif
+  }
+
+  /** Recorder for trace events, i.e., the begin and end times of
+   *  named parts of the code.  The recorder is meant for
+   *  fine-grained events, such as single function evaluations or
+   *  line search trials: if it is not enabled, recording an event
+   *  only checks a flag, and otherwise it reads the trace clock twice
+   *  and appends the event to a buffer of the calling thread.
+   *
+   *  Recording is enabled for the whole process between Start and
+   *  Stop.  Afterwards, the events can be written with
+   *  WriteChromeTrace in the trace event format of the Chrome
+   *  browser, which can be displayed by chrome://tracing or Perfetto.
+   *  Each thread appends to its own buffer without any locking.  A
+   *  buffer holds at most MaxEventsPerThread events; further events
+   *  of the thread are dropped, and their number is written into the
+   *  trace.  Start and WriteChromeTrace must not be called while
+   *  recording is enabled, but other threads may still finish events
+   *  while they run.
+   */
+  class TraceRecorder
+  {
+  public:
+    /** Query whether events are recorded */
+    static bool IsEnabled()
+    {
+      return enabled_ != 0;
+    }
+
+    /** Discard all recorded events and start recording. */
+    static void Start();
+
+    /** Stop recording events. */
+    static void Stop();
+
+    /** Write the events recorded between the last calls of Start and
+     *  Stop into a file in the Chrome trace event format.  Returns
+     *  false if the file could not be written. */
+    static bool WriteChromeTrace(const std::string& file_name);
+
+    /** Record an event of the calling thread.  name must be a string
+     *  that is valid until the trace has been written, usually a
+     *  string literal. */
+    static void Record(const char* name, TraceTime start, TraceTime end);
+
+    /** Maximal number of events recorded for one thread between
+     *  Start and Stop */
+    static const Index MaxEventsPerThread = 1 << 20;
+
+  private:
+    /** Flag indicating whether events are recorded.  It is only
+     *  changed by atomic operations in Start and Stop. */
+    static volatile int enabled_;
+  };
+
+  /** Object that records an event for the scope in which it is
+   *  declared (usually with the IP_TRACE_SCOPE macro). */
+  class TraceScope
+  {
+  public:
+    /** Constructor.  The start time is only taken if the recorder is
+     *  enabled. */
+    TraceScope(const char* name)
+        :
+        name_(NULL),
+        start_(0)
+    {
+      if (TraceRecorder::IsEnabled()) {
+        name_ = name;
+        start_ = TraceClock();
+      }
+    }
+
+    /** Destructor, records the event */
+    ~TraceScope()
+    {
+      if (name_) {
+        TraceRecorder::Record(name_, start_, TraceClock());
+      }
+    }
+
+  private:
+    /**@name Default Compiler Generated Methods (Hidden to avoid
+     * implicit creation/calling).  These methods are not
+     * implemented and we do not want the compiler to implement them
+     * for us, so we declare them private and do not define
+     * them. This ensures that they will not be implicitly
+     * created/called. */
+    //@{
+    /** Default Constructor */
+    TraceScope();
+
+    /** Copy Constructor */
+    TraceScope(const TraceScope&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const TraceScope&);
+    //@}
+
+    /** Name of the event, NULL if the recorder was not enabled */
+    const char* name_;
+    /** Trace clock at the beginning of the scope */
+    TraceTime start_;
+  };
+
+} // namespace Ipopt
+
+/** Record a trace event with the given name for the rest of the
+ *  current scope. */
+#define IP_TRACE_SCOPE(name) Ipopt::TraceScope ip_trace_scope_(name)
+
+#endif
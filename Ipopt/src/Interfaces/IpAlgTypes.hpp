@@ -36,6 +36,7 @@ namespace Ipopt
     INVALID_OPTION,
     OUT_OF_MEMORY,
     INTERNAL_ERROR,
+    WALLTIME_EXCEEDED,
     UNASSIGNED
   };
   //@}
@@ -46,6 +47,7 @@ namespace Ipopt
   DECLARE_STD_EXCEPTION(TOO_FEW_DOF);
   DECLARE_STD_EXCEPTION(TINY_STEP_DETECTED);
   DECLARE_STD_EXCEPTION(ACCEPTABLE_POINT_REACHED);
+  DECLARE_STD_EXCEPTION(WALLTIME_DEADLINE_REACHED);
   DECLARE_STD_EXCEPTION(FEASIBILITY_PROBLEM_SOLVED);
   DECLARE_STD_EXCEPTION(INVALID_WARMSTART);
   DECLARE_STD_EXCEPTION(INTERNAL_ABORT);
@@ -0,0 +1,89 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#include "IpHessianProductMatrix.hpp"
+#include "IpNLP.hpp"
+#include "IpIpoptNLP.hpp"
+
+namespace Ipopt
+{
+
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  HessianProductMatrix::HessianProductMatrix(const HessianProductMatrixSpace* owner_space)
+      :
+      SymMatrix(owner_space),
+      owner_space_(owner_space),
+      obj_factor_(0.)
+  {}
+
+  HessianProductMatrix::~HessianProductMatrix()
+  {}
+
+  void HessianProductMatrix::SetEvaluationPoint(const Vector& x,
+      Number obj_factor,
+      const Vector& yc,
+      const Vector& yd)
+  {
+    x_ = &x;
+    obj_factor_ = obj_factor;
+    yc_ = &yc;
+    yd_ = &yd;
+    ObjectChanged();
+  }
+
+  void HessianProductMatrix::MultVectorImpl(Number alpha, const Vector &x,
+      Number beta, Vector &y) const
+  {
+    DBG_START_METH("HessianProductMatrix::MultVectorImpl", dbg_verbosity);
+    //  A few sanity checks
+    DBG_ASSERT(Dim()==x.Dim());
+    DBG_ASSERT(Dim()==y.Dim());
+
+    // A matrix without evaluation point (as obtained from
+    // uninitialized_h) is only ever used with a zero factor, so we
+    // don't ask the NLP in that case.
+    if (alpha==0. || !HasEvaluationPoint()) {
+      if ( beta!=0.0 ) {
+        y.Scal(beta);
+      }
+      else {
+        y.Set(0.0);  // In case y hasn't been initialized yet
+      }
+      return;
+    }
+
+    SmartPtr<Vector> h_x = y.MakeNew();
+    bool retval = owner_space_->GetNLP()->Eval_h_prod(*x_, obj_factor_,
+                  *yc_, *yd_, x, *h_x);
+    ASSERT_EXCEPTION(retval, IpoptNLP::Eval_Error,
+                     "Error evaluating the product with the hessian of the lagrangian");
+
+    y.AddOneVector(alpha, *h_x, beta);
+  }
+
+  void HessianProductMatrix::ComputeRowAMaxImpl(Vector& rows_norms,
+      bool init) const
+  {
+    THROW_EXCEPTION(UNIMPLEMENTED_LINALG_METHOD_CALLED,
+                    "HessianProductMatrix::ComputeRowAMaxImpl called, but the elements of the Hessian are only available through products");
+  }
+
+  void HessianProductMatrix::PrintImpl(const Journalist& jnlst,
+                                       EJournalLevel level,
+                                       EJournalCategory category,
+                                       const std::string& name,
+                                       Index indent,
+                                       const std::string& prefix) const
+  {
+    jnlst.Printf(level, category, "\n");
+    jnlst.PrintfIndented(level, category, indent,
+                         "%sHessianProductMatrix \"%s\" with %d rows and columns (elements only available through products)\n",
+                         prefix.c_str(), name.c_str(), Dim());
+  }
+} // namespace Ipopt
@@ -0,0 +1,177 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+#ifndef __IPHESSIANPRODUCTMATRIX_HPP__
+#define __IPHESSIANPRODUCTMATRIX_HPP__
+
+#include "IpUtils.hpp"
+#include "IpSymMatrix.hpp"
+
+namespace Ipopt
+{
+
+  /* forward declarations */
+  class NLP;
+  class HessianProductMatrixSpace;
+
+  /** Class for the Hessian of the Lagrangian that is only available
+   *  through matrix-vector products.  The matrix does not store any
+   *  elements; it only remembers the point (x, obj_factor, yc, yd)
+   *  at which the Hessian is to be evaluated, and every call of
+   *  MultVector is forwarded to the Eval_h_prod method of the NLP
+   *  that owns the matrix space.  Since the elements are never
+   *  available, such a matrix can only be used by algorithms that
+   *  need nothing but products, such as the Krylov solvers of the
+   *  inexact algorithm.
+   */
+  class HessianProductMatrix : public SymMatrix
+  {
+  public:
+
+    /**@name Constructors / Destructors */
+    //@{
+
+    /** Constructor, taking the corresponding matrix space.
+     */
+    HessianProductMatrix(const HessianProductMatrixSpace* owner_space);
+
+    /** Destructor */
+    ~HessianProductMatrix();
+    //@}
+
+    /** Set the point at which the Hessian is evaluated.  The vectors
+     *  are only referenced, not copied. */
+    void SetEvaluationPoint(const Vector& x, Number obj_factor,
+                            const Vector& yc, const Vector& yd);
+
+    /** Returns true if an evaluation point has been set. */
+    bool HasEvaluationPoint() const
+    {
+      return IsValid(x_);
+    }
+
+  protected:
+    /**@name Methods overloaded from matrix */
+    //@{
+    virtual void MultVectorImpl(Number alpha, const Vector& x,
+                                Number beta, Vector& y) const;
+
+    /** The elements of the matrix are not available, so this method
+     *  throws an exception. */
+    virtual void ComputeRowAMaxImpl(Vector& rows_norms, bool init) const;
+
+    virtual void PrintImpl(const Journalist& jnlst,
+                           EJournalLevel level,
+                           EJournalCategory category,
+                           const std::string& name,
+                           Index indent,
+                           const std::string& prefix) const;
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    HessianProductMatrix();
+
+    /** Copy Constructor */
+    HessianProductMatrix(const HessianProductMatrix&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const HessianProductMatrix&);
+    //@}
+
+    /** Copy of the owner space as a HessianProductMatrixSpace */
+    const HessianProductMatrixSpace* owner_space_;
+
+    /** @name Evaluation point */
+    //@{
+    SmartPtr<const Vector> x_;
+    Number obj_factor_;
+    SmartPtr<const Vector> yc_;
+    SmartPtr<const Vector> yd_;
+    //@}
+  };
+
+  /** Class for matrix space for HessianProductMatrix.  The space
+   *  keeps a (non-owning) pointer to the NLP that computes the
+   *  products, since the NLP is the object that creates and owns
+   *  this space. */
+  class HessianProductMatrixSpace : public SymMatrixSpace
+  {
+  public:
+    /** @name Constructors / Destructors */
+    //@{
+    /** Constructor, given the dimension of the matrix and the NLP
+     *  that provides the Hessian-vector products.
+     */
+    HessianProductMatrixSpace(Index dim, NLP& nlp)
+        :
+        SymMatrixSpace(dim),
+        nlp_(&nlp)
+    {}
+
+    /** Destructor */
+    virtual ~HessianProductMatrixSpace()
+    {}
+    //@}
+
+    /** Overloaded MakeNew method for the MatrixSpace base class.
+     */
+    virtual Matrix* MakeNew() const
+    {
+      return MakeNewHessianProductMatrix();
+    }
+
+    /** Overloaded method from SymMatrixSpace base class
+     */
+    virtual SymMatrix* MakeNewSymMatrix() const
+    {
+      return MakeNewHessianProductMatrix();
+    }
+
+    /** Method for creating a new matrix of this specific type. */
+    HessianProductMatrix* MakeNewHessianProductMatrix() const
+    {
+      return new HessianProductMatrix(this);
+    }
+
+    /** NLP that computes the Hessian-vector products */
+    NLP* GetNLP() const
+    {
+      return nlp_;
+    }
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    HessianProductMatrixSpace();
+
+    /** Copy Constructor */
+    HessianProductMatrixSpace(const HessianProductMatrixSpace&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const HessianProductMatrixSpace&);
+    //@}
+
+    /** NLP providing the products (not owned) */
+    NLP* nlp_;
+  };
+} // namespace Ipopt
+#endif
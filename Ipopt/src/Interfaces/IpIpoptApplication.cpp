@@ -10,6 +10,8 @@
 #include "IpIpoptApplication.hpp"
 #include "IpTNLPAdapter.hpp"
 #include "IpIpoptAlg.hpp"
+#include "IpIterationOutput.hpp"
+#include "IpTraceRecorder.hpp"
 #include "IpOrigIpoptNLP.hpp"
 #include "IpIpoptData.hpp"
 #include "IpIpoptCalculatedQuantities.hpp"
@@ -20,6 +22,7 @@
 #include "IpAlgorithmRegOp.hpp"
 #include "IpCGPenaltyRegOp.hpp"
 #include "IpNLPBoundsRemover.hpp"
+#include "IpMultiVectorMatrix.hpp"
 
 #ifdef COIN_HAS_HSL
 #include "CoinHslConfig.h"
@@ -42,6 +45,13 @@
 
 #include <fstream>
 
+// The registered options are shared by the applications in a thread,
+// since the reference counts of the objects are not atomic
+#if defined(HAVE_PTHREAD) && defined(HAVE_PTHREAD_H)
+# define IP_THREAD_SPECIFIC_REG_OPTIONS
+# include <pthread.h>
+#endif
+
 // Factory to facilitate creating IpoptApplication objects from within a DLL
 
 Ipopt::IpoptApplication * IpoptApplicationFactory()
@@ -60,6 +70,7 @@ namespace Ipopt
       :
       read_params_dat_(true),
       rethrow_nonipoptexception_(false),
+      reg_options_shared_(false),
       inexact_algorithm_(false),
       replace_bounds_(false)
   {
@@ -84,9 +95,9 @@ namespace Ipopt
         stdout_jrnl->SetPrintLevel(J_DBG, J_NONE);
       }
 
-      // Register the valid options
-      reg_options_ = new RegisteredOptions();
-      RegisterAllIpoptOptions(reg_options_);
+      // Use the valid options that have been registered before
+      reg_options_ = SharedRegisteredOptions();
+      reg_options_shared_ = true;
 
       options_->SetJournalist(jnlst_);
       options_->SetRegisteredOptions(reg_options_);
@@ -117,6 +128,7 @@ namespace Ipopt
       rethrow_nonipoptexception_(false),
       jnlst_(jnlst),
       reg_options_(reg_options),
+      reg_options_shared_(false),
       options_(options),
       inexact_algorithm_(false),
       replace_bounds_(false)
@@ -126,7 +138,8 @@ namespace Ipopt
   {
     SmartPtr<IpoptApplication> retval = new IpoptApplication(false, true);
     retval->jnlst_ = Jnlst();
-    retval->reg_options_ = RegOptions();
+    retval->reg_options_ = reg_options_;
+    retval->reg_options_shared_ = reg_options_shared_;
     *retval->options_ = *Options();
 
     retval->read_params_dat_ = read_params_dat_;
@@ -204,6 +217,22 @@ namespace Ipopt
             return Invalid_Option;
           }
         }
+
+        // Open the binary iteration trace if required
+        std::string trace_filename;
+        options_->GetStringValue("iteration_trace_file", trace_filename, "");
+        if (trace_filename != "" &&
+            IsNull(jnlst_->GetJournal(IterationOutput::TraceJournalName()))) {
+          SmartPtr<TraceJournal> trace_jrnl =
+            new TraceJournal(IterationOutput::TraceJournalName());
+          if (!trace_jrnl->Open(trace_filename.c_str()) ||
+              !jnlst_->AddJournal(GetRawPtr(trace_jrnl))) {
+            jnlst_->Printf(J_ERROR, J_INITIALIZATION,
+                           "Error opening iteration trace file \"%s\"\n",
+                           trace_filename.c_str());
+            return Invalid_Option;
+          }
+        }
       }
 
       // output a description of all the options
@@ -223,6 +252,9 @@ namespace Ipopt
           options_to_print.push_back("print_frequency_time");
           options_to_print.push_back("output_file");
           options_to_print.push_back("file_print_level");
+          options_to_print.push_back("output_file_async");
+          options_to_print.push_back("iteration_trace_file");
+          options_to_print.push_back("trace_events_file");
           options_to_print.push_back("option_file_name");
           options_to_print.push_back("print_info_string");
           options_to_print.push_back("inf_pr_output");
@@ -232,6 +264,7 @@ namespace Ipopt
           options_to_print.push_back("tol");
           options_to_print.push_back("max_iter");
           options_to_print.push_back("max_cpu_time");
+          options_to_print.push_back("max_wall_time");
           options_to_print.push_back("dual_inf_tol");
           options_to_print.push_back("constr_viol_tol");
           options_to_print.push_back("compl_inf_tol");
@@ -274,6 +307,8 @@ namespace Ipopt
           options_to_print.push_back("mu_strategy");
           options_to_print.push_back("mu_oracle");
           options_to_print.push_back("quality_function_max_section_steps");
+          options_to_print.push_back("quality_function_section_points");
+          options_to_print.push_back("quality_function_threads");
           options_to_print.push_back("fixed_mu_oracle");
           options_to_print.push_back("adaptive_mu_globalization");
           options_to_print.push_back("mu_init");
@@ -613,6 +648,41 @@ namespace Ipopt
       "NOTE: This option only works when read from the ipopt.opt options file! "
       "Determines the verbosity level for the file specified by "
       "\"output_file\".  By default it is the same as \"print_level\".");
+    roptions->AddStringOption2(
+      "output_file_async",
+      "Write the output file from a separate thread.",
+      "no",
+      "no", "write the output file directly",
+      "yes", "write the output file from a separate thread",
+      "NOTE: This option only works when read from the ipopt.opt options file! "
+      "If selected, the output for the file specified by \"output_file\" is "
+      "copied into a buffer of fixed size, which is written to the file by a "
+      "separate thread, so that writing the file does not slow down the "
+      "optimization.  This requires that Ipopt has been compiled with POSIX "
+      "threads; otherwise, the file is written directly.");
+    roptions->AddStringOption1(
+      "iteration_trace_file",
+      "File name for a binary trace of the iterations (leave unset for no trace).",
+      "",
+      "*", "Any acceptable standard file name",
+      "NOTE: This option only works when read from the ipopt.opt options file! "
+      "If set, one record with the values of the summary line, the "
+      "regularization, the number of iterative refinement steps, the counts "
+      "and times for the linear solver and the function evaluations, and the "
+      "CPU time is written in binary format for each iteration.  The file can "
+      "be read with TraceJournal::ReadTrace.");
+    roptions->AddStringOption1(
+      "trace_events_file",
+      "File name for a trace of the timed parts of the optimization (leave unset for no trace).",
+      "",
+      "*", "Any acceptable standard file name",
+      "If set, the beginning and end of each execution of the timed tasks of "
+      "the algorithm, the linear solver, the function evaluations, and the "
+      "line search trials are recorded during the optimization, and written "
+      "into this file in the trace event format of the Chrome browser "
+      "(which can be viewed with chrome://tracing or Perfetto) at the end.  "
+      "Note that the recording is done for the whole process, so this "
+      "should not be used for concurrent optimizations.");
     roptions->AddStringOption2(
       "print_user_options",
       "Print all options set by the user.",
@@ -728,6 +798,55 @@ namespace Ipopt
     return ReOptimizeNLP(nlp_adapter_);
   }
 
+  ApplicationReturnStatus
+  IpoptApplication::ReOptimizeTNLP(const SmartPtr<TNLP>& tnlp,
+                                   Index n_params,
+                                   const Index* param_idx,
+                                   const Number* param_values)
+  {
+    ASSERT_EXCEPTION(IsValid(nlp_adapter_), INVALID_WARMSTART,
+                     "ReOptimizeTNLP called before OptimizeTNLP.");
+    bool warm_start_same_structure;
+    options_->GetBoolValue("warm_start_same_structure",
+                           warm_start_same_structure, "");
+    bool warm_start_init_point;
+    options_->GetBoolValue("warm_start_init_point",
+                           warm_start_init_point, "");
+    ASSERT_EXCEPTION(warm_start_same_structure && warm_start_init_point,
+                     INVALID_WARMSTART,
+                     "ReOptimizeTNLP with parameter values requires warm_start_same_structure and warm_start_init_point.");
+    TNLPAdapter* adapter =
+      static_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_));
+    DBG_ASSERT(dynamic_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_)));
+    ASSERT_EXCEPTION(adapter->tnlp()==tnlp, INVALID_WARMSTART,
+                     "ReOptimizeTNLP called for different TNLP.")
+    bool retval = adapter->SetParameterValues(n_params, param_idx,
+                  param_values);
+    ASSERT_EXCEPTION(retval, INVALID_WARMSTART,
+                     "ReOptimizeTNLP called with a parameter index of a variable that was not fixed.");
+
+    // Continue from the final iterate of the previous optimization.
+    // This snapshot and the parameter values are only used for this
+    // optimization, afterwards the snapshot given to
+    // SetWarmStartSnapshot (if any) and the bounds from the TNLP are
+    // used again.
+    SmartPtr<const WarmStartSnapshot> set_snapshot = warm_start_snapshot_;
+    warm_start_snapshot_ = ConstPtr(GetWarmStartSnapshot());
+    ApplicationReturnStatus retValue;
+    try {
+      retValue = ReOptimizeNLP(nlp_adapter_);
+    }
+    catch (...) {
+      warm_start_snapshot_ = set_snapshot;
+      adapter->ClearParameterValues();
+      throw;
+    }
+    warm_start_snapshot_ = set_snapshot;
+    adapter->ClearParameterValues();
+
+    return retValue;
+  }
+
   ApplicationReturnStatus
   IpoptApplication::OptimizeNLP(const SmartPtr<NLP>& nlp)
   {
@@ -811,7 +930,14 @@ namespace Ipopt
     OrigIpoptNLP* orig_nlp =
       static_cast<OrigIpoptNLP*> (GetRawPtr(ip_nlp_));
     DBG_ASSERT(dynamic_cast<OrigIpoptNLP*> (GetRawPtr(ip_nlp_)));
-    ASSERT_EXCEPTION(orig_nlp->nlp()==nlp, INVALID_WARMSTART,
+    SmartPtr<NLP> used_nlp = orig_nlp->nlp();
+    // OptimizeNLP might have wrapped the NLP to replace the bounds
+    NLPBoundsRemover* bounds_remover =
+      dynamic_cast<NLPBoundsRemover*> (GetRawPtr(used_nlp));
+    if (bounds_remover) {
+      used_nlp = bounds_remover->nlp();
+    }
+    ASSERT_EXCEPTION(used_nlp==nlp, INVALID_WARMSTART,
                      "ReOptimizeTNLP called for different NLP.")
 
     return call_optimize();
@@ -849,6 +975,13 @@ namespace Ipopt
     ip_data_->TimingStats().ResetTimes();
     p2ip_nlp->ResetTimes();
 
+    // Start recording trace events, if requested
+    std::string trace_events_file;
+    options_->GetStringValue("trace_events_file", trace_events_file, "");
+    if (trace_events_file != "") {
+      TraceRecorder::Start();
+    }
+
     ApplicationReturnStatus retValue = Internal_Error;
     SolverReturn status = INTERNAL_ERROR;
     /** Flag indicating if the NLP:FinalizeSolution method should not
@@ -857,6 +990,7 @@ namespace Ipopt
     try {
 
       // Set up the algorithm
+      p2ip_data->SetWarmStartSnapshot(warm_start_snapshot_);
       p2alg->Initialize(*jnlst_, *p2ip_nlp, *p2ip_data, *p2ip_cq,
                         *options_, "");
 
@@ -991,6 +1125,10 @@ namespace Ipopt
         retValue = Maximum_CpuTime_Exceeded;
         jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Maximum CPU time exceeded.\n");
       }
+      else if (status == WALLTIME_EXCEEDED) {
+        retValue = Maximum_WallTime_Exceeded;
+        jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Maximum wallclock time exceeded.\n");
+      }
       else if (status == STOP_AT_TINY_STEP) {
         retValue = Search_Direction_Becomes_Too_Small;
         jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Search Direction is becoming Too Small.\n");
@@ -1090,7 +1228,8 @@ namespace Ipopt
       }
       else
       {
-        jnlst_->FlushBuffer();
+        TraceRecorder::Stop();
+        jnlst_->Synchronize();
         throw;
       }
     }
@@ -1110,6 +1249,7 @@ namespace Ipopt
       switch (status) {
       case SUCCESS:
       case MAXITER_EXCEEDED:
+      case WALLTIME_EXCEEDED:
       case STOP_AT_TINY_STEP:
       case STOP_AT_ACCEPTABLE_POINT:
       case LOCAL_INFEASIBILITY:
@@ -1150,7 +1290,18 @@ namespace Ipopt
                                  obj, p2ip_data, p2ip_cq);
     }
 
-    jnlst_->FlushBuffer();
+    if (trace_events_file != "") {
+      TraceRecorder::Stop();
+      if (!TraceRecorder::WriteChromeTrace(trace_events_file)) {
+        jnlst_->Printf(J_WARNING, J_MAIN,
+                       "Error writing trace events file \"%s\"\n",
+                       trace_events_file.c_str());
+      }
+    }
+
+    // Make sure that all output of this optimization has been
+    // written, also by asynchronous journals
+    jnlst_->Synchronize();
 
     return retValue;
   }
@@ -1161,9 +1312,21 @@ namespace Ipopt
     SmartPtr<Journal> file_jrnl = jnlst_->GetJournal("OutputFile:"+file_name);
 
     if (IsNull(file_jrnl)) {
-      file_jrnl = jnlst_->AddFileJournal("OutputFile:"+file_name,
-                                         file_name.c_str(),
-                                         print_level);
+      bool async_output;
+      options_->GetBoolValue("output_file_async", async_output, "");
+      if (async_output) {
+        SmartPtr<AsyncFileJournal> async_jrnl =
+          new AsyncFileJournal("OutputFile:"+file_name, print_level);
+        if (async_jrnl->Open(file_name.c_str()) &&
+            jnlst_->AddJournal(GetRawPtr(async_jrnl))) {
+          file_jrnl = GetRawPtr(async_jrnl);
+        }
+      }
+      else {
+        file_jrnl = jnlst_->AddFileJournal("OutputFile:"+file_name,
+                                           file_name.c_str(),
+                                           print_level);
+      }
     }
 
     // Check, if the output file could be created properly
@@ -1176,6 +1339,64 @@ namespace Ipopt
     return true;
   }
 
+#ifdef IP_THREAD_SPECIFIC_REG_OPTIONS
+  /** Key for the registered options with all Ipopt options for the
+   *  IpoptApplication objects created in a thread.  The pointer is
+   *  deleted when the thread exits; applications that still hold the
+   *  object keep it alive.  For the main thread, the pointer is
+   *  never deleted, since applications might still be destroyed
+   *  during static destruction. */
+  static pthread_key_t shared_reg_options_key;
+  static pthread_once_t shared_reg_options_once = PTHREAD_ONCE_INIT;
+
+  static void DeleteSharedRegOptions(void* shared_reg_options)
+  {
+    delete static_cast<SmartPtr<RegisteredOptions>*>(shared_reg_options);
+  }
+
+  static void CreateSharedRegOptionsKey()
+  {
+    pthread_key_create(&shared_reg_options_key, DeleteSharedRegOptions);
+  }
+#else
+  /** Registered options with all Ipopt options for the
+   *  IpoptApplication objects created in this thread.  The object is
+   *  never freed, since applications might still be destroyed during
+   *  static destruction. */
+  static IPOPT_THREAD_LOCAL SmartPtr<RegisteredOptions>* shared_reg_options = NULL;
+#endif
+
+  SmartPtr<RegisteredOptions> IpoptApplication::SharedRegisteredOptions()
+  {
+#ifdef IP_THREAD_SPECIFIC_REG_OPTIONS
+    pthread_once(&shared_reg_options_once, CreateSharedRegOptionsKey);
+    SmartPtr<RegisteredOptions>* shared_reg_options =
+      static_cast<SmartPtr<RegisteredOptions>*>(pthread_getspecific(shared_reg_options_key));
+#endif
+    if (!shared_reg_options) {
+      SmartPtr<RegisteredOptions> roptions = new RegisteredOptions();
+      RegisterAllIpoptOptions(roptions);
+      shared_reg_options = new SmartPtr<RegisteredOptions>(roptions);
+#ifdef IP_THREAD_SPECIFIC_REG_OPTIONS
+      pthread_setspecific(shared_reg_options_key, shared_reg_options);
+#endif
+    }
+    return *shared_reg_options;
+  }
+
+  SmartPtr<RegisteredOptions> IpoptApplication::RegOptions()
+  {
+    if (reg_options_shared_) {
+      // The caller might add options, so we need our own copy
+      reg_options_ = new RegisteredOptions(*reg_options_);
+      reg_options_shared_ = false;
+      if (IsValid(options_)) {
+        options_->SetRegisteredOptions(reg_options_);
+      }
+    }
+    return reg_options_;
+  }
+
   void IpoptApplication::RegisterAllIpoptOptions(const SmartPtr<RegisteredOptions>& roptions)
   {
     RegisterOptions_Interfaces(roptions);
@@ -1202,6 +1423,36 @@ namespace Ipopt
     return ip_data_;
   }
 
+  SmartPtr<WarmStartSnapshot> IpoptApplication::GetWarmStartSnapshot()
+  {
+    if (IsNull(ip_data_) || IsNull(ip_data_->curr())) {
+      return NULL;
+    }
+    SmartPtr<WarmStartSnapshot> snapshot = new WarmStartSnapshot();
+    snapshot->TakeFrom(*ip_data_->curr(),
+                       ip_data_->MuInitialized() ? ip_data_->curr_mu() : -1.,
+                       ip_data_->TauInitialized() ? ip_data_->curr_tau() : -1.);
+    snapshot->SetPDPertState(ip_data_->PDPertState());
+    if (IsValid(ip_data_->LimMemS())) {
+      const MultiVectorMatrix* S =
+        static_cast<const MultiVectorMatrix*>(GetRawPtr(ip_data_->LimMemS()));
+      DBG_ASSERT(dynamic_cast<const MultiVectorMatrix*>(GetRawPtr(ip_data_->LimMemS())));
+      const MultiVectorMatrix* Y =
+        static_cast<const MultiVectorMatrix*>(GetRawPtr(ip_data_->LimMemY()));
+      DBG_ASSERT(dynamic_cast<const MultiVectorMatrix*>(GetRawPtr(ip_data_->LimMemY())));
+      snapshot->SetLimMemHistory(*S, *Y, ip_data_->LimMemSigma());
+    }
+    if (IsValid(ip_nlp_)) {
+      snapshot->TakeScalingFrom(*ip_nlp_->NLP_scaling(), *ip_data_->curr());
+    }
+    return snapshot;
+  }
+
+  void IpoptApplication::SetWarmStartSnapshot(const SmartPtr<const WarmStartSnapshot>& snapshot)
+  {
+    warm_start_snapshot_ = snapshot;
+  }
+
   SmartPtr<IpoptCalculatedQuantities> IpoptApplication::IpoptCQObject()
   {
     return ip_cq_;
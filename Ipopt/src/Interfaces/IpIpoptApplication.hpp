@@ -42,8 +42,12 @@ namespace Ipopt
   class RegisteredOptions;
   class OptionsList;
   class SolveStatistics;
+  class WarmStartSnapshot;
 
-  /** This is the main application class for making calls to Ipopt. */
+  /** This is the main application class for making calls to Ipopt.
+   *  An application must be used and destroyed only in the thread
+   *  that created it, unless RegOptions() has been called for it
+   *  there (see SharedRegisteredOptions). */
   class IpoptApplication : public ReferencedObject
   {
   public:
@@ -114,6 +118,25 @@ namespace Ipopt
      *  and Hessian must be the same). */
     virtual ApplicationReturnStatus ReOptimizeTNLP(const SmartPtr<TNLP>& tnlp);
 
+    /** Solve a problem (that inherits from TNLP) for a repeated time
+     *  after changing the values of some of its parameters.  The
+     *  parameters are the variables that had equal lower and upper
+     *  bounds in the OptimizeTNLP call (see the option
+     *  fixed_variable_treatment), and param_idx contains their
+     *  (zero-based) indices.  The new values replace the bounds
+     *  returned by get_bounds_info for these variables in this call
+     *  only; later calls use get_bounds_info again.  The options
+     *  warm_start_same_structure and warm_start_init_point must be
+     *  set to yes, so that the structures, the scaling factors and
+     *  the analysis of the KKT matrix are kept, and the optimization
+     *  starts from the final iterate of the previous optimization.
+     *  This iterate is only used for this call; it does not replace
+     *  a snapshot given to SetWarmStartSnapshot. */
+    virtual ApplicationReturnStatus ReOptimizeTNLP(const SmartPtr<TNLP>& tnlp,
+        Index n_params,
+        const Index* param_idx,
+        const Number* param_values);
+
     /** Solve a problem (that inherits from NLP) for a repeated time.
      *  The OptimizeNLP method must have been called before.  The
      *  NLP must be the same object, and the structure (number of
@@ -135,11 +158,11 @@ namespace Ipopt
     }
 
     /** Get a pointer to RegisteredOptions object to
-     *  add new options */
-    virtual SmartPtr<RegisteredOptions> RegOptions()
-    {
-      return reg_options_;
-    }
+     *  add new options.  If the application still uses the shared
+     *  registered options (see SharedRegisteredOptions), a private
+     *  copy is made first, so that new options are only registered
+     *  for this application. */
+    virtual SmartPtr<RegisteredOptions> RegOptions();
 
     /** Get the options list for setting options */
     virtual SmartPtr<OptionsList> Options()
@@ -170,6 +193,24 @@ namespace Ipopt
     SmartPtr<IpoptAlgorithm> AlgorithmObject();
     //@}
 
+    /**@name Methods for warm starts from a complete iterate */
+    //@{
+    /** Take a snapshot of the current iterate of the most recent
+     *  optimization run, including the slacks, the bound multipliers
+     *  of the slacks and the barrier parameter.  The snapshot also
+     *  keeps the scaling of the problem, so that it is rejected by a
+     *  later optimization that determines a different scaling.
+     *  Returns NULL if there is no iterate. */
+    SmartPtr<WarmStartSnapshot> GetWarmStartSnapshot();
+
+    /** Set the snapshot from which the following optimizations start
+     *  if the option warm_start_init_point is set to yes.  The
+     *  snapshot must have been taken for a problem with the same
+     *  dimensions.  Set NULL to warm start from the starting point
+     *  of the NLP again. */
+    void SetWarmStartSnapshot(const SmartPtr<const WarmStartSnapshot>& snapshot);
+    //@}
+
     /** Method for printing Ipopt copyright message now instead of
      *  just before the optimization.  If you want to have the copy
      *  right message printed earlier than by default, call this
@@ -197,6 +238,20 @@ namespace Ipopt
     static void
     RegisterAllIpoptOptions(const SmartPtr<RegisteredOptions>& roptions);
 
+    /** Method returning the registered options with all Ipopt
+     *  options that are shared by the IpoptApplication objects.  The
+     *  object is created and filled by RegisterAllIpoptOptions when
+     *  this method is called for the first time in a thread, and it
+     *  must not be modified afterwards.  Since the reference counts
+     *  of Ipopt's objects are not synchronized, there is one such
+     *  object per thread.  Therefore, an application that uses this
+     *  object (and its clones and options list) must be used and
+     *  destroyed only in the thread that created it.  An application
+     *  that is to be used or destroyed in another thread has to get
+     *  its own copy of the registered options by calling
+     *  RegOptions() in the thread that created it. */
+    static SmartPtr<RegisteredOptions> SharedRegisteredOptions();
+
   private:
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
@@ -235,6 +290,11 @@ namespace Ipopt
     /** RegisteredOptions */
     SmartPtr<RegisteredOptions> reg_options_;
 
+    /** Flag indicating whether reg_options_ is the object returned
+     *  by SharedRegisteredOptions, which must be copied before new
+     *  options can be registered. */
+    bool reg_options_shared_;
+
     /** OptionsList used for the application */
     SmartPtr<OptionsList> options_;
 
@@ -264,6 +324,9 @@ namespace Ipopt
      *  We keep this around for the ReOptimizerTNLP call. */
     SmartPtr<NLP> nlp_adapter_;
 
+    /** Snapshot from which the following optimizations start */
+    SmartPtr<const WarmStartSnapshot> warm_start_snapshot_;
+
     /** @name Algorithmic parameters */
     //@{
     /** Flag indicating if we are to use the inexact linear solver option */
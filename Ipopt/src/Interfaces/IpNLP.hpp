@@ -132,6 +132,66 @@ namespace Ipopt
                         const Vector& yc,
                         const Vector& yd,
                         SymMatrix& h) = 0;
+
+    /** Method for evaluating the objective function and the
+     *  equality and inequality constraints at several points at
+     *  once.  On return, success[i] indicates whether the values for
+     *  the point x[i] have been computed.  If false is returned,
+     *  none of the points has been evaluated, and the points are
+     *  evaluated one by one with Eval_f, Eval_c, and Eval_d when they
+     *  are needed.  The default implementation returns false. */
+    virtual bool Eval_f_c_d_batch(Index n_points,
+                                  const Vector* const* x,
+                                  Number* f,
+                                  Vector* const* c,
+                                  Vector* const* d,
+                                  bool* success)
+    {
+      return false;
+    }
+
+    /** Method for evaluating the gradient of the objective function,
+     *  the constraint Jacobians, and the Hessian of the Lagrangian at
+     *  the same point at once.  Quantities that are not needed are
+     *  given as NULL.  If false is returned, the quantities are
+     *  evaluated one by one with Eval_grad_f, Eval_jac_c, Eval_jac_d,
+     *  and Eval_h when they are needed.  The default implementation
+     *  returns false. */
+    virtual bool Eval_derivatives(const Vector& x,
+                                  Vector* g_f,
+                                  Matrix* jac_c,
+                                  Matrix* jac_d,
+                                  Number obj_factor,
+                                  const Vector& yc,
+                                  const Vector& yd,
+                                  SymMatrix* h)
+    {
+      return false;
+    }
+
+    /** Method returning false if Eval_derivatives always returns
+     *  false, so that the caller does not need to prepare the
+     *  quantities for it.  The default implementation returns
+     *  false. */
+    virtual bool CanEvalDerivatives() const
+    {
+      return false;
+    }
+
+    /** Method for computing the product of the Hessian of the
+     *  Lagrangian with a vector v, h_v = H(x,obj_factor,yc,yd)*v.
+     *  This is only required if the Hessian space returned in
+     *  GetSpaces is a HessianProductMatrixSpace.  The default
+     *  implementation returns false. */
+    virtual bool Eval_h_prod(const Vector& x,
+                             Number obj_factor,
+                             const Vector& yc,
+                             const Vector& yd,
+                             const Vector& v,
+                             Vector& h_v)
+    {
+      return false;
+    }
     //@}
 
     /** @name NLP solution routines. Have default dummy
@@ -10,6 +10,7 @@
 #include "IpIpoptCalculatedQuantities.hpp"
 #include "IpIpoptNLP.hpp"
 #include "IpIpoptData.hpp"
+#include "IpOrigIpoptNLP.hpp"
 
 namespace Ipopt
 {
@@ -39,7 +40,9 @@ namespace Ipopt
       compl_(ip_cq->unscaled_curr_complementarity(0., NORM_MAX)),
       scaled_kkt_error_(ip_cq->curr_nlp_error()),
       kkt_error_(ip_cq->unscaled_curr_nlp_error())
-  {}
+  {
+    GetTimingSnapshot(*ip_data, *ip_nlp, timing_snapshot_);
+  }
 
   Index SolveStatistics::IterationCount() const
   {
@@ -107,4 +110,51 @@ namespace Ipopt
     return scaled_obj_val_;
   }
 
+  const std::vector<TimedTaskSnapshot>& SolveStatistics::TimingSnapshot() const
+  {
+    return timing_snapshot_;
+  }
+
+  /** Append the snapshot entry for one kind of function evaluation */
+  static void AddEvalSnapshot(std::vector<TimedTaskSnapshot>& snapshot,
+                              const char* name, Index n_evals,
+                              const TimedTask* eval_time)
+  {
+    TimedTaskSnapshot entry;
+    if (eval_time) {
+      entry = eval_time->Snapshot(name);
+    }
+    else {
+      entry.name = name;
+      entry.cpu_time = 0.;
+      entry.sys_time = 0.;
+      entry.wallclock_time = 0.;
+    }
+    entry.n_calls = n_evals;
+    snapshot.push_back(entry);
+  }
+
+  void SolveStatistics::GetTimingSnapshot(const IpoptData& ip_data,
+                                          const IpoptNLP& ip_nlp,
+                                          std::vector<TimedTaskSnapshot>& snapshot)
+  {
+    ip_data.TimingStats().GetSnapshot(snapshot);
+
+    const OrigIpoptNLP* orignlp = dynamic_cast<const OrigIpoptNLP*>(&ip_nlp);
+    AddEvalSnapshot(snapshot, "f_eval", ip_nlp.f_evals(),
+                    orignlp ? &orignlp->f_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "grad_f_eval", ip_nlp.grad_f_evals(),
+                    orignlp ? &orignlp->grad_f_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "c_eval", ip_nlp.c_evals(),
+                    orignlp ? &orignlp->c_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "jac_c_eval", ip_nlp.jac_c_evals(),
+                    orignlp ? &orignlp->jac_c_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "d_eval", ip_nlp.d_evals(),
+                    orignlp ? &orignlp->d_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "jac_d_eval", ip_nlp.jac_d_evals(),
+                    orignlp ? &orignlp->jac_d_eval_time() : NULL);
+    AddEvalSnapshot(snapshot, "h_eval", ip_nlp.h_evals(),
+                    orignlp ? &orignlp->h_eval_time() : NULL);
+  }
+
 } // namespace Ipopt
@@ -11,6 +11,9 @@
 
 #include "IpReferenced.hpp"
 #include "IpSmartPtr.hpp"
+#include "IpTimedTask.hpp"
+
+#include <vector>
 
 namespace Ipopt
 {
@@ -79,8 +82,26 @@ namespace Ipopt
     virtual Number FinalObjective() const;
     /** Final scaled value of objective function */
     virtual Number FinalScaledObjective() const;
+    /** Times and numbers of calls of all timed tasks at the end of
+     *  the optimization (see TimingSnapshot). */
+    virtual const std::vector<TimedTaskSnapshot>& TimingSnapshot() const;
     //@}
 
+    /** Method for taking a snapshot of the times and numbers of
+     *  calls of all timed tasks of the algorithm, followed by the
+     *  entries for the function evaluations ("f_eval",
+     *  "grad_f_eval", "c_eval", "jac_c_eval", "d_eval", "jac_d_eval",
+     *  and "h_eval") with the evaluation counts of ip_nlp.  The
+     *  times for the function evaluations are only available if
+     *  ip_nlp is an OrigIpoptNLP; otherwise they are zero.  This can
+     *  be called at any time during the optimization, e.g., in
+     *  TNLP::intermediate_callback with the ip_data given there and
+     *  ip_cq->GetIpoptNLP().  Differences of two snapshots give the
+     *  times spend in the iterations in between. */
+    static void GetTimingSnapshot(const IpoptData& ip_data,
+                                  const IpoptNLP& ip_nlp,
+                                  std::vector<TimedTaskSnapshot>& snapshot);
+
   private:
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
@@ -142,6 +163,8 @@ namespace Ipopt
     Number scaled_kkt_error_;
     /** Final overall unscaled KKT error (max-norm) */
     Number kkt_error_;
+    /** Times and numbers of calls of the timed tasks */
+    std::vector<TimedTaskSnapshot> timing_snapshot_;
     //@}
   };
 
@@ -32,6 +32,14 @@ struct IpoptProblemInfo
   Number obj_scaling;
   Number* x_scaling;
   Number* g_scaling;
+  Eval_F_G_Batch_CB eval_f_g_batch;
+  /* TNLP of the last IpoptSolve call, reused by IpoptReOptimize */
+  Ipopt::SmartPtr<Ipopt::StdInterfaceTNLP> tnlp;
+  /* Copies of the starting point, kept between the solves */
+  Number* start_x;
+  Number* start_lam;
+  Number* start_z_L;
+  Number* start_z_U;
 };
 
 IpoptProblem CreateIpoptProblem(
@@ -101,6 +109,12 @@ IpoptProblem CreateIpoptProblem(
   retval->x_scaling = NULL;
   retval->g_scaling = NULL;
 
+  retval->eval_f_g_batch = NULL;
+  retval->start_x = NULL;
+  retval->start_lam = NULL;
+  retval->start_z_L = NULL;
+  retval->start_z_U = NULL;
+
   retval->app->RethrowNonIpoptException(false);
 
   return retval;
@@ -116,10 +130,16 @@ void FreeIpoptProblem(IpoptProblem ipopt_problem)
   }
 
   ipopt_problem->app = NULL;
+  ipopt_problem->tnlp = NULL;
 
   delete [] ipopt_problem->x_scaling;
   delete [] ipopt_problem->g_scaling;
 
+  delete [] ipopt_problem->start_x;
+  delete [] ipopt_problem->start_lam;
+  delete [] ipopt_problem->start_z_L;
+  delete [] ipopt_problem->start_z_U;
+
   delete ipopt_problem;
 
 }
@@ -195,6 +215,69 @@ Bool SetIntermediateCallback(IpoptProblem ipopt_problem,
   return (Bool)true;
 }
 
+Bool SetBatchEvalCallback(IpoptProblem ipopt_problem,
+                          Eval_F_G_Batch_CB eval_f_g_batch)
+{
+  ipopt_problem->eval_f_g_batch = eval_f_g_batch;
+  return (Bool)true;
+}
+
+/* Copy the starting point information into the arrays kept in the
+ * IpoptProblem, so that they are allocated only once.  The pointers
+ * for the multipliers are set to NULL if they are not given. */
+static void CopyStartingPoint(
+  IpoptProblem ipopt_problem,
+  const Number* x,
+  const Number* mult_g,
+  const Number* mult_x_L,
+  const Number* mult_x_U,
+  const Number*& start_x,
+  const Number*& start_lam,
+  const Number*& start_z_L,
+  const Number*& start_z_U)
+{
+  const Index n = ipopt_problem->n;
+  const Index m = ipopt_problem->m;
+
+  if (!ipopt_problem->start_x) {
+    ipopt_problem->start_x = new Number[n];
+  }
+  for (Index i=0; i<n; i++) {
+    ipopt_problem->start_x[i] = x[i];
+  }
+  start_x = ipopt_problem->start_x;
+
+  start_lam = NULL;
+  if (mult_g) {
+    if (!ipopt_problem->start_lam) {
+      ipopt_problem->start_lam = new Number[m];
+    }
+    for (Index i=0; i<m; i++) {
+      ipopt_problem->start_lam[i] = mult_g[i];
+    }
+    start_lam = ipopt_problem->start_lam;
+  }
+  start_z_L = NULL;
+  if (mult_x_L) {
+    if (!ipopt_problem->start_z_L) {
+      ipopt_problem->start_z_L = new Number[n];
+    }
+    for (Index i=0; i<n; i++) {
+      ipopt_problem->start_z_L[i] = mult_x_L[i];
+    }
+    start_z_L = ipopt_problem->start_z_L;
+  }
+  start_z_U = NULL;
+  if (mult_x_U) {
+    if (!ipopt_problem->start_z_U) {
+      ipopt_problem->start_z_U = new Number[n];
+    }
+    for (Index i=0; i<n; i++) {
+      ipopt_problem->start_z_U[i] = mult_x_U[i];
+    }
+    start_z_U = ipopt_problem->start_z_U;
+  }
+}
 
 enum ApplicationReturnStatus IpoptSolve(
   IpoptProblem ipopt_problem,
@@ -221,34 +304,16 @@ enum ApplicationReturnStatus IpoptSolve(
   }
 
   // Copy the starting point information
-  ::Number* start_x = new ::Number[ipopt_problem->n];
-  for (::Index i=0; i<ipopt_problem->n; i++) {
-    start_x[i] = x[i];
-  }
-  ::Number* start_lam = NULL;
-  if (mult_g) {
-    start_lam = new ::Number[ipopt_problem->m];
-    for (::Index i=0; i<ipopt_problem->m; i++) {
-      start_lam[i] = mult_g[i];
-    }
-  }
-  ::Number* start_z_L = NULL;
-  if (mult_x_L) {
-    start_z_L = new ::Number[ipopt_problem->n];
-    for (::Index i=0; i<ipopt_problem->n; i++) {
-      start_z_L[i] = mult_x_L[i];
-    }
-  }
-  ::Number* start_z_U = NULL;
-  if (mult_x_U) {
-    start_z_U = new ::Number[ipopt_problem->n];
-    for (::Index i=0; i<ipopt_problem->n; i++) {
-      start_z_U[i] = mult_x_U[i];
-    }
-  }
+  const ::Number* start_x;
+  const ::Number* start_lam;
+  const ::Number* start_z_L;
+  const ::Number* start_z_U;
+  CopyStartingPoint(ipopt_problem, x, mult_g, mult_x_L, mult_x_U,
+                    start_x, start_lam, start_z_L, start_z_U);
 
   // Create the original nlp
-  SmartPtr<TNLP> tnlp;
+  ipopt_problem->tnlp = NULL;
+  SmartPtr<StdInterfaceTNLP> tnlp;
 
   Ipopt::ApplicationReturnStatus status;
   try {
@@ -268,8 +333,10 @@ enum ApplicationReturnStatus IpoptSolve(
                                 obj_val, user_data,
                                 ipopt_problem->obj_scaling,
                                 ipopt_problem->x_scaling,
-                                ipopt_problem->g_scaling);
-    status = ipopt_problem->app->OptimizeTNLP(tnlp);
+                                ipopt_problem->g_scaling,
+                                ipopt_problem->eval_f_g_batch);
+    status = ipopt_problem->app->OptimizeTNLP(GetRawPtr(tnlp));
+    ipopt_problem->tnlp = tnlp;
   }
   catch (INVALID_STDINTERFACE_NLP& exc) {
     exc.ReportException(*ipopt_problem->app->Jnlst(), J_ERROR);
@@ -280,10 +347,57 @@ enum ApplicationReturnStatus IpoptSolve(
     status = Ipopt::Unrecoverable_Exception;
   }
 
-  delete [] start_x;
-  delete [] start_lam;
-  delete [] start_z_L;
-  delete [] start_z_U;
+  return (::ApplicationReturnStatus) status;
+}
+
+enum ApplicationReturnStatus IpoptReOptimize(
+  IpoptProblem ipopt_problem,
+  Number* x,
+  Number* g,
+  Number* obj_val,
+  Number* mult_g,
+  Number* mult_x_L,
+  Number* mult_x_U,
+  UserDataPtr user_data)
+{
+  using namespace Ipopt;
+
+  if (IsNull(ipopt_problem->tnlp)) {
+    return IpoptSolve(ipopt_problem, x, g, obj_val, mult_g, mult_x_L,
+                      mult_x_U, user_data);
+  }
+
+  if (!x) {
+    ipopt_problem->app->Jnlst()->Printf(J_ERROR, J_MAIN,
+                                        "Error: Array x with starting point information is NULL.");
+    return (::ApplicationReturnStatus) Ipopt::Invalid_Problem_Definition;
+  }
+
+  const ::Number* start_x;
+  const ::Number* start_lam;
+  const ::Number* start_z_L;
+  const ::Number* start_z_U;
+  CopyStartingPoint(ipopt_problem, x, mult_g, mult_x_L, mult_x_U,
+                    start_x, start_lam, start_z_L, start_z_U);
+
+  Ipopt::ApplicationReturnStatus status;
+  try {
+    ipopt_problem->tnlp->SetSolveData(start_x, start_lam, start_z_L,
+                                      start_z_U, x, mult_x_L, mult_x_U, g,
+                                      mult_g, obj_val, user_data);
+    ipopt_problem->tnlp->SetOptionalCallbacks(ipopt_problem->intermediate_cb,
+        ipopt_problem->eval_f_g_batch);
+    status =
+      ipopt_problem->app->ReOptimizeTNLP(GetRawPtr(ipopt_problem->tnlp));
+  }
+  catch (INVALID_STDINTERFACE_NLP& exc) {
+    exc.ReportException(*ipopt_problem->app->Jnlst(), J_ERROR);
+    status = Ipopt::Invalid_Problem_Definition;
+  }
+  catch( IpoptException& exc ) {
+    exc.ReportException(*ipopt_problem->app->Jnlst(), J_ERROR);
+    status = Ipopt::Unrecoverable_Exception;
+  }
 
   return (::ApplicationReturnStatus) status;
 }
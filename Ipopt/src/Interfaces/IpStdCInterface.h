@@ -98,6 +98,18 @@ extern "C"
                             Index nele_hess, Index *iRow, Index *jCol,
                             Number *values, UserDataPtr user_data);
 
+  /** Type defining the callback function for evaluating the
+   *  objective function and the constraint functions at several
+   *  points at once.  The n_points points are stored one after
+   *  another in x (n values per point).  The objective values are to
+   *  be written into obj_values (n_points values), and the
+   *  constraint values into g (m values per point).  Return value
+   *  should be set to false if the points have not been evaluated;
+   *  then Ipopt evaluates them one by one with the other callbacks. */
+  typedef Bool (*Eval_F_G_Batch_CB)(Index n, Index n_points, Number* x,
+                                    Number* obj_values, Index m, Number* g,
+                                    UserDataPtr user_data);
+
   /** Type defining the callback function for giving intermediate
    *  execution control to the user.  If set, it is called once per
    *  iteration, providing the user with some information on the state
@@ -223,6 +235,16 @@ extern "C"
   IPOPT_EXPORT(Bool) SetIntermediateCallback(IpoptProblem ipopt_problem,
 					     Intermediate_CB intermediate_cb);
 
+  /** Setting a callback function that evaluates the objective and
+   *  constraint functions at several points at once, for example in
+   *  parallel.  This corresponds to the eval_f_g_batch method in
+   *  TNLP.  Ipopt uses it to evaluate several trial points of the
+   *  line search together if the option line_search_trial_batch_size
+   *  is larger than 1.  Calling this set method to set the CB pointer
+   *  to NULL disables the batch evaluation. */
+  IPOPT_EXPORT(Bool) SetBatchEvalCallback(IpoptProblem ipopt_problem,
+                                          Eval_F_G_Batch_CB eval_f_g_batch);
+
   /** Function calling the Ipopt optimization algorithm for a problem
       previously defined with CreateIpoptProblem.  The return
       specified outcome of the optimization procedure (e.g., success,
@@ -260,6 +282,31 @@ extern "C"
                              functions. */
   );
 
+  /** Function solving a problem again that has been solved before
+      with IpoptSolve, for example with a different starting point or
+      with different data in user_data.  The internal data structures
+      of Ipopt that depend only on the problem structure are kept from
+      the previous solve, and the options file is not read again.
+      The intermediate callback and the batch evaluation callback are
+      the ones currently set with SetIntermediateCallback and
+      SetBatchEvalCallback.  The scaling given to
+      SetIpoptProblemScaling before the previous IpoptSolve call is
+      used again, like the other problem data.  The arguments have
+      the same meaning as for IpoptSolve.  If IpoptSolve has not been
+      called before for this problem, this is identical to
+      IpoptSolve.
+   */
+  IPOPT_EXPORT(enum ApplicationReturnStatus) IpoptReOptimize(
+      IpoptProblem ipopt_problem
+    , Number* x
+    , Number* g
+    , Number* obj_val
+    , Number* mult_g
+    , Number* mult_x_L
+    , Number* mult_x_U
+    , UserDataPtr user_data
+  );
+
   /**
   void IpoptStatisticsCounts;
 
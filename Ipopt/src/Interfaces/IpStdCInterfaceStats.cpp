@@ -36,6 +36,12 @@ struct IpoptProblemInfo
   Number obj_scaling;
   Number* x_scaling;
   Number* g_scaling;
+  Eval_F_G_Batch_CB eval_f_g_batch;
+  Ipopt::SmartPtr<Ipopt::StdInterfaceTNLP> tnlp;
+  Number* start_x;
+  Number* start_lam;
+  Number* start_z_L;
+  Number* start_z_U;
 };
 
 IpoptProblemStats ReturnIpoptProblemStats(IpoptProblem ipopt_problem)
@@ -37,7 +37,8 @@ namespace Ipopt
                                      UserDataPtr user_data,
                                      Number obj_scaling/*=1*/,
                                      const Number* x_scaling /*= NULL*/,
-                                     const Number* g_scaling /*= NULL*/)
+                                     const Number* g_scaling /*= NULL*/,
+                                     Eval_F_G_Batch_CB eval_f_g_batch /*= NULL*/)
       :
       TNLP(),
       n_var_(n_var),
@@ -59,11 +60,14 @@ namespace Ipopt
       eval_jac_g_(eval_jac_g),
       eval_h_(eval_h),
       intermediate_cb_(intermediate_cb),
+      eval_f_g_batch_(eval_f_g_batch),
       user_data_(user_data),
       obj_scaling_(obj_scaling),
       x_scaling_(NULL),
       g_scaling_(NULL),
       non_const_x_(NULL),
+      non_const_batch_x_(NULL),
+      batch_x_size_(0),
       x_sol_(x_sol),
       z_L_sol_(z_L_sol),
       z_U_sol_(z_U_sol),
@@ -121,10 +125,45 @@ namespace Ipopt
   StdInterfaceTNLP::~StdInterfaceTNLP()
   {
     delete [] non_const_x_;
+    delete [] non_const_batch_x_;
     delete [] x_scaling_;
     delete [] g_scaling_;
   }
 
+  void StdInterfaceTNLP::SetSolveData(const Number* start_x,
+                                      const Number* start_lam,
+                                      const Number* start_z_L,
+                                      const Number* start_z_U,
+                                      Number* x_sol,
+                                      Number* z_L_sol,
+                                      Number* z_U_sol,
+                                      Number* g_sol,
+                                      Number* lam_sol,
+                                      Number* obj_sol,
+                                      UserDataPtr user_data)
+  {
+    ASSERT_EXCEPTION(start_x, INVALID_STDINTERFACE_NLP,
+                     "No initial point for the variables provided.");
+    start_x_ = start_x;
+    start_lam_ = start_lam;
+    start_z_L_ = start_z_L;
+    start_z_U_ = start_z_U;
+    x_sol_ = x_sol;
+    z_L_sol_ = z_L_sol;
+    z_U_sol_ = z_U_sol;
+    g_sol_ = g_sol;
+    lambda_sol_ = lam_sol;
+    obj_sol_ = obj_sol;
+    user_data_ = user_data;
+  }
+
+  void StdInterfaceTNLP::SetOptionalCallbacks(Intermediate_CB intermediate_cb,
+      Eval_F_G_Batch_CB eval_f_g_batch)
+  {
+    intermediate_cb_ = intermediate_cb;
+    eval_f_g_batch_ = eval_f_g_batch;
+  }
+
   bool StdInterfaceTNLP::get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
                                       Index& nnz_h_lag, IndexStyleEnum& index_style)
   {
@@ -275,6 +314,32 @@ namespace Ipopt
     return (retval!=0);
   }
 
+  bool StdInterfaceTNLP::eval_f_g_batch(Index n, Index n_points,
+                                        const Number* x,
+                                        Number* obj_values, Index m,
+                                        Number* g)
+  {
+    DBG_ASSERT(n==n_var_);
+    DBG_ASSERT(m==n_con_);
+
+    if (!eval_f_g_batch_) {
+      return false;
+    }
+
+    if (n*n_points > batch_x_size_) {
+      delete [] non_const_batch_x_;
+      batch_x_size_ = n*n_points;
+      non_const_batch_x_ = new Number[batch_x_size_];
+    }
+    for (Index i=0; i<n*n_points; i++) {
+      non_const_batch_x_[i] = x[i];
+    }
+
+    Bool retval = (*eval_f_g_batch_)(n, n_points, non_const_batch_x_,
+                                     obj_values, m, g, user_data_);
+    return (retval!=0);
+  }
+
   bool StdInterfaceTNLP::eval_jac_g(Index n, const Number* x, bool new_x,
                                     Index m, Index nele_jac, Index* iRow,
                                     Index *jCol, Number* values)
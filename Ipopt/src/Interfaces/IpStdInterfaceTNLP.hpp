@@ -62,12 +62,33 @@ namespace Ipopt
                      UserDataPtr user_data,
                      Number obj_scaling=1,
                      const Number* x_scaling = NULL,
-                     const Number* g_scaling = NULL);
+                     const Number* g_scaling = NULL,
+                     Eval_F_G_Batch_CB eval_f_g_batch = NULL);
 
     /** Default destructor */
     virtual ~StdInterfaceTNLP();
     //@}
 
+    /** Set the arrays for the starting point and the solution, and
+     *  the user data, for solving the problem again.  As for the
+     *  constructor, the arrays are not copied. */
+    void SetSolveData(const Number* start_x,
+                      const Number* start_lam,
+                      const Number* start_z_L,
+                      const Number* start_z_U,
+                      Number* x_sol,
+                      Number* z_L_sol,
+                      Number* z_U_sol,
+                      Number* g_sol,
+                      Number* lam_sol,
+                      Number* obj_sol,
+                      UserDataPtr user_data);
+
+    /** Set the callbacks that may be changed between solves of the
+     *  same problem.  NULL disables the callback. */
+    void SetOptionalCallbacks(Intermediate_CB intermediate_cb,
+                              Eval_F_G_Batch_CB eval_f_g_batch);
+
     /**@name methods to gather information about the NLP. These methods are
      * overloaded from TNLP. See TNLP for their more detailed documentation. */
     //@{
@@ -105,6 +126,12 @@ namespace Ipopt
     virtual bool eval_g(Index n, const Number* x, bool new_x, Index m,
                         Number* g);
 
+    /** evaluates the objective value and the constraint residuals at
+     *  several points, if a batch evaluation callback has been
+     *  provided.  Overloaded from TNLP */
+    virtual bool eval_f_g_batch(Index n, Index n_points, const Number* x,
+                                Number* obj_values, Index m, Number* g);
+
     /** specifies the jacobian structure (if values is NULL) and
      *  evaluates the jacobian values (if values is not NULL) for the
      *  nlp. Overloaded from TNLP */
@@ -189,6 +216,9 @@ namespace Ipopt
     Eval_H_CB eval_h_;
     /** Pointer to intermediate callback function giving control to user */
     Intermediate_CB intermediate_cb_;
+    /** Pointer to callback function evaluating objective function and
+     *  constraints at several points (if not NULL) */
+    Eval_F_G_Batch_CB eval_f_g_batch_;
     /** Pointer to user data */
     UserDataPtr user_data_;
     /** Objective scaling factor */
@@ -203,6 +233,11 @@ namespace Ipopt
     /** A non-const copy of x - this is kept up-to-date in apply_new_x */
     Number* non_const_x_;
 
+    /** A non-const copy of the points for eval_f_g_batch */
+    Number* non_const_batch_x_;
+    /** Size of non_const_batch_x_ */
+    Index batch_x_size_;
+
     /** Pointers to the user provided vectors for solution */
     Number* x_sol_;
     Number* z_L_sol_;
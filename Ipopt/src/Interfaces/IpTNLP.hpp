@@ -200,6 +200,41 @@ namespace Ipopt
     {
       return false;
     }
+
+    /** overload this method to evaluate the objective function and
+     *  the constraints at several points at once, for example in
+     *  parallel.  The n_points points are stored one after another
+     *  in x (n values per point).  The objective values are to be
+     *  written into obj_values (n_points values), and the constraint
+     *  values into g (m values per point, in the order of the
+     *  points).  This is used by Ipopt to evaluate several trial
+     *  points of the line search together (see the option
+     *  line_search_trial_batch_size).  Calls of the other evaluation
+     *  methods afterwards always have new_x set to true.  If false is
+     *  returned, Ipopt evaluates the points one by one with eval_f
+     *  and eval_g when they are needed.  A default implementation is
+     *  provided which returns false. */
+    virtual bool eval_f_g_batch(Index n, Index n_points, const Number* x,
+                                Number* obj_values, Index m, Number* g)
+    {
+      return false;
+    }
+
+    /** overload this method to return the product of the hessian of
+     *  the lagrangian with the vector v.  This is only called if the
+     *  option hessian_approximation is set to "exact-product"; in
+     *  that case eval_h is never called and the hessian is never
+     *  formed explicitly (which requires the inexact algorithm).
+     *  The product is to be written into h_v, which has been
+     *  allocated with length n.  A default implementation is
+     *  provided which returns false. */
+    virtual bool eval_h_prod(Index n, const Number* x, bool new_x,
+                             Number obj_factor, Index m,
+                             const Number* lambda, bool new_lambda,
+                             const Number* v, Number* h_v)
+    {
+      return false;
+    }
     //@}
 
     /** @name Solution Methods */
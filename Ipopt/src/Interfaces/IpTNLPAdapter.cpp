@@ -15,9 +15,11 @@
 #include "IpExpansionMatrix.hpp"
 #include "IpGenTMatrix.hpp"
 #include "IpSymTMatrix.hpp"
+#include "IpHessianProductMatrix.hpp"
 #include "IpTDependencyDetector.hpp"
 #include "IpTSymDependencyDetector.hpp"
 #include "IpTripletToCSRConverter.hpp"
+#include "IpTraceRecorder.hpp"
 
 #ifdef COIN_HAS_HSL
 #include "CoinHslConfig.h"
@@ -71,6 +73,14 @@ namespace Ipopt
       full_g_(NULL),
       jac_g_(NULL),
       c_rhs_(NULL),
+      h_prod_v_(NULL),
+      h_prod_h_v_(NULL),
+      full_x_values_(NULL),
+      full_lambda_values_(NULL),
+      g_is_c_(false),
+      g_is_d_(false),
+      jac_g_is_jac_c_(false),
+      jac_g_is_jac_d_(false),
       x_tag_for_iterates_(0),
       y_c_tag_for_iterates_(0),
       y_d_tag_for_iterates_(0),
@@ -96,6 +106,8 @@ namespace Ipopt
     delete [] full_g_;
     delete [] jac_g_;
     delete [] c_rhs_;
+    delete [] h_prod_v_;
+    delete [] h_prod_h_v_;
     delete [] jac_idx_map_;
     delete [] h_idx_map_;
     delete [] x_fixed_map_;
@@ -157,6 +169,18 @@ namespace Ipopt
       "num_linear_variables variables are linear.  The Hessian is then not "
       "approximated in this space.  If the get_number_of_nonlinear_variables "
       "method in the TNLP is implemented, this option is ignored.");
+    roptions->AddLowerBoundedIntegerOption(
+      "evaluation_threads",
+      "Number of threads that may evaluate the problem functions concurrently.",
+      1, 1,
+      "If this is larger than 1, Ipopt may call the evaluation methods of "
+      "the TNLP from several threads at the same time, each time with "
+      "new_x set to true.  This is currently done for the trial points "
+      "of the line search (see \"line_search_trial_batch_size\") if the "
+      "TNLP does not implement eval_f_g_batch, and for the gradient of the "
+      "objective, the constraint Jacobian, and the Hessian at a new "
+      "iterate.  Only choose a value larger than 1 if the evaluation "
+      "methods of the TNLP are thread-safe.");
 
     roptions->SetRegisteringCategory("Derivative Checker");
     roptions->AddStringOption4(
@@ -272,6 +296,15 @@ namespace Ipopt
 
     options.GetNumericValue("tol", tol_, prefix);
 
+    options.GetIntegerValue("evaluation_threads", evaluation_threads_, prefix);
+    if (evaluation_threads_ <= 1) {
+      thread_pool_ = NULL;
+    }
+    else if (IsNull(thread_pool_) ||
+             thread_pool_->NumThreads() != evaluation_threads_) {
+      thread_pool_ = new ThreadPool(evaluation_threads_);
+    }
+
     options.GetBoolValue("dependency_detection_with_rhs",
                          dependency_detection_with_rhs_, prefix);
     std::string dependency_detector;
@@ -386,6 +419,10 @@ namespace Ipopt
       jac_g_ = NULL;
       delete [] c_rhs_;
       c_rhs_ = NULL;
+      delete [] h_prod_v_;
+      h_prod_v_ = NULL;
+      delete [] h_prod_h_v_;
+      h_prod_h_v_ = NULL;
       delete [] jac_idx_map_;
       jac_idx_map_ = NULL;
       delete [] h_idx_map_;
@@ -1188,6 +1225,15 @@ namespace Ipopt
       }
       nz_jac_d_ = current_nz;
       Jac_d_space_ = new GenTMatrixSpace(n_d, n_x_var, nz_jac_d_, jac_d_iRow, jac_d_jCol);
+
+      // If all constraints are of the same type and none has been
+      // removed, the data of the TNLP can be used in c or d (and the
+      // multipliers) without copying, since c_map and d_map, as well
+      // as jac_idx_map_, keep the original order
+      g_is_c_ = (n_c == n_full_g_);
+      g_is_d_ = (n_d == n_full_g_);
+      jac_g_is_jac_c_ = g_is_c_ && (nz_jac_c_no_extra_ == nz_full_jac_g_);
+      jac_g_is_jac_d_ = g_is_d_ && (nz_jac_d_ == nz_full_jac_g_);
       delete [] jac_d_iRow;
       jac_d_iRow = NULL;
       delete [] jac_d_jCol;
@@ -1261,6 +1307,12 @@ namespace Ipopt
         delete [] h_jCol;
         h_jCol = NULL;
       }
+      else if (hessian_approximation_==EXACT_PRODUCT) {
+        /** The hessian is only available through products with the
+         *  TNLP's eval_h_prod, so no structure is required */
+        nz_h_ = 0;
+        Hess_lagrangian_space_ = new HessianProductMatrixSpace(n_x_var, *this);
+      }
       else {
         nz_h_ = 0;
         Hess_lagrangian_space_ = NULL;
@@ -1295,6 +1347,53 @@ namespace Ipopt
     return true;
   }
 
+  bool TNLPAdapter::SetParameterValues(Index n_params,
+                                       const Index* param_idx,
+                                       const Number* param_values)
+  {
+    DBG_START_METH("TNLPAdapter::SetParameterValues", dbg_verbosity);
+    // Only variables that have been fixed when the structure was set
+    // up can be changed without changing the structure
+    if (fixed_variable_treatment_==RELAX_BOUNDS) {
+      return n_params == 0;
+    }
+    for (Index k=0; k<n_params; k++) {
+      bool is_param = false;
+      for (Index i=0; i<n_x_fixed_; i++) {
+        if (x_fixed_map_[i] == param_idx[k]) {
+          is_param = true;
+          break;
+        }
+      }
+      if (!is_param) {
+        return false;
+      }
+    }
+
+    for (Index k=0; k<n_params; k++) {
+      size_t i;
+      for (i=0; i<param_idx_.size(); i++) {
+        if (param_idx_[i] == param_idx[k]) {
+          break;
+        }
+      }
+      if (i == param_idx_.size()) {
+        param_idx_.push_back(param_idx[k]);
+        param_values_.push_back(param_values[k]);
+      }
+      else {
+        param_values_[i] = param_values[k];
+      }
+    }
+    return true;
+  }
+
+  void TNLPAdapter::ClearParameterValues()
+  {
+    param_idx_.clear();
+    param_values_.clear();
+  }
+
   bool TNLPAdapter::GetBoundsInformation(const Matrix& Px_L,
                                          Vector& x_L,
                                          const Matrix& Px_U,
@@ -1316,6 +1415,12 @@ namespace Ipopt
                                          n_full_g_, g_l, g_u);
     ASSERT_EXCEPTION(retval, INVALID_TNLP, "get_bounds_info returned false in GetBoundsInformation");
 
+    // Use the values given to SetParameterValues for the parameters
+    for (size_t i=0; i<param_idx_.size(); i++) {
+      x_l[param_idx_[i]] = param_values_[i];
+      x_u[param_idx_[i]] = param_values_[i];
+    }
+
     if (fixed_variable_treatment_==MAKE_PARAMETER) {
       // Set the values of fixed variables
       for (Index i=0; i<n_x_fixed_; i++) {
@@ -1457,40 +1562,78 @@ namespace Ipopt
                                      bool need_z_U
                                     )
   {
-    Number* full_x = new Number[n_full_x_];
-    Number* full_z_l = new Number[n_full_x_];
-    Number* full_z_u = new Number[n_full_x_];
-    Number* full_lambda = new Number[n_full_g_];
     bool init_x = need_x;
     bool init_z = need_z_L || need_z_U;
     bool init_lambda = need_y_c || need_y_d;
 
+    // If there are no fixed variables, the TNLP can write the
+    // starting point directly into x.  Otherwise, we need a separate
+    // array, since full_x_ holds the values of the fixed variables.
+    Number* full_x;
+    Number* full_x_tmp = NULL;
+    if (IsNull(P_x_full_x_)) {
+      if (need_x) {
+        DenseVector* dx = static_cast<DenseVector*>(GetRawPtr(x));
+        DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(x)));
+        full_x = dx->Values();
+      }
+      else {
+        full_x = full_x_;
+        x_tag_for_iterates_ = 0;
+      }
+    }
+    else {
+      full_x_tmp = new Number[n_full_x_];
+      full_x = full_x_tmp;
+    }
+
+    // The multipliers can be written directly into y_c or y_d if all
+    // constraints are of the same type, otherwise we use full_lambda_
+    Number* full_lambda;
+    if (g_is_c_ && need_y_c) {
+      DenseVector* dy_c = static_cast<DenseVector*>(GetRawPtr(y_c));
+      DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(y_c)));
+      full_lambda = dy_c->Values();
+    }
+    else if (g_is_d_ && need_y_d) {
+      DenseVector* dy_d = static_cast<DenseVector*>(GetRawPtr(y_d));
+      DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(y_d)));
+      full_lambda = dy_d->Values();
+    }
+    else {
+      full_lambda = full_lambda_;
+      y_c_tag_for_iterates_ = 0;
+      y_d_tag_for_iterates_ = 0;
+    }
+
+    // The bound multipliers are only required for a warm start
+    Number* full_z_l = NULL;
+    Number* full_z_u = NULL;
+    if (init_z) {
+      full_z_l = new Number[n_full_x_];
+      full_z_u = new Number[n_full_x_];
+    }
+
     bool retvalue =
       tnlp_->get_starting_point(n_full_x_, init_x, full_x, init_z,
                                 full_z_l, full_z_u, n_full_g_, init_lambda,
                                 full_lambda);
 
     if (!retvalue) {
-      delete [] full_x;
+      delete [] full_x_tmp;
       delete [] full_z_l;
       delete [] full_z_u;
-      delete [] full_lambda;
       return false;
     }
 
-    if (need_x) {
+    if (need_x && IsValid(P_x_full_x_)) {
       DenseVector* dx = static_cast<DenseVector*>(GetRawPtr(x));
       DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(x)));
       Number* values = dx->Values();
       const Index& n_x_var = x->Dim();
-      if (IsValid(P_x_full_x_)) {
-        const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
-        for (Index i=0; i<n_x_var; i++) {
-          values[i] = full_x[x_pos[i]];
-        }
-      }
-      else {
-        IpBlasDcopy(n_x_var, full_x, 1, values, 1);
+      const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
+      for (Index i=0; i<n_x_var; i++) {
+        values[i] = full_x[x_pos[i]];
       }
     }
 
@@ -1498,9 +1641,11 @@ namespace Ipopt
       DenseVector* dy_c = static_cast<DenseVector*>(GetRawPtr(y_c));
       DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(y_c)));
       Number* values = dy_c->Values();
-      const Index* y_c_pos = P_c_g_->ExpandedPosIndices();
-      for (Index i=0; i<P_c_g_->NCols(); i++) {
-        values[i] = full_lambda[y_c_pos[i]];
+      if (values != full_lambda) {
+        const Index* y_c_pos = P_c_g_->ExpandedPosIndices();
+        for (Index i=0; i<P_c_g_->NCols(); i++) {
+          values[i] = full_lambda[y_c_pos[i]];
+        }
       }
       if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
         // ToDo maybe use info from z_L and Z_U here?
@@ -1513,9 +1658,11 @@ namespace Ipopt
       DenseVector* dy_d = static_cast<DenseVector*>(GetRawPtr(y_d));
       DBG_ASSERT(dynamic_cast<DenseVector*>(GetRawPtr(y_d)));
       Number* values = dy_d->Values();
-      const Index* y_d_pos = P_d_g_->ExpandedPosIndices();
-      for (Index i=0; i<y_d->Dim(); i++) {
-        values[i] = full_lambda[y_d_pos[i]];
+      if (values != full_lambda) {
+        const Index* y_d_pos = P_d_g_->ExpandedPosIndices();
+        for (Index i=0; i<y_d->Dim(); i++) {
+          values[i] = full_lambda[y_d_pos[i]];
+        }
       }
     }
 
@@ -1562,14 +1709,9 @@ namespace Ipopt
       }
     }
 
-    delete [] full_x;
-    full_x = NULL;
+    delete [] full_x_tmp;
     delete [] full_z_l;
-    full_z_l = NULL;
     delete [] full_z_u;
-    full_z_u = NULL;
-    delete [] full_lambda;
-    full_lambda = NULL;
 
     return true;
   }
@@ -1581,15 +1723,17 @@ namespace Ipopt
 
   bool TNLPAdapter::Eval_f(const Vector& x, Number& f)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_f");
     bool new_x = false;
     if (update_local_x(x)) {
       new_x = true;
     }
-    return tnlp_->eval_f(n_full_x_, full_x_, new_x, f);
+    return tnlp_->eval_f(n_full_x_, full_x_values_, new_x, f);
   }
 
   bool TNLPAdapter::Eval_grad_f(const Vector& x, Vector& g_f)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_grad_f");
     bool retvalue = false;
     bool new_x = false;
     if (update_local_x(x)) {
@@ -1601,7 +1745,7 @@ namespace Ipopt
     Number* values = dg_f->Values();
     if (IsValid(P_x_full_x_)) {
       Number* full_grad_f = new Number[n_full_x_];
-      if (tnlp_->eval_grad_f(n_full_x_, full_x_, new_x, full_grad_f)) {
+      if (tnlp_->eval_grad_f(n_full_x_, full_x_values_, new_x, full_grad_f)) {
         const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
         for (Index i=0; i<g_f.Dim(); i++) {
           values[i] = full_grad_f[x_pos[i]];
@@ -1611,7 +1755,7 @@ namespace Ipopt
       delete [] full_grad_f;
     }
     else {
-      retvalue = tnlp_->eval_grad_f(n_full_x_, full_x_, new_x, values);
+      retvalue = tnlp_->eval_grad_f(n_full_x_, full_x_values_, new_x, values);
     }
 
     return retvalue;
@@ -1619,60 +1763,85 @@ namespace Ipopt
 
   bool TNLPAdapter::Eval_c(const Vector& x, Vector& c)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_c");
     bool new_x = false;
     if (update_local_x(x)) {
       new_x = true;
     }
 
-    if (internal_eval_g(new_x)) {
-      DenseVector* dc = static_cast<DenseVector*>(&c);
-      DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
-      Number* values = dc->Values();
+    DenseVector* dc = static_cast<DenseVector*>(&c);
+    DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
+    Number* values = dc->Values();
+    Index n_c_no_fixed = P_c_g_->NCols();
+
+    if (g_is_c_ && jacobian_approximation_ == JAC_EXACT) {
+      // All constraints are equality constraints, so the TNLP can
+      // write them directly into c
+      if (!tnlp_->eval_g(n_full_x_, full_x_values_, new_x, n_full_g_, values)) {
+        return false;
+      }
+    }
+    else {
+      if (!internal_eval_g(new_x)) {
+        return false;
+      }
       const Index* c_pos = P_c_g_->ExpandedPosIndices();
-      Index n_c_no_fixed = P_c_g_->NCols();
       for (Index i=0; i<n_c_no_fixed; i++) {
         values[i] = full_g_[c_pos[i]];
-        values[i] -= c_rhs_[i];
       }
-      if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
-        for (Index i=0; i<n_x_fixed_; i++) {
-          values[n_c_no_fixed+i] =
-            full_x_[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed+i];
-        }
-      }
-      return true;
     }
 
-    return false;
+    for (Index i=0; i<n_c_no_fixed; i++) {
+      values[i] -= c_rhs_[i];
+    }
+    if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
+      for (Index i=0; i<n_x_fixed_; i++) {
+        values[n_c_no_fixed+i] =
+          full_x_values_[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed+i];
+      }
+    }
+    return true;
   }
 
   bool TNLPAdapter::Eval_jac_c(const Vector& x, Matrix& jac_c)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_jac_c");
     bool new_x = false;
     if (update_local_x(x)) {
       new_x = true;
     }
 
-    if (internal_eval_jac_g(new_x)) {
-      GenTMatrix* gt_jac_c = static_cast<GenTMatrix*>(&jac_c);
-      DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_c));
-      Number* values = gt_jac_c->Values();
+    GenTMatrix* gt_jac_c = static_cast<GenTMatrix*>(&jac_c);
+    DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_c));
+    Number* values = gt_jac_c->Values();
 
+    if (jac_g_is_jac_c_ && jacobian_approximation_ == JAC_EXACT) {
+      // The Jacobian of g has the same structure as the one of c, so
+      // the TNLP can write the values directly into jac_c
+      if (!tnlp_->eval_jac_g(n_full_x_, full_x_values_, new_x, n_full_g_,
+                             nz_full_jac_g_, NULL, NULL, values)) {
+        return false;
+      }
+    }
+    else {
+      if (!internal_eval_jac_g(new_x)) {
+        return false;
+      }
       for (Index i=0; i<nz_jac_c_no_extra_; i++) {
         // Assume the same structure as initially given
         values[i] = jac_g_[jac_idx_map_[i]];
       }
-      if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
-        const Number one = 1.;
-        IpBlasDcopy(n_x_fixed_, &one, 0, &values[nz_jac_c_no_extra_], 1);
-      }
-      return true;
     }
-    return false;
+    if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
+      const Number one = 1.;
+      IpBlasDcopy(n_x_fixed_, &one, 0, &values[nz_jac_c_no_extra_], 1);
+    }
+    return true;
   }
 
   bool TNLPAdapter::Eval_d(const Vector& x, Vector& d)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_d");
     bool new_x = false;
     if (update_local_x(x)) {
       new_x = true;
@@ -1681,6 +1850,11 @@ namespace Ipopt
     DenseVector* dd = static_cast<DenseVector*>(&d);
     DBG_ASSERT(dynamic_cast<DenseVector*>(&d));
     Number* values = dd->Values();
+    if (g_is_d_ && jacobian_approximation_ == JAC_EXACT) {
+      // All constraints are inequality constraints, so the TNLP can
+      // write them directly into d
+      return tnlp_->eval_g(n_full_x_, full_x_values_, new_x, n_full_g_, values);
+    }
     if (internal_eval_g(new_x)) {
       const Index* d_pos = P_d_g_->ExpandedPosIndices();
       for (Index i=0; i<d.Dim(); i++) {
@@ -1692,13 +1866,300 @@ namespace Ipopt
     return false;
   }
 
+  /** Data for evaluating the TNLP at several points concurrently */
+  struct TNLPBatchEvalData
+  {
+    TNLP* tnlp;
+    Index n;
+    Index m;
+    const Number* x;
+    Number* f;
+    Number* g;
+    bool* success;
+  };
+
+  /** Evaluate the objective and the constraints of the TNLP at one
+   *  point, called by the threads of the thread pool */
+  static void TNLPBatchEvalTask(void* data, Index i)
+  {
+    TNLPBatchEvalData* eval_data = static_cast<TNLPBatchEvalData*>(data);
+    const Index n = eval_data->n;
+    const Index m = eval_data->m;
+    const Number* x = eval_data->x + i*n;
+    eval_data->success[i] =
+      eval_data->tnlp->eval_f(n, x, true, eval_data->f[i]) &&
+      eval_data->tnlp->eval_g(n, x, true, m, eval_data->g + i*m);
+  }
+
+  bool TNLPAdapter::Eval_f_c_d_batch(Index n_points,
+                                     const Vector* const* x,
+                                     Number* f,
+                                     Vector* const* c,
+                                     Vector* const* d,
+                                     bool* success)
+  {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_f_c_d_batch");
+    if (n_points == 0) {
+      return true;
+    }
+
+    Number* batch_x = new Number[n_points*n_full_x_];
+    Number* batch_g = new Number[n_points*n_full_g_];
+    for (Index i=0; i<n_points; i++) {
+      ResortX(*x[i], batch_x + i*n_full_x_);
+    }
+
+    bool retval = tnlp_->eval_f_g_batch(n_full_x_, n_points, batch_x, f,
+                                        n_full_g_, batch_g);
+    if (retval) {
+      for (Index i=0; i<n_points; i++) {
+        success[i] = true;
+      }
+    }
+    else if (IsValid(thread_pool_)) {
+      TNLPBatchEvalData eval_data;
+      eval_data.tnlp = GetRawPtr(tnlp_);
+      eval_data.n = n_full_x_;
+      eval_data.m = n_full_g_;
+      eval_data.x = batch_x;
+      eval_data.f = f;
+      eval_data.g = batch_g;
+      eval_data.success = success;
+      thread_pool_->Run(TNLPBatchEvalTask, &eval_data, n_points);
+      retval = true;
+    }
+
+    if (retval) {
+      // The TNLP has been evaluated at other points since the last
+      // call of update_local_x, so that the next evaluation has to be
+      // done with new_x=true
+      x_tag_for_iterates_ = 0;
+
+      const Index n_c_no_fixed = P_c_g_->NCols();
+      const Index* c_pos = P_c_g_->ExpandedPosIndices();
+      const Index* d_pos = P_d_g_->ExpandedPosIndices();
+      for (Index i=0; i<n_points; i++) {
+        if (!success[i]) {
+          continue;
+        }
+        const Number* g = batch_g + i*n_full_g_;
+        Number* c_values = static_cast<DenseVector*>(c[i])->Values();
+        DBG_ASSERT(dynamic_cast<DenseVector*>(c[i]));
+        for (Index j=0; j<n_c_no_fixed; j++) {
+          c_values[j] = g[c_pos[j]] - c_rhs_[j];
+        }
+        if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
+          const Number* full_x = batch_x + i*n_full_x_;
+          for (Index j=0; j<n_x_fixed_; j++) {
+            c_values[n_c_no_fixed+j] =
+              full_x[x_fixed_map_[j]] - c_rhs_[n_c_no_fixed+j];
+          }
+        }
+        Number* d_values = static_cast<DenseVector*>(d[i])->Values();
+        DBG_ASSERT(dynamic_cast<DenseVector*>(d[i]));
+        for (Index j=0; j<d[i]->Dim(); j++) {
+          d_values[j] = g[d_pos[j]];
+        }
+      }
+    }
+
+    delete [] batch_x;
+    delete [] batch_g;
+
+    return retval;
+  }
+
+  /** Data for evaluating the derivatives of the TNLP at one point
+   *  concurrently */
+  struct TNLPDerivEvalData
+  {
+    enum Quantity {
+      GRAD_F=0,
+      JAC_G,
+      HESS
+    };
+    TNLP* tnlp;
+    Index n;
+    Index m;
+    const Number* x;
+    Number* grad_f;
+    Index nele_jac;
+    Number* jac_g;
+    Number obj_factor;
+    const Number* lambda;
+    Index nele_hess;
+    Number* h;
+    Quantity quantity[3];
+    bool success[3];
+  };
+
+  /** Evaluate one of the derivatives of the TNLP, called by the
+   *  threads of the thread pool */
+  static void TNLPDerivEvalTask(void* data, Index i)
+  {
+    TNLPDerivEvalData* d = static_cast<TNLPDerivEvalData*>(data);
+    switch (d->quantity[i]) {
+    case TNLPDerivEvalData::GRAD_F:
+      d->success[i] = d->tnlp->eval_grad_f(d->n, d->x, true, d->grad_f);
+      break;
+    case TNLPDerivEvalData::JAC_G:
+      d->success[i] = d->tnlp->eval_jac_g(d->n, d->x, true, d->m,
+                                          d->nele_jac, NULL, NULL,
+                                          d->jac_g);
+      break;
+    case TNLPDerivEvalData::HESS:
+      d->success[i] = d->tnlp->eval_h(d->n, d->x, true, d->obj_factor,
+                                      d->m, d->lambda, true, d->nele_hess,
+                                      NULL, NULL, d->h);
+      break;
+    }
+  }
+
+  bool TNLPAdapter::Eval_derivatives(const Vector& x,
+                                     Vector* g_f,
+                                     Matrix* jac_c,
+                                     Matrix* jac_d,
+                                     Number obj_factor,
+                                     const Vector& yc,
+                                     const Vector& yd,
+                                     SymMatrix* h)
+  {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_derivatives");
+    if (!CanEvalDerivatives() || (h && hessian_approximation_ != EXACT)) {
+      return false;
+    }
+    // If all weights in the Lagrangian are zero, Eval_h does not call
+    // the TNLP
+    bool eval_h = h && (obj_factor!=0. || yc.Asum()!=0. || yd.Asum()!=0.);
+
+    TNLPDerivEvalData eval_data;
+    Index n_tasks = 0;
+    if (g_f) {
+      eval_data.quantity[n_tasks++] = TNLPDerivEvalData::GRAD_F;
+    }
+    if (jac_c || jac_d) {
+      eval_data.quantity[n_tasks++] = TNLPDerivEvalData::JAC_G;
+    }
+    if (eval_h) {
+      eval_data.quantity[n_tasks++] = TNLPDerivEvalData::HESS;
+    }
+    if (n_tasks < 2) {
+      // Nothing to be gained
+      return false;
+    }
+
+    update_local_x(x);
+    if (eval_h) {
+      update_local_lambda(yc, yd);
+    }
+
+    Number* full_grad_f = NULL;
+    Number* full_h = NULL;
+    eval_data.tnlp = GetRawPtr(tnlp_);
+    eval_data.n = n_full_x_;
+    eval_data.m = n_full_g_;
+    eval_data.x = full_x_values_;
+    eval_data.grad_f = NULL;
+    if (g_f) {
+      DBG_ASSERT(dynamic_cast<DenseVector*>(g_f));
+      if (IsValid(P_x_full_x_)) {
+        full_grad_f = new Number[n_full_x_];
+        eval_data.grad_f = full_grad_f;
+      }
+      else {
+        eval_data.grad_f = static_cast<DenseVector*>(g_f)->Values();
+      }
+    }
+    eval_data.nele_jac = nz_full_jac_g_;
+    eval_data.jac_g = jac_g_;
+    eval_data.obj_factor = obj_factor;
+    eval_data.lambda = full_lambda_values_;
+    eval_data.nele_hess = nz_full_h_;
+    eval_data.h = NULL;
+    if (eval_h) {
+      DBG_ASSERT(dynamic_cast<SymTMatrix*>(h));
+      if (h_idx_map_) {
+        full_h = new Number[nz_full_h_];
+        eval_data.h = full_h;
+      }
+      else {
+        eval_data.h = static_cast<SymTMatrix*>(h)->Values();
+      }
+    }
+
+    thread_pool_->Run(TNLPDerivEvalTask, &eval_data, n_tasks);
+
+    bool retval = true;
+    for (Index i=0; i<n_tasks; i++) {
+      retval = retval && eval_data.success[i];
+    }
+    if (jac_c || jac_d) {
+      x_tag_for_jac_g_ = retval ? x_tag_for_iterates_ : 0;
+    }
+
+    if (retval) {
+      if (full_grad_f) {
+        Number* values = static_cast<DenseVector*>(g_f)->Values();
+        const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
+        for (Index i=0; i<g_f->Dim(); i++) {
+          values[i] = full_grad_f[x_pos[i]];
+        }
+      }
+      if (jac_c) {
+        GenTMatrix* gt_jac_c = static_cast<GenTMatrix*>(jac_c);
+        DBG_ASSERT(dynamic_cast<GenTMatrix*>(jac_c));
+        Number* values = gt_jac_c->Values();
+        for (Index i=0; i<nz_jac_c_no_extra_; i++) {
+          values[i] = jac_g_[jac_idx_map_[i]];
+        }
+        if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
+          const Number one = 1.;
+          IpBlasDcopy(n_x_fixed_, &one, 0, &values[nz_jac_c_no_extra_], 1);
+        }
+      }
+      if (jac_d) {
+        GenTMatrix* gt_jac_d = static_cast<GenTMatrix*>(jac_d);
+        DBG_ASSERT(dynamic_cast<GenTMatrix*>(jac_d));
+        Number* values = gt_jac_d->Values();
+        for (Index i=0; i<nz_jac_d_; i++) {
+          values[i] = jac_g_[jac_idx_map_[nz_jac_c_no_extra_ + i]];
+        }
+      }
+      if (full_h) {
+        Number* values = static_cast<SymTMatrix*>(h)->Values();
+        for (Index i=0; i<nz_h_; i++) {
+          values[i] = full_h[h_idx_map_[i]];
+        }
+      }
+      if (h && !eval_h) {
+        retval = Eval_h(x, obj_factor, yc, yd, *h);
+      }
+    }
+
+    delete [] full_grad_f;
+    delete [] full_h;
+
+    return retval;
+  }
+
   bool TNLPAdapter::Eval_jac_d(const Vector& x, Matrix& jac_d)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_jac_d");
     bool new_x = false;
     if (update_local_x(x)) {
       new_x = true;
     }
 
+    if (jac_g_is_jac_d_ && jacobian_approximation_ == JAC_EXACT) {
+      // The Jacobian of g has the same structure as the one of d, so
+      // the TNLP can write the values directly into jac_d
+      GenTMatrix* gt_jac_d = static_cast<GenTMatrix*>(&jac_d);
+      DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_d));
+      return tnlp_->eval_jac_g(n_full_x_, full_x_values_, new_x, n_full_g_,
+                               nz_full_jac_g_, NULL, NULL,
+                               gt_jac_d->Values());
+    }
+
     if (internal_eval_jac_g(new_x)) {
       GenTMatrix* gt_jac_d = static_cast<GenTMatrix*>(&jac_d);
       DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_d));
@@ -1719,6 +2180,17 @@ namespace Ipopt
                            const Vector& yd,
                            SymMatrix& h)
   {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_h");
+    // If only products with the hessian are available, we only
+    // remember the evaluation point.  The TNLP is called when the
+    // matrix is multiplied with a vector (see Eval_h_prod).
+    if (hessian_approximation_==EXACT_PRODUCT) {
+      HessianProductMatrix* hp_h = static_cast<HessianProductMatrix*>(&h);
+      DBG_ASSERT(dynamic_cast<HessianProductMatrix*>(&h));
+      hp_h->SetEvaluationPoint(x, obj_factor, yc, yd);
+      return true;
+    }
+
     // First see if all weights are set to zero (for example, when
     // computing the least square multiplier estimates, this is what
     // we do).  In that case, there is no need to compute values, just
@@ -1750,8 +2222,8 @@ namespace Ipopt
     if (h_idx_map_) {
       Number* full_h = new Number[nz_full_h_];
 
-      if (tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_,
-                        full_lambda_, new_y, nz_full_h_, NULL, NULL, full_h)) {
+      if (tnlp_->eval_h(n_full_x_, full_x_values_, new_x, obj_factor, n_full_g_,
+                        full_lambda_values_, new_y, nz_full_h_, NULL, NULL, full_h)) {
         for (Index i=0; i<nz_h_; i++) {
           values[i] = full_h[h_idx_map_[i]];
         }
@@ -1760,14 +2232,91 @@ namespace Ipopt
       delete [] full_h;
     }
     else {
-      retval = tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_,
-                             full_lambda_, new_y, nz_full_h_, NULL, NULL,
+      retval = tnlp_->eval_h(n_full_x_, full_x_values_, new_x, obj_factor, n_full_g_,
+                             full_lambda_values_, new_y, nz_full_h_, NULL, NULL,
                              values);
     }
 
     return retval;
   }
 
+  bool TNLPAdapter::Eval_h_prod(const Vector& x,
+                                Number obj_factor,
+                                const Vector& yc,
+                                const Vector& yd,
+                                const Vector& v,
+                                Vector& h_v)
+  {
+    IP_TRACE_SCOPE("TNLPAdapter::Eval_h_prod");
+    bool new_x = false;
+    if (update_local_x(x)) {
+      new_x = true;
+    }
+    bool new_y = false;
+    if (update_local_lambda(yc, yd)) {
+      new_y = true;
+    }
+
+    const DenseVector* dv = static_cast<const DenseVector*>(&v);
+    DBG_ASSERT(dynamic_cast<const DenseVector*>(&v));
+    DenseVector* dh_v = static_cast<DenseVector*>(&h_v);
+    DBG_ASSERT(dynamic_cast<DenseVector*>(&h_v));
+    Number* values = dh_v->Values();
+
+    // The full length vectors are kept for the following products
+    if (!h_prod_v_) {
+      h_prod_v_ = new Number[n_full_x_];
+      h_prod_h_v_ = new Number[n_full_x_];
+    }
+    Number* full_v = h_prod_v_;
+
+    bool retval = false;
+    if (IsValid(P_x_full_x_)) {
+      // Fixed variables do not move, so their components in the
+      // direction are zero
+      Number* full_h_v = h_prod_h_v_;
+      const Index* x_pos = P_x_full_x_->CompressedPosIndices();
+      if (dv->IsHomogeneous()) {
+        const Number& scalar = dv->Scalar();
+        for (Index i=0; i<n_full_x_; i++) {
+          full_v[i] = (x_pos[i] != -1) ? scalar : 0.;
+        }
+      }
+      else {
+        const Number* v_values = dv->Values();
+        for (Index i=0; i<n_full_x_; i++) {
+          Index idx = x_pos[i];
+          full_v[i] = (idx != -1) ? v_values[idx] : 0.;
+        }
+      }
+      if (tnlp_->eval_h_prod(n_full_x_, full_x_values_, new_x, obj_factor,
+                             n_full_g_, full_lambda_values_, new_y, full_v,
+                             full_h_v)) {
+        const Index* h_v_pos = P_x_full_x_->ExpandedPosIndices();
+        for (Index i=0; i<h_v.Dim(); i++) {
+          values[i] = full_h_v[h_v_pos[i]];
+        }
+        retval = true;
+      }
+    }
+    else {
+      if (dv->IsHomogeneous()) {
+        const Number& scalar = dv->Scalar();
+        IpBlasDcopy(n_full_x_, &scalar, 0, full_v, 1);
+        retval = tnlp_->eval_h_prod(n_full_x_, full_x_values_, new_x, obj_factor,
+                                    n_full_g_, full_lambda_values_, new_y, full_v,
+                                    values);
+      }
+      else {
+        retval = tnlp_->eval_h_prod(n_full_x_, full_x_values_, new_x, obj_factor,
+                                    n_full_g_, full_lambda_values_, new_y,
+                                    dv->Values(), values);
+      }
+    }
+
+    return retval;
+  }
+
   void TNLPAdapter::GetScalingParameters(
     const SmartPtr<const VectorSpace> x_space,
     const SmartPtr<const VectorSpace> c_space,
@@ -2324,7 +2873,18 @@ namespace Ipopt
       return false;
     }
 
-    ResortX(x, full_x_);
+    const DenseVector* dx = static_cast<const DenseVector*>(&x);
+    DBG_ASSERT(dynamic_cast<const DenseVector*>(&x));
+    if (IsNull(P_x_full_x_) && !dx->IsHomogeneous()) {
+      // No fixed variables have been removed, so the TNLP can work
+      // directly on the values of x.  They stay valid as long as the
+      // tag of x does not change.
+      full_x_values_ = dx->Values();
+    }
+    else {
+      ResortX(x, full_x_);
+      full_x_values_ = full_x_;
+    }
 
     x_tag_for_iterates_ = x.GetTag();
 
@@ -2338,7 +2898,20 @@ namespace Ipopt
       return false;
     }
 
-    ResortG(y_c, y_d, full_lambda_);
+    const DenseVector* dy_c = static_cast<const DenseVector*>(&y_c);
+    DBG_ASSERT(dynamic_cast<const DenseVector*>(&y_c));
+    const DenseVector* dy_d = static_cast<const DenseVector*>(&y_d);
+    DBG_ASSERT(dynamic_cast<const DenseVector*>(&y_d));
+    if (g_is_c_ && !dy_c->IsHomogeneous()) {
+      full_lambda_values_ = dy_c->Values();
+    }
+    else if (g_is_d_ && !dy_d->IsHomogeneous()) {
+      full_lambda_values_ = dy_d->Values();
+    }
+    else {
+      ResortG(y_c, y_d, full_lambda_);
+      full_lambda_values_ = full_lambda_;
+    }
 
     y_c_tag_for_iterates_ = y_c.GetTag();
     y_d_tag_for_iterates_ = y_d.GetTag();
@@ -2355,7 +2928,7 @@ namespace Ipopt
 
     x_tag_for_g_ = x_tag_for_iterates_;
 
-    bool retval = tnlp_->eval_g(n_full_x_, full_x_, new_x, n_full_g_, full_g_);
+    bool retval = tnlp_->eval_g(n_full_x_, full_x_values_, new_x, n_full_g_, full_g_);
 
     if (!retval) {
       x_tag_for_jac_g_ = 0;
@@ -2375,7 +2948,7 @@ namespace Ipopt
 
     bool retval;
     if (jacobian_approximation_ == JAC_EXACT) {
-      retval = tnlp_->eval_jac_g(n_full_x_, full_x_, new_x, n_full_g_,
+      retval = tnlp_->eval_jac_g(n_full_x_, full_x_values_, new_x, n_full_g_,
                                  nz_full_jac_g_, NULL, NULL, jac_g_);
     }
     else {
@@ -2384,13 +2957,13 @@ namespace Ipopt
       if (retval) {
         Number* full_g_pert = new Number[n_full_g_];
         Number* full_x_pert = new Number[n_full_x_];
-        IpBlasDcopy(n_full_x_, full_x_, 1, full_x_pert, 1);
+        IpBlasDcopy(n_full_x_, full_x_values_, 1, full_x_pert, 1);
         // Compute the finite difference Jacobian
         for (Index ivar = 0; ivar<n_full_x_; ivar++) {
           if (findiff_x_l_[ivar] < findiff_x_u_[ivar]) {
             const Number xorig = full_x_pert[ivar];
             Number this_perturbation =
-              findiff_perturbation_*Max(1., fabs(full_x_[ivar]));
+              findiff_perturbation_*Max(1., fabs(full_x_values_[ivar]));
             full_x_pert[ivar] += this_perturbation;
             if (full_x_pert[ivar] > findiff_x_u_[ivar]) {
               full_x_pert[ivar] = xorig - this_perturbation;
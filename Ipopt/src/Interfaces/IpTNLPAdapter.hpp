@@ -12,7 +12,9 @@
 #include "IpNLP.hpp"
 #include "IpTNLP.hpp"
 #include "IpOrigIpoptNLP.hpp"
+#include "IpThreadPool.hpp"
 #include <list>
+#include <vector>
 
 namespace Ipopt
 {
@@ -112,12 +114,49 @@ namespace Ipopt
 
     virtual bool Eval_jac_d(const Vector& x, Matrix& jac_d);
 
+    /** Evaluate f, c, and d at several points.  This uses the
+     *  eval_f_g_batch method of the TNLP if it is implemented, and
+     *  otherwise calls eval_f and eval_g concurrently for the points
+     *  if the option evaluation_threads is larger than 1. */
+    virtual bool Eval_f_c_d_batch(Index n_points,
+                                  const Vector* const* x,
+                                  Number* f,
+                                  Vector* const* c,
+                                  Vector* const* d,
+                                  bool* success);
+
+    /** Evaluate the gradient of f, the Jacobian of g, and the Hessian
+     *  of the Lagrangian concurrently if the option
+     *  evaluation_threads is larger than 1. */
+    virtual bool Eval_derivatives(const Vector& x,
+                                  Vector* g_f,
+                                  Matrix* jac_c,
+                                  Matrix* jac_d,
+                                  Number obj_factor,
+                                  const Vector& yc,
+                                  const Vector& yd,
+                                  SymMatrix* h);
+
+    /** Eval_derivatives can only be used if there are evaluation
+     *  threads and the Jacobian is not approximated */
+    virtual bool CanEvalDerivatives() const
+    {
+      return IsValid(thread_pool_) && jacobian_approximation_ == JAC_EXACT;
+    }
+
     virtual bool Eval_h(const Vector& x,
                         Number obj_factor,
                         const Vector& yc,
                         const Vector& yd,
                         SymMatrix& h);
 
+    virtual bool Eval_h_prod(const Vector& x,
+                             Number obj_factor,
+                             const Vector& yc,
+                             const Vector& yd,
+                             const Vector& v,
+                             Vector& h_v);
+
     virtual void GetScalingParameters(
       const SmartPtr<const VectorSpace> x_space,
       const SmartPtr<const VectorSpace> c_space,
@@ -179,6 +218,23 @@ namespace Ipopt
       JAC_FINDIFF_VALUES
     };
 
+    /** Change the values of parameters of the TNLP for the following
+     *  optimizations with the same structure, until
+     *  ClearParameterValues is called.  The parameters are the
+     *  variables with equal lower and upper bounds when the
+     *  structure was set up, which are removed from the problem (or
+     *  fixed by constraints) according to fixed_variable_treatment.
+     *  param_idx contains the (zero-based) indices of the variables.
+     *  The values replace the bounds returned by get_bounds_info for
+     *  these variables.  Returns false if one of the variables is not
+     *  a parameter; then no value is changed. */
+    bool SetParameterValues(Index n_params, const Index* param_idx,
+                            const Number* param_values);
+
+    /** Forget the values given to SetParameterValues, so that the
+     *  bounds returned by get_bounds_info are used again */
+    void ClearParameterValues();
+
     /** Method for performing the derivative test */
     bool CheckDerivatives(DerivativeTestEnum deriv_test,
                           Index deriv_test_start_index);
@@ -242,6 +298,10 @@ namespace Ipopt
      *  the equality constraint Jacobian */
     SmartPtr<TDependencyDetector> dependency_detector_;
 
+    /** Threads for evaluating the TNLP at several points concurrently,
+     *  NULL if evaluation_threads is 1 */
+    SmartPtr<ThreadPool> thread_pool_;
+
     /**@name Algorithmic parameters */
     //@{
     /** Value for a lower bound that denotes -infinity */
@@ -289,6 +349,9 @@ namespace Ipopt
 
     /** Overall convergence tolerance */
     Number tol_;
+
+    /** Number of threads that evaluate the TNLP concurrently */
+    Index evaluation_threads_;
     //@}
 
     /**@name Problem Size Data */
@@ -314,6 +377,14 @@ namespace Ipopt
     Index n_x_fixed_;
     //@}
 
+    /** @name Parameter values set by SetParameterValues */
+    //@{
+    /** Indices of the variables in the TNLP */
+    std::vector<Index> param_idx_;
+    /** Values of the variables */
+    std::vector<Number> param_values_;
+    //@}
+
     /** Numbering style of variables and constraints */
     TNLP::IndexStyleEnum index_style_;
 
@@ -342,6 +413,34 @@ namespace Ipopt
     Number* full_g_; /** copy of g (c & d) */
     Number* jac_g_; /** the values for the full jacobian of g */
     Number* c_rhs_; /** the rhs values of c */
+    Number* h_prod_v_; /** full length direction for eval_h_prod */
+    Number* h_prod_h_v_; /** full length product from eval_h_prod */
+    //@}
+
+    /**@name Data passed to the TNLP.  If no reordering is required,
+     * these point directly to the values of the DenseVectors given
+     * to update_local_x and update_local_lambda, otherwise to full_x_
+     * and full_lambda_. */
+    //@{
+    const Number* full_x_values_;
+    const Number* full_lambda_values_;
+    //@}
+
+    /**@name Flags indicating that the constraints of the TNLP can be
+     * used as c or d without reordering */
+    //@{
+    /** All constraints are equality constraints (in the original
+     *  order, none removed), so that g and lambda are identical to
+     *  the first n_full_g_ entries of c (plus rhs) and y_c */
+    bool g_is_c_;
+    /** All constraints are inequality constraints (in the original
+     *  order), so that g and lambda are identical to d and y_d */
+    bool g_is_d_;
+    /** The Jacobian of g is identical to the first nz_full_jac_g_
+     *  entries of the Jacobian of c */
+    bool jac_g_is_jac_c_;
+    /** The Jacobian of g is identical to the Jacobian of d */
+    bool jac_g_is_jac_d_;
     //@}
 
     /**@name Tags for deciding when to update internal copies of vectors */
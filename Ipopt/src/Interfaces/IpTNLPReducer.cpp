@@ -425,6 +425,31 @@ namespace Ipopt
     return retval;
   }
 
+  bool
+  TNLPReducer::eval_h_prod(Index n, const Number* x, bool new_x,
+                           Number obj_factor, Index m,
+                           const Number* lambda, bool new_lambda,
+                           const Number* v, Number* h_v)
+  {
+    Number* lambda_orig = new Number[m_orig_];
+    for (Index i=0; i<m_orig_; i++) {
+      Index& new_index = g_keep_map_[i];
+      if (new_index >= 0) {
+        lambda_orig[i] = lambda[new_index];
+      }
+      else {
+        lambda_orig[i] = 0.;
+      }
+    }
+
+    bool retval = tnlp_->eval_h_prod(n, x, new_x, obj_factor, m_orig_,
+                                     lambda_orig, new_lambda, v, h_v);
+
+    delete [] lambda_orig;
+
+    return retval;
+  }
+
   void
   TNLPReducer::finalize_solution(SolverReturn status,
                                  Index n, const Number* x,
@@ -79,6 +79,11 @@ namespace Ipopt
                         bool new_lambda, Index nele_hess,
                         Index* iRow, Index* jCol, Number* values);
 
+    virtual bool eval_h_prod(Index n, const Number* x, bool new_x,
+                             Number obj_factor, Index m,
+                             const Number* lambda, bool new_lambda,
+                             const Number* v, Number* h_v);
+
     virtual void finalize_solution(SolverReturn status,
                                    Index n, const Number* x, const Number* z_L, const Number* z_U,
                                    Index m, const Number* g, const Number* lambda,
@@ -59,6 +59,12 @@ static pardiso_old_t func_pardiso     = NULL;
 static pardiso_new_t func_new_pardiso = NULL;
 static int pardiso_is_parallel = 0;
 
+/* Registration of the termination test callback of the iterative
+   Pardiso solver (only in Pardiso versions that support Ipopt's
+   inexact algorithm) */
+typedef void (*setipoptcallback_t)(int (*IpoptFunction)(int n, double* x, double* r, int k, double b));
+static setipoptcallback_t func_setipoptcallback = NULL;
+
 void wrap_old_pardisoinit(void* PT, const ipfint* MTYPE, const ipfint* SOLVER, ipfint* IPARM, double* DPARM, ipfint* E) {
    if (func_pardisoinit == NULL)
       LSL_lateParadisoLibLoad();
@@ -113,6 +119,13 @@ void F77_FUNC(pardiso,PARDISO)(void** PT, const ipfint* MAXFCT,
    func_new_pardiso(PT, MAXFCT, MNUM, MTYPE, PHASE, N, A, IA, JA, PERM, NRHS, IPARM, MSGLVL, B, X, E, DPARM);
 }
 
+void SetIpoptCallbackFunction(int (*IpoptFunction)(int n, double* x, double* r, int k, double b)) {
+   if (Pardiso_handle == NULL)
+      LSL_lateParadisoLibLoad();
+   assert(func_setipoptcallback != NULL);
+   func_setipoptcallback(IpoptFunction);
+}
+
 #define PARDISOLIBNAME "libpardiso." SHAREDLIBEXT
 
 int LSL_loadPardisoLib(const char* libname, char* msgbuf, int msglen) {
@@ -148,6 +161,9 @@ int LSL_loadPardisoLib(const char* libname, char* msgbuf, int msglen) {
   /* check if we use a parallel version of pardiso */
   pardiso_is_parallel = LSL_loadSym(Pardiso_handle, "pardiso_exist_parallel", msgbuf, msglen) != NULL;
 
+  /* the callback for the iterative solver is optional */
+  func_setipoptcallback=(setipoptcallback_t)LSL_loadSym(Pardiso_handle, "SetIpoptCallbackFunction", msgbuf, msglen);
+
   return 0;
 }
 
@@ -162,6 +178,9 @@ int LSL_unloadPardisoLib() {
 
   func_pardisoinit=NULL;
   func_pardiso=NULL;
+  func_new_pardisoinit=NULL;
+  func_new_pardiso=NULL;
+  func_setipoptcallback=NULL;
 
   return rc;
 }
@@ -182,6 +201,10 @@ void LSL_lateParadisoLibLoad() {
   }
 }
 
+int LSL_hasPardisoIpoptCallback() {
+  return func_setipoptcallback!=NULL;
+}
+
 char* LSL_PardisoLibraryName() {
   static char name[] = PARDISOLIBNAME;
   return name;
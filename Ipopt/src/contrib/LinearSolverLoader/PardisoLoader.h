@@ -32,6 +32,13 @@ extern "C" {
    */
   int LSL_isPardisoLoaded();
 
+  /** Indicates whether the loaded Pardiso library can call back to
+   * Ipopt for the termination tests of its iterative solver, which
+   * the inexact algorithm requires.
+   * @return Zero if not, nonzero if the callback can be set
+   */
+  int LSL_hasPardisoIpoptCallback();
+
   /** Returns name of the shared library that should contain Pardiso */
   char* LSL_PardisoLibraryName();
 #ifdef __cplusplus
@@ -0,0 +1,99 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Benchmark for the AMPL interface.  It times reading an .nl file
+// into an AmplTNLP (which includes the Hessian setup in ASL), and
+// evaluating the objective, constraints, Jacobian and Hessian at the
+// same point, in the order in which Ipopt requests them during one
+// iteration.  The name of the .nl file can be given as first
+// argument; by default, mytoy.nl in the current directory is used.
+
+#include "AmplTNLP.hpp"
+#include "IpIpoptApplication.hpp"
+#include "IpUtils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Ipopt;
+
+int main(int argc, char* argv[])
+{
+  char nl_file_default[] = "mytoy.nl";
+  char* nl_file = argc > 1 ? argv[1] : nl_file_default;
+  Index n_reps = 10000;
+  if (argc > 2) {
+    n_reps = atoi(argv[2]);
+  }
+
+  SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+  app->Options()->SetIntegerValue("print_level", 0);
+  app->Initialize("");
+
+  // Reading the .nl file
+  const Index n_reads = 100;
+  Number start = WallclockTime();
+  for (Index i=0; i<n_reads; i++) {
+    char* args[] = {argv[0], nl_file, NULL};
+    char** argsp = args;
+    SmartPtr<TNLP> read_tnlp = new AmplTNLP(ConstPtr(app->Jnlst()),
+                                            app->Options(), argsp);
+  }
+  Number time_read = WallclockTime() - start;
+
+  char* args[] = {argv[0], nl_file, NULL};
+  char** argsp = args;
+  SmartPtr<TNLP> tnlp = new AmplTNLP(ConstPtr(app->Jnlst()),
+                                     app->Options(), argsp);
+
+  Index n, m, nnz_jac_g, nnz_h_lag;
+  TNLP::IndexStyleEnum index_style;
+  tnlp->get_nlp_info(n, m, nnz_jac_g, nnz_h_lag, index_style);
+
+  Number* x = new Number[n];
+  Number* grad_f = new Number[n];
+  Number* g = new Number[m];
+  Number* lambda = new Number[m];
+  Number* jac_g = new Number[nnz_jac_g];
+  Number* h = new Number[nnz_h_lag];
+  tnlp->get_starting_point(n, true, x, false, NULL, NULL, m, false, NULL);
+  for (Index j=0; j<m; j++) {
+    lambda[j] = 1.;
+  }
+
+  // Evaluations at the same point, as in one iteration of Ipopt
+  Number sum = 0.;
+  Number obj;
+  start = WallclockTime();
+  for (Index i=0; i<n_reps; i++) {
+    // Change the point so that ASL has to evaluate again
+    x[0] += 1e-10;
+    tnlp->eval_f(n, x, true, obj);
+    tnlp->eval_grad_f(n, x, false, grad_f);
+    tnlp->eval_g(n, x, false, m, g);
+    tnlp->eval_jac_g(n, x, false, m, nnz_jac_g, NULL, NULL, jac_g);
+    tnlp->eval_h(n, x, false, 1., m, lambda, true, nnz_h_lag, NULL, NULL, h);
+    sum += obj;
+  }
+  Number time_eval = WallclockTime() - start;
+
+  printf("AMPL interface for %s (n = %d, m = %d):\n", nl_file, n, m);
+  printf("  reading the .nl file:          %10.1f us\n",
+         1e6*time_read/n_reads);
+  printf("  f, grad_f, g, jac_g and h:     %10.1f us\n",
+         1e6*time_eval/n_reps);
+  // Print the sum so that the loop is not optimized away
+  printf("  (checksum %g)\n", sum);
+
+  delete [] x;
+  delete [] grad_f;
+  delete [] g;
+  delete [] lambda;
+  delete [] jac_g;
+  delete [] h;
+
+  return 0;
+}
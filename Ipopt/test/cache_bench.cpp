@@ -0,0 +1,103 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Micro-benchmark for the lookups in CachedResults.  The dependencies
+// are vectors of the size of hs071, and the queries have the forms
+// used by IpoptCalculatedQuantities: a cache hit with two vector
+// dependencies, and a query with two vectors and one number (like
+// the barrier error, which depends on mu), once with std::vectors and
+// once with the array-based methods.  In the latter two, one of the
+// vectors changes every 20 queries, so that the cache also has to
+// find older entries and add new ones.
+
+#include "IpCachedResults.hpp"
+#include "IpDenseVector.hpp"
+#include "IpUtils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Ipopt;
+
+int main(int argc, char* argv[])
+{
+  Index n_lookups = 10000000;
+  if (argc > 1) {
+    n_lookups = atoi(argv[1]);
+  }
+
+  SmartPtr<DenseVectorSpace> space = new DenseVectorSpace(4);
+  SmartPtr<DenseVector> x = space->MakeNewDenseVector();
+  SmartPtr<DenseVector> y = space->MakeNewDenseVector();
+  x->Set(1.);
+  y->Set(2.);
+
+  Number sum = 0.;
+  Number result;
+
+  // Cache hit with two dependencies
+  CachedResults<Number> cache_2dep(2);
+  cache_2dep.AddCachedResult2Dep(1., GetRawPtr(x), GetRawPtr(y));
+  Number start = WallclockTime();
+  for (Index i=0; i<n_lookups; i++) {
+    if (cache_2dep.GetCachedResult2Dep(result, GetRawPtr(x), GetRawPtr(y))) {
+      sum += result;
+    }
+  }
+  Number time_2dep = WallclockTime() - start;
+
+  // Two vectors and one number given as std::vectors
+  CachedResults<Number> cache_vector(2);
+  std::vector<const TaggedObject*> deps(2);
+  std::vector<Number> sdeps(1);
+  sdeps[0] = 0.1;
+  start = WallclockTime();
+  for (Index i=0; i<n_lookups; i++) {
+    if (i % 20 == 0) {
+      x->Set((Number)i);
+    }
+    deps[0] = GetRawPtr(x);
+    deps[1] = GetRawPtr(y);
+    if (!cache_vector.GetCachedResult(result, deps, sdeps)) {
+      result = (Number)i;
+      cache_vector.AddCachedResult(result, deps, sdeps);
+    }
+    sum += result;
+  }
+  Number time_vector = WallclockTime() - start;
+
+  // The same with the array-based methods
+  CachedResults<Number> cache_array(2);
+  const TaggedObject* adeps[2];
+  Number asdep = 0.1;
+  start = WallclockTime();
+  for (Index i=0; i<n_lookups; i++) {
+    if (i % 20 == 0) {
+      x->Set((Number)i);
+    }
+    adeps[0] = GetRawPtr(x);
+    adeps[1] = GetRawPtr(y);
+    if (!cache_array.GetCachedResult(result, 2, adeps, 1, &asdep)) {
+      result = (Number)i;
+      cache_array.AddCachedResult(result, 2, adeps, 1, &asdep);
+    }
+    sum += result;
+  }
+  Number time_array = WallclockTime() - start;
+
+  printf("CachedResults lookups (%d each):\n", n_lookups);
+  printf("  hit with 2 dependencies:       %7.1f ns\n",
+         1e9*time_2dep/n_lookups);
+  printf("  2 tags + 1 number, std::vector: %7.1f ns\n",
+         1e9*time_vector/n_lookups);
+  printf("  2 tags + 1 number, arrays:      %7.1f ns\n",
+         1e9*time_array/n_lookups);
+  // Print the sum so that the loops are not optimized away
+  printf("  (checksum %g)\n", sum);
+
+  return 0;
+}
@@ -0,0 +1,185 @@
+/* Copyright (C) 2026 International Business Machines and others.
+ * All Rights Reserved.
+ * This code is published under the Eclipse Public License.
+ *
+ * $Id$
+ */
+
+/* Test for re-solves with the C interface.  The problem
+ *
+ *     min (x_0 - a)^2 + (x_1 + 1)^2
+ *
+ * is solved with IpoptSolve without an intermediate callback, and
+ * then again with IpoptReOptimize for other values of a in user_data.
+ * The intermediate callbacks set between the solves have to be used
+ * by the following re-solve. */
+
+#include "IpStdCInterface.h"
+#include <math.h>
+#include <stdio.h>
+
+/* Data of the problem and of the callbacks */
+struct TestData
+{
+  Number a;          /* Parameter of the objective */
+  Index n_callbacks; /* Number of calls of the intermediate callback */
+};
+
+static Bool eval_f(Index n, Number* x, Bool new_x,
+                   Number* obj_value, UserDataPtr user_data)
+{
+  struct TestData* data = (struct TestData*) user_data;
+  *obj_value = (x[0] - data->a)*(x[0] - data->a) + (x[1] + 1.)*(x[1] + 1.);
+  return TRUE;
+}
+
+static Bool eval_grad_f(Index n, Number* x, Bool new_x,
+                        Number* grad_f, UserDataPtr user_data)
+{
+  struct TestData* data = (struct TestData*) user_data;
+  grad_f[0] = 2.*(x[0] - data->a);
+  grad_f[1] = 2.*(x[1] + 1.);
+  return TRUE;
+}
+
+static Bool eval_g(Index n, Number* x, Bool new_x,
+                   Index m, Number* g, UserDataPtr user_data)
+{
+  return TRUE;
+}
+
+static Bool eval_jac_g(Index n, Number *x, Bool new_x,
+                       Index m, Index nele_jac,
+                       Index *iRow, Index *jCol, Number *values,
+                       UserDataPtr user_data)
+{
+  return TRUE;
+}
+
+static Bool eval_h(Index n, Number *x, Bool new_x, Number obj_factor,
+                   Index m, Number *lambda, Bool new_lambda,
+                   Index nele_hess, Index *iRow, Index *jCol,
+                   Number *values, UserDataPtr user_data)
+{
+  if (values == NULL) {
+    iRow[0] = 0;
+    jCol[0] = 0;
+    iRow[1] = 1;
+    jCol[1] = 1;
+  }
+  else {
+    values[0] = 2.*obj_factor;
+    values[1] = 2.*obj_factor;
+  }
+  return TRUE;
+}
+
+/* Intermediate callback that counts its calls */
+static Bool count_cb(Index alg_mod, Index iter_count, Number obj_value,
+                     Number inf_pr, Number inf_du, Number mu, Number d_norm,
+                     Number regularization_size, Number alpha_du,
+                     Number alpha_pr, Index ls_trials, UserDataPtr user_data)
+{
+  struct TestData* data = (struct TestData*) user_data;
+  data->n_callbacks++;
+  return TRUE;
+}
+
+/* Intermediate callback that stops the optimization */
+static Bool stop_cb(Index alg_mod, Index iter_count, Number obj_value,
+                    Number inf_pr, Number inf_du, Number mu, Number d_norm,
+                    Number regularization_size, Number alpha_du,
+                    Number alpha_pr, Index ls_trials, UserDataPtr user_data)
+{
+  return FALSE;
+}
+
+/* Check the return status and the solution of the last solve */
+static int check(const char* name, enum ApplicationReturnStatus status,
+                 enum ApplicationReturnStatus expected_status,
+                 const Number* x, const struct TestData* data)
+{
+  if (status != expected_status) {
+    printf("%s: return status is %d instead of %d.\n", name, status,
+           expected_status);
+    return 0;
+  }
+  if (status == Solve_Succeeded &&
+      (fabs(x[0] - data->a) > 1e-6 || fabs(x[1] + 1.) > 1e-6)) {
+    printf("%s: solution is (%g, %g) instead of (%g, -1).\n", name, x[0],
+           x[1], data->a);
+    return 0;
+  }
+  return 1;
+}
+
+int main()
+{
+  Number x_L[2] = {-10., -10.};
+  Number x_U[2] = {10., 10.};
+  Number x[2];
+  Number obj;
+  IpoptProblem nlp;
+  enum ApplicationReturnStatus status;
+  struct TestData data;
+  int failed = 0;
+
+  nlp = CreateIpoptProblem(2, x_L, x_U, 0, NULL, NULL, 0, 2, 0,
+                           &eval_f, &eval_g, &eval_grad_f,
+                           &eval_jac_g, &eval_h);
+  if (nlp == NULL) {
+    printf("CreateIpoptProblem failed.\n");
+    return 1;
+  }
+  AddIpoptIntOption(nlp, "print_level", 0);
+
+  /* First solve without an intermediate callback */
+  data.a = 1.;
+  data.n_callbacks = 0;
+  x[0] = x[1] = 0.;
+  status = IpoptSolve(nlp, x, NULL, &obj, NULL, NULL, NULL, &data);
+  if (!check("First solve", status, Solve_Succeeded, x, &data)) {
+    FreeIpoptProblem(nlp);
+    printf("C interface re-solve test FAILED.\n");
+    return 1;
+  }
+
+  /* Re-solve with a callback that is set after the first solve */
+  SetIntermediateCallback(nlp, &count_cb);
+  data.a = 3.;
+  status = IpoptReOptimize(nlp, x, NULL, &obj, NULL, NULL, NULL, &data);
+  if (!check("Re-solve with callback", status, Solve_Succeeded, x, &data)) {
+    failed = 1;
+  }
+  else if (data.n_callbacks == 0) {
+    printf("Re-solve with callback: the callback was not called.\n");
+    failed = 1;
+  }
+
+  /* Re-solve with a callback that stops */
+  SetIntermediateCallback(nlp, &stop_cb);
+  data.a = 2.;
+  status = IpoptReOptimize(nlp, x, NULL, &obj, NULL, NULL, NULL, &data);
+  if (!check("Re-solve with stopping callback", status, User_Requested_Stop,
+             x, &data)) {
+    failed = 1;
+  }
+
+  /* Re-solve without a callback */
+  SetIntermediateCallback(nlp, NULL);
+  data.n_callbacks = 0;
+  status = IpoptReOptimize(nlp, x, NULL, &obj, NULL, NULL, NULL, &data);
+  if (!check("Re-solve without callback", status, Solve_Succeeded, x,
+             &data)) {
+    failed = 1;
+  }
+
+  FreeIpoptProblem(nlp);
+
+  if (failed) {
+    printf("C interface re-solve test FAILED.\n");
+    return 1;
+  }
+  printf("C interface re-solve test passed.\n");
+  return 0;
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Micro-benchmark for the acceptability check of the 2-dimensional
+// filter.  The filter entries lie on a front (none dominates another)
+// of N entries, and the queries are points just above that front,
+// so that all entries have to be looked at by a search through the
+// list of FilterEntry objects.  This is compared with Filter, which
+// uses a binary search for the 2-dimensional case.
+
+#include "IpFilter.hpp"
+#include "IpUtils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+using namespace Ipopt;
+
+int main(int argc, char* argv[])
+{
+  Index n_queries_total = 20000000;
+  if (argc > 1) {
+    n_queries_total = atoi(argv[1]);
+  }
+
+  printf("Acceptability checks of the 2-dimensional filter:\n");
+  printf("      N    Filter (ns)    FilterEntry list (ns)\n");
+
+  std::vector<Number> vals(2);
+  Index n_accepted = 0;
+  for (Index N=10; N<=10000; N*=10) {
+    Filter filter(2);
+    std::list<FilterEntry*> entries;
+    for (Index i=0; i<N; i++) {
+      vals[0] = (i+1.)/N;
+      vals[1] = 1./vals[0];
+      filter.AddEntry(vals, i);
+      entries.push_back(new FilterEntry(vals, i));
+    }
+
+    Index n_queries = n_queries_total/N;
+    if (n_queries < 1000) {
+      n_queries = 1000;
+    }
+
+    Number start = WallclockTime();
+    for (Index q=0; q<n_queries; q++) {
+      vals[0] = (q%N + 0.5)/N;
+      vals[1] = 1.0001/vals[0];
+      if (filter.Acceptable(vals)) {
+        n_accepted++;
+      }
+    }
+    Number time_filter = WallclockTime() - start;
+
+    start = WallclockTime();
+    for (Index q=0; q<n_queries; q++) {
+      vals[0] = (q%N + 0.5)/N;
+      vals[1] = 1.0001/vals[0];
+      bool acceptable = true;
+      std::list<FilterEntry*>::const_iterator iter;
+      for (iter = entries.begin(); iter != entries.end(); iter++) {
+        if (!(*iter)->Acceptable(vals)) {
+          acceptable = false;
+          break;
+        }
+      }
+      if (acceptable) {
+        n_accepted++;
+      }
+    }
+    Number time_list = WallclockTime() - start;
+
+    printf("  %5d  %13.1f  %23.1f\n", N, 1e9*time_filter/n_queries,
+           1e9*time_list/n_queries);
+
+    while (!entries.empty()) {
+      delete entries.back();
+      entries.pop_back();
+    }
+  }
+  // Print the count so that the loops are not optimized away
+  printf("  (%d points accepted)\n", n_accepted);
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Test for the 2-dimensional filter.  The filter keeps only the
+// entries that are not dominated, in a sorted vector, and answers
+// queries by a binary search.  This test compares its answers with a
+// plain list of FilterEntry objects, which is what the filter used
+// for every dimension before, for random entries and queries.  The
+// values are taken from a coarse grid, so that many of them are
+// equal to the coordinates of an entry.
+
+#include "IpFilter.hpp"
+
+#include <cstdio>
+#include <list>
+#include <vector>
+
+using namespace Ipopt;
+
+/** Filter with a list of all FilterEntry objects, used as reference */
+class ListFilter
+{
+public:
+  ~ListFilter()
+  {
+    Clear();
+  }
+
+  bool Acceptable(const std::vector<Number>& vals) const
+  {
+    std::list<FilterEntry*>::const_iterator iter;
+    for (iter = entries_.begin(); iter != entries_.end(); iter++) {
+      if (!(*iter)->Acceptable(vals)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void AddEntry(const std::vector<Number>& vals, Index iteration)
+  {
+    std::list<FilterEntry*>::iterator iter = entries_.begin();
+    while (iter != entries_.end()) {
+      if ((*iter)->Dominated(vals)) {
+        delete *iter;
+        iter = entries_.erase(iter);
+      }
+      else {
+        iter++;
+      }
+    }
+    entries_.push_back(new FilterEntry(vals, iteration));
+  }
+
+  void Clear()
+  {
+    while (!entries_.empty()) {
+      delete entries_.back();
+      entries_.pop_back();
+    }
+  }
+
+private:
+  std::list<FilterEntry*> entries_;
+};
+
+/** Simple linear congruential generator, so that the test does the
+ *  same on every platform */
+static unsigned long seed = 1;
+
+static Number RandomGridValue()
+{
+  seed = (seed*1103515245UL + 12345UL) % 2147483648UL;
+  // values 0, 0.1, ..., 4.9
+  return (Number)((seed >> 16) % 50)/10.;
+}
+
+int main()
+{
+  const Index n_runs = 100;
+  const Index n_iters = 300;
+  const Index n_queries = 10;
+
+  Index n_mismatches = 0;
+  Index n_checks = 0;
+  std::vector<Number> vals(2);
+  for (Index run=0; run<n_runs; run++) {
+    Filter filter(2);
+    ListFilter reference;
+    for (Index k=0; k<n_iters; k++) {
+      if (RandomGridValue() < 2.5) {
+        vals[0] = RandomGridValue();
+        vals[1] = RandomGridValue();
+        filter.AddEntry(vals, k);
+        reference.AddEntry(vals, k);
+      }
+      for (Index q=0; q<n_queries; q++) {
+        vals[0] = RandomGridValue();
+        vals[1] = RandomGridValue();
+        bool expected = reference.Acceptable(vals);
+        if (filter.Acceptable(vals) != expected ||
+            filter.Acceptable(vals[0], vals[1]) != expected) {
+          n_mismatches++;
+        }
+        n_checks++;
+      }
+    }
+    // after clearing, every point is acceptable again
+    filter.Clear();
+    if (!filter.Acceptable(0., 0.)) {
+      n_mismatches++;
+    }
+  }
+
+  if (n_mismatches > 0) {
+    printf("Filter test FAILED: %d of %d queries differ from the reference.\n",
+           n_mismatches, n_checks);
+    return 1;
+  }
+  printf("Filter test passed (%d queries).\n", n_checks);
+  return 0;
+}
@@ -0,0 +1,217 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Test for parametric re-solves.  The problem is
+//
+//     min (x_0 - x_1)^2   s.t.  x_1 = p,
+//
+// where x_1 is fixed by its bounds, so that it is a parameter and the
+// solution is x_0 = p.  The problem is solved, re-solved with a new
+// parameter value, and re-solved without parameter values.  The last
+// re-solve has to use the bounds from get_bounds_info again, also
+// after they have been changed in the TNLP.
+
+#include "IpIpoptApplication.hpp"
+#include "IpTNLP.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace Ipopt;
+
+/** The problem above, which returns its final point as the starting
+ *  point of the next optimization */
+class ParamNLP : public TNLP
+{
+public:
+  ParamNLP(Number p)
+      :
+      p_(p),
+      final_x0(0.)
+  {
+    x_[0] = 0.;
+    x_[1] = p;
+    z_L_[0] = z_L_[1] = 0.;
+    z_U_[0] = z_U_[1] = 0.;
+  }
+
+  virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
+                            Index& nnz_h_lag, IndexStyleEnum& index_style)
+  {
+    n = 2;
+    m = 0;
+    nnz_jac_g = 0;
+    nnz_h_lag = 3;
+    index_style = C_STYLE;
+    return true;
+  }
+
+  virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u,
+                               Index m, Number* g_l, Number* g_u)
+  {
+    x_l[0] = -1e19;
+    x_u[0] = 1e19;
+    x_l[1] = x_u[1] = p_;
+    return true;
+  }
+
+  virtual bool get_starting_point(Index n, bool init_x, Number* x,
+                                  bool init_z, Number* z_L, Number* z_U,
+                                  Index m, bool init_lambda,
+                                  Number* lambda)
+  {
+    for (Index i=0; i<n; i++) {
+      if (init_x) {
+        x[i] = x_[i];
+      }
+      if (init_z) {
+        z_L[i] = z_L_[i];
+        z_U[i] = z_U_[i];
+      }
+    }
+    return true;
+  }
+
+  virtual bool eval_f(Index n, const Number* x, bool new_x,
+                      Number& obj_value)
+  {
+    obj_value = (x[0] - x[1])*(x[0] - x[1]);
+    return true;
+  }
+
+  virtual bool eval_grad_f(Index n, const Number* x, bool new_x,
+                           Number* grad_f)
+  {
+    grad_f[0] = 2.*(x[0] - x[1]);
+    grad_f[1] = -2.*(x[0] - x[1]);
+    return true;
+  }
+
+  virtual bool eval_g(Index n, const Number* x, bool new_x,
+                      Index m, Number* g)
+  {
+    return true;
+  }
+
+  virtual bool eval_jac_g(Index n, const Number* x, bool new_x,
+                          Index m, Index nele_jac, Index* iRow,
+                          Index *jCol, Number* values)
+  {
+    return true;
+  }
+
+  virtual bool eval_h(Index n, const Number* x, bool new_x,
+                      Number obj_factor, Index m, const Number* lambda,
+                      bool new_lambda, Index nele_hess, Index* iRow,
+                      Index* jCol, Number* values)
+  {
+    if (values == NULL) {
+      iRow[0] = 0;
+      jCol[0] = 0;
+      iRow[1] = 1;
+      jCol[1] = 0;
+      iRow[2] = 1;
+      jCol[2] = 1;
+    }
+    else {
+      values[0] = 2.*obj_factor;
+      values[1] = -2.*obj_factor;
+      values[2] = 2.*obj_factor;
+    }
+    return true;
+  }
+
+  virtual void finalize_solution(SolverReturn status,
+                                 Index n, const Number* x, const Number* z_L, const Number* z_U,
+                                 Index m, const Number* g, const Number* lambda,
+                                 Number obj_value,
+                                 const IpoptData* ip_data,
+                                 IpoptCalculatedQuantities* ip_cq)
+  {
+    for (Index i=0; i<n; i++) {
+      x_[i] = x[i];
+      z_L_[i] = z_L[i];
+      z_U_[i] = z_U[i];
+    }
+    final_x0 = x[0];
+  }
+
+  /** Value of the parameter in get_bounds_info */
+  Number p_;
+
+  /** Solution of the last optimization */
+  Number final_x0;
+
+private:
+  /** Final point of the last optimization */
+  Number x_[2];
+  Number z_L_[2];
+  Number z_U_[2];
+};
+
+/** Check that the last optimization succeeded with the solution
+ *  x_0 = p */
+static bool Check(const char* name, ApplicationReturnStatus status,
+                  const ParamNLP& nlp, Number p)
+{
+  if (status != Solve_Succeeded) {
+    printf("%s: return status is %d.\n", name, status);
+    return false;
+  }
+  if (fabs(nlp.final_x0 - p) > 1e-6) {
+    printf("%s: x_0 is %g instead of %g.\n", name, nlp.final_x0, p);
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  SmartPtr<ParamNLP> nlp = new ParamNLP(1.);
+
+  SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+  app->Options()->SetIntegerValue("print_level", 0);
+  ApplicationReturnStatus status = app->Initialize();
+  if (status != Solve_Succeeded) {
+    printf("Error during initialization!\n");
+    return 1;
+  }
+
+  status = app->OptimizeTNLP(GetRawPtr(nlp));
+  if (!Check("First optimization", status, *nlp, 1.)) {
+    printf("Parametric re-solve test FAILED.\n");
+    return 1;
+  }
+
+  app->Options()->SetStringValue("warm_start_same_structure", "yes");
+  app->Options()->SetStringValue("warm_start_init_point", "yes");
+
+  bool failed = false;
+  const Index param_idx = 1;
+  const Number param_value = 3.;
+  status = app->ReOptimizeTNLP(GetRawPtr(nlp), 1, &param_idx, &param_value);
+  if (!Check("Re-solve with parameter", status, *nlp, param_value)) {
+    failed = true;
+  }
+
+  status = app->ReOptimizeTNLP(GetRawPtr(nlp));
+  if (!Check("Re-solve without parameter", status, *nlp, 1.)) {
+    failed = true;
+  }
+
+  nlp->p_ = 2.;
+  status = app->ReOptimizeTNLP(GetRawPtr(nlp));
+  if (!Check("Re-solve with changed bounds", status, *nlp, 2.)) {
+    failed = true;
+  }
+
+  if (failed) {
+    printf("Parametric re-solve test FAILED.\n");
+    return 1;
+  }
+  printf("Parametric re-solve test passed.\n");
+  return 0;
+}
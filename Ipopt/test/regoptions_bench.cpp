@@ -0,0 +1,86 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Micro-benchmark for the creation of IpoptApplication objects.  It
+// compares registering all Ipopt options into a new RegisteredOptions
+// object, which every application did before the registered options
+// were shared, with creating and initializing an application that
+// uses the shared registered options, and with taking a private copy
+// of them (as RegOptions() does for callers that add options).  It
+// also compares getting an option value by its tag with getting it by
+// an option handle.
+
+#include "IpIpoptApplication.hpp"
+#include "IpUtils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Ipopt;
+
+int main(int argc, char* argv[])
+{
+  Index n_reps = 1000;
+  if (argc > 1) {
+    n_reps = atoi(argv[1]);
+  }
+
+  Number start = WallclockTime();
+  for (Index i=0; i<n_reps; i++) {
+    SmartPtr<RegisteredOptions> roptions = new RegisteredOptions();
+    IpoptApplication::RegisterAllIpoptOptions(roptions);
+  }
+  Number time_register = WallclockTime() - start;
+
+  start = WallclockTime();
+  for (Index i=0; i<n_reps; i++) {
+    SmartPtr<IpoptApplication> app = new IpoptApplication(false);
+    app->Options()->SetIntegerValue("print_level", 0);
+    app->Initialize("");
+  }
+  Number time_app = WallclockTime() - start;
+
+  start = WallclockTime();
+  for (Index i=0; i<n_reps; i++) {
+    SmartPtr<IpoptApplication> app = new IpoptApplication(false);
+    app->RegOptions();
+  }
+  Number time_copy = WallclockTime() - start;
+
+  SmartPtr<IpoptApplication> app = new IpoptApplication(false);
+  app->Options()->SetNumericValue("tol", 1e-7);
+  const OptionsList& options = *app->Options();
+  const Index n_lookups = 1000*n_reps;
+  Number value;
+
+  start = WallclockTime();
+  for (Index i=0; i<n_lookups; i++) {
+    options.GetNumericValue("tol", value, "resto.");
+  }
+  Number time_tag = WallclockTime() - start;
+
+  OptionsList::OptionHandle handle = options.GetOptionHandle("tol", "resto.");
+  start = WallclockTime();
+  for (Index i=0; i<n_lookups; i++) {
+    options.GetNumericValue(handle, value);
+  }
+  Number time_handle = WallclockTime() - start;
+
+  printf("Creating applications (%d each):\n", n_reps);
+  printf("  registering all options:           %8.1f us\n",
+         1e6*time_register/n_reps);
+  printf("  application with shared options:   %8.1f us\n",
+         1e6*time_app/n_reps);
+  printf("  application with private copy:     %8.1f us\n",
+         1e6*time_copy/n_reps);
+  printf("Getting an option value (%d each):\n", n_lookups);
+  printf("  by tag:                            %8.1f ns\n",
+         1e9*time_tag/n_lookups);
+  printf("  by option handle:                  %8.1f ns\n",
+         1e9*time_handle/n_lookups);
+
+  return 0;
+}
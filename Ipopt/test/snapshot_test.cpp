@@ -0,0 +1,227 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Test for warm start snapshots.  A snapshot is filled with an
+// iterate, a perturbation history, and a limited-memory history, and
+// written as text.  Reading the text has to give the same values, and
+// writing the read snapshot has to give the same text.  A snapshot
+// that is cut off must not be accepted.
+
+#include "IpWarmStartSnapshot.hpp"
+#include "IpDenseVector.hpp"
+#include "IpMultiVectorMatrix.hpp"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace Ipopt;
+
+/** Number of components of an iterate */
+static const Index n_comps = 8;
+
+/** Dimensions of the components of the iterates (x, s, y_c, y_d,
+ *  z_L, z_U, v_L, v_U) */
+static const Index comp_dims[n_comps] = {3, 2, 1, 2, 2, 1, 0, 2};
+
+/** Number of pairs and dimension of the limited-memory history */
+static const Index lm_length = 2;
+static const Index lm_dim = 3;
+
+/** Value that is not exactly representable in the text, so that the
+ *  precision of the output is tested */
+static Number TestValue(Index i, Index j)
+{
+  return (i + 1.)/3. + (j + 1.)*1e-7;
+}
+
+static SmartPtr<IteratesVector> MakeIterates()
+{
+  SmartPtr<DenseVectorSpace> spaces[n_comps];
+  for (Index i=0; i<n_comps; i++) {
+    spaces[i] = new DenseVectorSpace(comp_dims[i]);
+  }
+  SmartPtr<IteratesVectorSpace> it_space =
+    new IteratesVectorSpace(*spaces[0], *spaces[1], *spaces[2], *spaces[3],
+                            *spaces[4], *spaces[5], *spaces[6], *spaces[7]);
+  return it_space->MakeNewIteratesVector(true);
+}
+
+/** Compare the values of a vector with TestValue(i, .) */
+static bool HasTestValues(const Vector& vec, Index i)
+{
+  const DenseVector* dvec = static_cast<const DenseVector*>(&vec);
+  if (dvec->Dim() == 0) {
+    return true;
+  }
+  if (dvec->IsHomogeneous()) {
+    return false;
+  }
+  const Number* values = dvec->Values();
+  for (Index j=0; j<dvec->Dim(); j++) {
+    if (values[j] != TestValue(i, j)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  Index n_errors = 0;
+
+  // Fill a snapshot
+  SmartPtr<IteratesVector> iterates = MakeIterates();
+  for (Index i=0; i<n_comps; i++) {
+    DenseVector* comp =
+      static_cast<DenseVector*>(GetRawPtr(iterates->GetCompNonConst(i)));
+    Number* values = comp->Values();
+    for (Index j=0; j<comp_dims[i]; j++) {
+      values[j] = TestValue(i, j);
+    }
+  }
+  SmartPtr<WarmStartSnapshot> snapshot = new WarmStartSnapshot();
+  snapshot->TakeFrom(*iterates, 1e-3/3., 0.99);
+
+  PDPertHistory pd_pert;
+  pd_pert.valid = true;
+  pd_pert.delta_x_last = 1e-4/3.;
+  pd_pert.delta_s_last = 2e-4/3.;
+  pd_pert.delta_c_last = 1e-9;
+  pd_pert.delta_d_last = 2e-9;
+  pd_pert.hess_degenerate = 1;
+  pd_pert.jac_degenerate = 2;
+  pd_pert.degen_iters = -1;
+  snapshot->SetPDPertState(pd_pert);
+
+  SmartPtr<DenseVectorSpace> lm_space = new DenseVectorSpace(lm_dim);
+  SmartPtr<MultiVectorMatrixSpace> lm_mat_space =
+    new MultiVectorMatrixSpace(lm_length, *lm_space);
+  SmartPtr<MultiVectorMatrix> S = lm_mat_space->MakeNewMultiVectorMatrix();
+  SmartPtr<MultiVectorMatrix> Y = lm_mat_space->MakeNewMultiVectorMatrix();
+  for (Index i=0; i<lm_length; i++) {
+    SmartPtr<DenseVector> s = lm_space->MakeNewDenseVector();
+    SmartPtr<DenseVector> y = lm_space->MakeNewDenseVector();
+    for (Index j=0; j<lm_dim; j++) {
+      s->Values()[j] = TestValue(i, j);
+      y->Values()[j] = TestValue(i + lm_length, j);
+    }
+    S->SetVector(i, *s);
+    Y->SetVector(i, *y);
+  }
+  snapshot->SetLimMemHistory(*S, *Y, 5./3.);
+
+  // Write and read it
+  std::ostringstream os;
+  if (!snapshot->Write(os)) {
+    printf("Writing the snapshot failed.\n");
+    return 1;
+  }
+  std::string text = os.str();
+
+  SmartPtr<WarmStartSnapshot> read_snapshot = new WarmStartSnapshot();
+  std::istringstream is(text);
+  if (!read_snapshot->Read(is)) {
+    printf("Reading the snapshot failed.\n");
+    return 1;
+  }
+
+  // Compare the values
+  SmartPtr<IteratesVector> read_iterates = MakeIterates();
+  if (!read_snapshot->PutInto(*read_iterates)) {
+    printf("PutInto failed for the read snapshot.\n");
+    n_errors++;
+  }
+  else {
+    for (Index i=0; i<n_comps; i++) {
+      if (!HasTestValues(*read_iterates->GetComp(i), i)) {
+        printf("Component %d of the iterate differs.\n", i);
+        n_errors++;
+      }
+    }
+  }
+  if (read_snapshot->mu() != snapshot->mu() ||
+      read_snapshot->tau() != snapshot->tau()) {
+    printf("mu or tau differ.\n");
+    n_errors++;
+  }
+
+  const PDPertHistory& read_pd_pert = read_snapshot->PDPertState();
+  if (!read_pd_pert.valid ||
+      read_pd_pert.delta_x_last != pd_pert.delta_x_last ||
+      read_pd_pert.delta_s_last != pd_pert.delta_s_last ||
+      read_pd_pert.delta_c_last != pd_pert.delta_c_last ||
+      read_pd_pert.delta_d_last != pd_pert.delta_d_last ||
+      read_pd_pert.hess_degenerate != pd_pert.hess_degenerate ||
+      read_pd_pert.jac_degenerate != pd_pert.jac_degenerate ||
+      read_pd_pert.degen_iters != pd_pert.degen_iters) {
+    printf("The perturbation history differs.\n");
+    n_errors++;
+  }
+
+  if (read_snapshot->LimMemHistoryLength() != lm_length ||
+      read_snapshot->LimMemSigma() != 5./3.) {
+    printf("The limited-memory history has %d pairs and sigma %g.\n",
+           read_snapshot->LimMemHistoryLength(),
+           read_snapshot->LimMemSigma());
+    n_errors++;
+  }
+  else {
+    for (Index i=0; i<lm_length; i++) {
+      SmartPtr<DenseVector> s = lm_space->MakeNewDenseVector();
+      SmartPtr<DenseVector> y = lm_space->MakeNewDenseVector();
+      if (!read_snapshot->GetLimMemPair(i, *s, *y) ||
+          !HasTestValues(*s, i) || !HasTestValues(*y, i + lm_length)) {
+        printf("Pair %d of the limited-memory history differs.\n", i);
+        n_errors++;
+      }
+    }
+    SmartPtr<DenseVectorSpace> wrong_space = new DenseVectorSpace(lm_dim + 1);
+    SmartPtr<DenseVector> s = wrong_space->MakeNewDenseVector();
+    SmartPtr<DenseVector> y = wrong_space->MakeNewDenseVector();
+    if (read_snapshot->GetLimMemPair(0, *s, *y)) {
+      printf("A pair was put into vectors of the wrong dimension.\n");
+      n_errors++;
+    }
+  }
+
+  // Writing the read snapshot gives the same text
+  std::ostringstream os2;
+  read_snapshot->Write(os2);
+  if (os2.str() != text) {
+    printf("Writing the read snapshot gives a different text.\n");
+    n_errors++;
+  }
+
+  // A snapshot that is cut off is not accepted, and then it is empty
+  std::istringstream is_cut(text.substr(0, text.size() - 10));
+  SmartPtr<WarmStartSnapshot> cut_snapshot = new WarmStartSnapshot();
+  if (cut_snapshot->Read(is_cut)) {
+    printf("A snapshot that is cut off was accepted.\n");
+    n_errors++;
+  }
+  if (cut_snapshot->PutInto(*read_iterates) ||
+      cut_snapshot->LimMemHistoryLength() != 0 ||
+      cut_snapshot->PDPertState().valid) {
+    printf("A snapshot that could not be read is not empty.\n");
+    n_errors++;
+  }
+
+  // An empty snapshot cannot be written
+  SmartPtr<WarmStartSnapshot> empty_snapshot = new WarmStartSnapshot();
+  std::ostringstream os3;
+  if (empty_snapshot->Write(os3)) {
+    printf("An empty snapshot was written.\n");
+    n_errors++;
+  }
+
+  if (n_errors > 0) {
+    printf("Snapshot test FAILED.\n");
+    return 1;
+  }
+  printf("Snapshot test passed.\n");
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+
+// Test for the max_wall_time option.  The problem is hs071, but the
+// intermediate callback makes each iteration from the second one on
+// take longer than the time limit.  Ipopt has to stop with
+// Maximum_WallTime_Exceeded, and finalize_solution has to get a
+// point within the bounds together with the objective and
+// constraint values at that point.
+
+#include "IpIpoptApplication.hpp"
+#include "IpUtils.hpp"
+#include "hs071_nlp.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace Ipopt;
+
+/** hs071 with slow iterations, which remembers the final point */
+class SlowHS071_NLP : public HS071_NLP
+{
+public:
+  SlowHS071_NLP(Number wait_time)
+      :
+      finalize_called(false),
+      final_status(SUCCESS),
+      final_obj(0.),
+      wait_time_(wait_time)
+  {}
+
+  virtual bool intermediate_callback(AlgorithmMode mode,
+                                     Index iter, Number obj_value,
+                                     Number inf_pr, Number inf_du,
+                                     Number mu, Number d_norm,
+                                     Number regularization_size,
+                                     Number alpha_du, Number alpha_pr,
+                                     Index ls_trials,
+                                     const IpoptData* ip_data,
+                                     IpoptCalculatedQuantities* ip_cq)
+  {
+    if (iter >= 2) {
+      Number start = WallclockTime();
+      while (WallclockTime() - start < wait_time_) {}
+    }
+    return true;
+  }
+
+  virtual void finalize_solution(SolverReturn status,
+                                 Index n, const Number* x, const Number* z_L, const Number* z_U,
+                                 Index m, const Number* g, const Number* lambda,
+                                 Number obj_value,
+                                 const IpoptData* ip_data,
+                                 IpoptCalculatedQuantities* ip_cq)
+  {
+    finalize_called = true;
+    final_status = status;
+    for (Index i=0; i<n; i++) {
+      final_x[i] = x[i];
+    }
+    for (Index i=0; i<m; i++) {
+      final_g[i] = g[i];
+    }
+    final_obj = obj_value;
+  }
+
+  bool finalize_called;
+  SolverReturn final_status;
+  Number final_x[4];
+  Number final_g[2];
+  Number final_obj;
+
+private:
+  Number wait_time_;
+};
+
+static bool Close(Number a, Number b)
+{
+  return fabs(a - b) <= 1e-8*Max(1., fabs(a), fabs(b));
+}
+
+int main()
+{
+  const Number max_wall_time = 0.05;
+  SmartPtr<SlowHS071_NLP> nlp = new SlowHS071_NLP(2.*max_wall_time);
+
+  SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+  app->Options()->SetIntegerValue("print_level", 0);
+  app->Options()->SetNumericValue("max_wall_time", max_wall_time);
+  ApplicationReturnStatus status = app->Initialize();
+  if (status != Solve_Succeeded) {
+    printf("Error during initialization!\n");
+    return 1;
+  }
+
+  status = app->OptimizeTNLP(GetRawPtr(nlp));
+
+  bool failed = false;
+  if (status != Maximum_WallTime_Exceeded) {
+    printf("Return status is %d instead of %d (Maximum_WallTime_Exceeded).\n",
+           status, Maximum_WallTime_Exceeded);
+    failed = true;
+  }
+  if (!nlp->finalize_called) {
+    printf("finalize_solution was not called.\n");
+    return 1;
+  }
+  if (nlp->final_status != WALLTIME_EXCEEDED) {
+    printf("finalize_solution got status %d instead of %d (WALLTIME_EXCEEDED).\n",
+           nlp->final_status, WALLTIME_EXCEEDED);
+    failed = true;
+  }
+  for (Index i=0; i<4; i++) {
+    if (!(nlp->final_x[i] >= 1. && nlp->final_x[i] <= 5.)) {
+      printf("x[%d] = %g is not within the bounds.\n", i, nlp->final_x[i]);
+      failed = true;
+    }
+  }
+  Number f;
+  Number g[2];
+  nlp->eval_f(4, nlp->final_x, true, f);
+  nlp->eval_g(4, nlp->final_x, false, 2, g);
+  if (!Close(f, nlp->final_obj)) {
+    printf("Final objective %g differs from f(x) = %g.\n", nlp->final_obj, f);
+    failed = true;
+  }
+  for (Index i=0; i<2; i++) {
+    if (!Close(g[i], nlp->final_g[i])) {
+      printf("Final g[%d] = %g differs from g(x) = %g.\n", i, nlp->final_g[i],
+             g[i]);
+      failed = true;
+    }
+  }
+
+  if (failed) {
+    printf("Wall time test FAILED.\n");
+    return 1;
+  }
+  printf("Wall time test passed.\n");
+  return 0;
+}